@@ -48,9 +48,65 @@
 
 #endif // ASCII_7SEG_BIT_PACK
 
+/**
+ * Without bit-packing, an encoding is 7 bools, so arrays of them are 7-byte
+ * strided and every encoding is copied a byte at a time. This pads each
+ * encoding to 8 bytes (aligned to 8), so that each one is a single 64-bit copy,
+ * and lets the x86 SIMD bulk path of Ascii7Seg_ConvertWord() expand packed
+ * encodings into the bool form with vector shuffles. Has no effect if
+ * ASCII_7SEG_BIT_PACK is defined.
+ */
+#ifndef ASCII_7SEG_BIT_PACK   // Do not remove this #ifndef construct!
+//! Uncomment to pad the non-bit-packed Ascii7Seg_Encoding_U out to 8 bytes
+//#define ASCII_7SEG_PAD_TO_8_BYTES
+#endif // ASCII_7SEG_BIT_PACK
+
 //! Uncomment to enforce computation of encoding instead of lookup (to save mem)
 //#define ASCII_7SEG_DONT_USE_LOOKUP_TABLE
 
+/**
+ * In the full range lookup table variant, replaces the 128-entry table indexed
+ * by the ASCII value with a 72-entry table indexed by a perfect hash of the
+ * character (see scripts/find_perfect_hash.py), plus a 16-byte set of the
+ * supported characters for Ascii7Seg_IsSupportedChar(). This saves ~350 bytes
+ * of rodata with separate bools and ~20 bytes bit-packed. It also turns off the
+ * SIMD bulk path, which needs the flat table. Every other variant is unaffected.
+ */
+//! Uncomment to look the encoding up through a perfect hash instead of the ASCII value (to save mem)
+//#define ASCII_7SEG_USE_PERFECT_HASH
+
+/**
+ * In the full range, lookup table variant of the library, either bit-packed or
+ * with ASCII_7SEG_PAD_TO_8_BYTES, built for an x86 host with GCC or clang,
+ * Ascii7Seg_ConvertWord() converts 16-64 characters at a time using the best of
+ * SSSE3, AVX2, or AVX-512 VBMI that the CPU supports (selected once at load
+ * time). Every other variant is unaffected.
+ *
+ * Likewise, bit-packed on such a host, Ascii7Seg_ConvertHex() dumps 16 or 32
+ * bytes at a time with SSSE3 or AVX2, in every range variant.
+ */
+//! Uncomment to keep Ascii7Seg_ConvertWord() and Ascii7Seg_ConvertHex() strictly scalar even where the SIMD kernels are available
+//#define ASCII_7SEG_NO_SIMD
+
+/**
+ * Builds every range and strategy into the library as a kernel of
+ * ascii7seg_encoder.h, so that an encoder can pick any of them at runtime. This
+ * also needs the kernel objects, so build with `make RUNTIME=1 ...` rather than
+ * uncommenting it here, and leave the range and lookup table macros below and
+ * above commented out: they only choose what the core API itself is built for.
+ * The core API is unaffected either way.
+ */
+//! Uncomment (through `make RUNTIME=1`) to let ascii7seg_encoder.h pick the range and strategy at runtime
+//#define ASCII_7SEG_RUNTIME_DISPATCH
+
+/**
+ * On POSIX hosts built with GCC or clang, the pools of ascii7seg_parallel.h
+ * convert on worker threads (link with -pthread). Everywhere else, they convert
+ * on the calling thread, with the same API and results.
+ */
+//! Uncomment to keep the pools of ascii7seg_parallel.h on the calling thread, and not need -pthread
+//#define ASCII_7SEG_NO_THREADS
+
 
 /************************ Config Macros to Limit Range ************************/
 // NOTE! Only one of the below macros will take effect.
@@ -0,0 +1,552 @@
+/**
+ * @file bench_ascii7seg.c
+ * @brief Benchmark harness for Ascii7Seg_ConvertChar(), Ascii7Seg_ConvertWord()
+ *        and Ascii7Seg_IsSupportedChar(), for whichever variant of the
+ *        library it is linked against.
+ *
+ * Each function is run over three corpora of the same length:
+ *
+ *    digits       only '0' to '9', what most displays show most of the time
+ *    mixed        display-sized words of text, numbers and punctuation, some of
+ *                 which the narrower range variants can't encode
+ *    adversarial  random bytes, mostly unsupported, in an order no branch
+ *                 predictor can learn
+ *
+ * Ascii7Seg_ConvertWord() is called once per display-sized word (WORD_LEN
+ * characters) and stops at the first character it can't encode, just as it
+ * would in an application. Every figure is per character of the corpus, so
+ * the functions and variants can be compared directly.
+ *
+ * Ascii7Seg_ConvertBytes() and Ascii7Seg_PoolConvertBytes() are then timed
+ * over one BULK_LEN corpus of digits, converted in a single call, with pools of
+ * 1, 2, 4, ... workers up to the number of CPUs, to show how the pool scales
+ * ("bulk-digits" rows, function "PoolConvertBytes-<workers>"). Their hardware
+ * counters only cover the calling thread.
+ *
+ * Every function/corpus pair is timed NUM_TRIALS times and the fastest trial is
+ * reported, with the hardware counters of that same trial. The results are
+ * printed as CSV rows (see CSV_HEADER), or appended to the file given as the
+ * first argument, which gets the header if it's empty. "NA" marks a counter the
+ * host won't give us (e.g., perf_event_open() isn't available or is denied by
+ * /proc/sys/kernel/perf_event_paranoid).
+ *
+ * Build and run it through the Makefile: `make benchmark` for the variant set
+ * up in ascii7seg_config.h, or `make benchmark-all` for every combination of
+ * range, lookup table, and layout.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+// For clock_gettime(), and syscall() for perf_event_open()
+#define _GNU_SOURCE
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include "ascii7seg.h"
+#include "ascii7seg_parallel.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+#define CORPUS_LEN      ( 64u * 1024u )  // Big enough to dwarf the call overhead, small enough for L2
+#define WORD_LEN        8u               // Characters per display-sized word
+#define NUM_REPEATS     16u              // Passes over the corpus per trial
+#define NUM_TRIALS      25u
+#define BULK_LEN        ( 4u * 1024u * 1024u ) // Enough chunks to keep every worker busy
+
+#define CSV_HEADER   "variant,range,lookup,layout,function,corpus,chars," \
+                     "ns_per_char,cycles_per_char,branch_misses_per_char,branch_miss_rate"
+
+// The variant this harness was built against
+#if defined(ASCII_7SEG_NUMS_ONLY)
+#define VARIANT_RANGE   "nums"
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+#define VARIANT_RANGE   "numerr"
+#else
+#define VARIANT_RANGE   "full"
+#endif
+
+#if defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE)
+#define VARIANT_LOOKUP  "computed"
+#elif defined(ASCII_7SEG_USE_PERFECT_HASH) && !defined(ASCII_7SEG_NUMS_ONLY) && !defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+#define VARIANT_LOOKUP  "hashed"
+#else
+#define VARIANT_LOOKUP  "lut"
+#endif
+
+#if defined(ASCII_7SEG_BIT_PACK)
+#define VARIANT_LAYOUT  "bp"
+#elif defined(ASCII_7SEG_PAD_TO_8_BYTES)
+#define VARIANT_LAYOUT  "bool8"
+#else
+#define VARIANT_LAYOUT  "bool7"
+#endif
+
+#define VARIANT_NAME    VARIANT_RANGE "-" VARIANT_LOOKUP "-" VARIANT_LAYOUT
+
+/* Local Datatypes */
+
+enum Corpus_E
+{
+   CORPUS_DIGITS,
+   CORPUS_MIXED,
+   CORPUS_ADVERSARIAL,
+   NUM_CORPORA
+};
+
+enum Counter_E
+{
+   COUNTER_CYCLES,
+   COUNTER_BRANCHES,
+   COUNTER_BRANCH_MISSES,
+   NUM_COUNTERS
+};
+
+struct Counters_S
+{
+   int fds[NUM_COUNTERS];  // -1 where a counter isn't available
+   uint64_t values[NUM_COUNTERS];
+};
+
+struct Measurement_S
+{
+   double ns;
+   uint64_t counts[NUM_COUNTERS];
+   bool counted[NUM_COUNTERS];
+};
+
+typedef uint64_t (*BenchFn_T)( const char * corpus, size_t len );
+
+struct Benchmark_S
+{
+   const char * name;
+   BenchFn_T run;
+};
+
+/* Local Data */
+
+static const char * const CorpusNames[NUM_CORPORA] = { "digits", "mixed", "adversarial" };
+static const char * const BulkCorpusName = "bulk-digits";
+
+// The words the mixed corpus is drawn from: readouts, status words, and a bit of
+// everything else a segment display ends up showing
+static const char * const MixedWords[] =
+{
+   "12:34", "-40", "3.1415", "Err", "Error 42", "HELLO", "boot", "99.9",
+   "OPEN", "run", "CAL 2", "[-_-]", "Lo bAtt", "rpm 3000", "2025", "Stop",
+   "FULL", "0x1F", "PASS", "FAIL 7", "USB", "temp 21C", "=>", "88888888"
+};
+
+static char Corpora[NUM_CORPORA][CORPUS_LEN];
+
+static char * BulkCorpus;
+static union Ascii7Seg_Encoding_U * BulkEncodings;
+static struct Ascii7Seg_Pool_S Pool;
+
+// Keeps the compiler from throwing the results away
+static volatile uint64_t Sink;
+
+static uint64_t RandomState = UINT64_C(0x9E3779B97F4A7C15);
+
+/* Private Function Prototypes */
+
+static uint64_t Random( void );
+static void BuildCorpora( void );
+static uint64_t BenchConvertChar( const char * corpus, size_t len );
+static uint64_t BenchConvertWord( const char * corpus, size_t len );
+static uint64_t BenchIsSupportedChar( const char * corpus, size_t len );
+static uint64_t BenchConvertBytes( const char * corpus, size_t len );
+static uint64_t BenchPoolConvertBytes( const char * corpus, size_t len );
+static void RunBulkBenchmarks( FILE * out, struct Counters_S * counters );
+static double NowNs( void );
+static void CountersOpen( struct Counters_S * counters );
+static void CountersClose( struct Counters_S * counters );
+static void CountersStart( struct Counters_S * counters );
+static void CountersStop( struct Counters_S * counters );
+static struct Measurement_S Measure( BenchFn_T run, const char * corpus, size_t len, struct Counters_S * counters );
+static void PrintRow( FILE * out, const char * function, const char * corpus, size_t len, const struct Measurement_S * m );
+
+static const struct Benchmark_S Benchmarks[] =
+{
+   { "ConvertChar", BenchConvertChar },
+   { "ConvertWord", BenchConvertWord },
+   { "IsSupportedChar", BenchIsSupportedChar }
+};
+
+/* Meat of the Program */
+
+int main( int argc, char * argv[] )
+{
+   FILE * out = stdout;
+   if ( argc > 1 )
+   {
+      out = fopen( argv[1], "a" );
+      if ( NULL == out )
+      {
+         perror( argv[1] );
+         return EXIT_FAILURE;
+      }
+   }
+
+   // ftell() of a file opened for appending is its size
+   if ( (stdout == out) || (0 == ftell(out)) )
+   {
+      (void)fprintf( out, "%s\n", CSV_HEADER );
+   }
+
+   BuildCorpora();
+
+   struct Counters_S counters;
+   CountersOpen( &counters );
+
+   for ( size_t b = 0; b < (sizeof(Benchmarks) / sizeof(Benchmarks[0])); b++ )
+   {
+      for ( size_t c = 0; c < NUM_CORPORA; c++ )
+      {
+         const struct Measurement_S m = Measure( Benchmarks[b].run, Corpora[c], CORPUS_LEN, &counters );
+         PrintRow( out, Benchmarks[b].name, CorpusNames[c], CORPUS_LEN, &m );
+      }
+   }
+
+   RunBulkBenchmarks( out, &counters );
+
+   CountersClose( &counters );
+
+   if ( out != stdout )
+   {
+      (void)fclose( out );
+   }
+
+   return EXIT_SUCCESS;
+}
+
+/* Private Function Implementations */
+
+/**
+ * xorshift64, so that the corpora are the same on every run and every variant.
+ */
+/******************************************************************************/
+static uint64_t Random( void )
+{
+   RandomState ^= RandomState << 13;
+   RandomState ^= RandomState >> 7;
+   RandomState ^= RandomState << 17;
+   return RandomState;
+}
+
+/******************************************************************************/
+static void BuildCorpora( void )
+{
+   for ( size_t i = 0; i < CORPUS_LEN; i++ )
+   {
+      Corpora[CORPUS_DIGITS][i] = (char)( '0' + (Random() % 10u) );
+      Corpora[CORPUS_ADVERSARIAL][i] = (char)( Random() & 0xFFu );
+   }
+
+   // Words padded with spaces (which no variant encodes) to WORD_LEN, the way
+   // they'd be laid out on a display
+   size_t i = 0;
+   while ( i < CORPUS_LEN )
+   {
+      const char * word = MixedWords[ Random() % (sizeof(MixedWords) / sizeof(MixedWords[0])) ];
+      const size_t word_len = strlen( word );
+      for ( size_t j = 0; (j < WORD_LEN) && (i < CORPUS_LEN); j++, i++ )
+      {
+         Corpora[CORPUS_MIXED][i] = ( j < word_len ) ? word[j] : ' ';
+      }
+   }
+}
+
+/******************************************************************************/
+static uint64_t BenchConvertChar( const char * corpus, size_t len )
+{
+   uint64_t sum = 0;
+   for ( size_t i = 0; i < len; i++ )
+   {
+      union Ascii7Seg_Encoding_U encoding;
+      sum += Ascii7Seg_ConvertChar( corpus[i], &encoding ) ? encoding.segments.a : 2u;
+   }
+   return sum;
+}
+
+/******************************************************************************/
+static uint64_t BenchConvertWord( const char * corpus, size_t len )
+{
+   uint64_t sum = 0;
+   union Ascii7Seg_Encoding_U encodings[WORD_LEN];
+   (void)memset( encodings, 0, sizeof(encodings) );
+   for ( size_t i = 0; i < len; i += WORD_LEN )
+   {
+      const size_t word_len = ( (len - i) < WORD_LEN ) ? (len - i) : WORD_LEN;
+      sum += Ascii7Seg_ConvertWord( &corpus[i], word_len, encodings );
+   }
+   return sum + encodings[0].segments.g;
+}
+
+/******************************************************************************/
+static uint64_t BenchIsSupportedChar( const char * corpus, size_t len )
+{
+   uint64_t sum = 0;
+   for ( size_t i = 0; i < len; i++ )
+   {
+      sum += Ascii7Seg_IsSupportedChar( corpus[i] ) ? 1u : 0u;
+   }
+   return sum;
+}
+
+/******************************************************************************/
+static uint64_t BenchConvertBytes( const char * corpus, size_t len )
+{
+   return Ascii7Seg_ConvertBytes( corpus, len, BulkEncodings, len ).converted + BulkEncodings[0].segments.g;
+}
+
+/******************************************************************************/
+static uint64_t BenchPoolConvertBytes( const char * corpus, size_t len )
+{
+   return Ascii7Seg_PoolConvertBytes( &Pool, corpus, len, BulkEncodings, len ).converted + BulkEncodings[0].segments.g;
+}
+
+/**
+ * The serial call, then a pool of each power of two workers up to the number
+ * of CPUs (and that number itself, if it isn't a power of two).
+ */
+/******************************************************************************/
+static void RunBulkBenchmarks( FILE * out, struct Counters_S * counters )
+{
+   BulkCorpus = malloc( BULK_LEN );
+   BulkEncodings = malloc( BULK_LEN * sizeof(*BulkEncodings) );
+   if ( (NULL == BulkCorpus) || (NULL == BulkEncodings) )
+   {
+      (void)fprintf( stderr, "Skipping the bulk benchmarks: out of memory\n" );
+      free( BulkCorpus );
+      free( BulkEncodings );
+      return;
+   }
+
+   for ( size_t i = 0; i < BULK_LEN; i++ )
+   {
+      BulkCorpus[i] = Corpora[CORPUS_DIGITS][i % CORPUS_LEN];
+   }
+
+   struct Measurement_S m = Measure( BenchConvertBytes, BulkCorpus, BULK_LEN, counters );
+   PrintRow( out, "ConvertBytes", BulkCorpusName, BULK_LEN, &m );
+
+   struct Ascii7Seg_Pool_S probe;
+   size_t max_workers = 1;
+   if ( Ascii7Seg_PoolInit(&probe, 0) )
+   {
+      max_workers = probe.num_workers;
+      Ascii7Seg_PoolDeinit( &probe );
+   }
+
+   size_t workers = 1;
+   while ( Ascii7Seg_PoolInit(&Pool, workers) )
+   {
+      char name[32];
+      (void)snprintf( name, sizeof(name), "PoolConvertBytes-%zu", Pool.num_workers );
+      m = Measure( BenchPoolConvertBytes, BulkCorpus, BULK_LEN, counters );
+      PrintRow( out, name, BulkCorpusName, BULK_LEN, &m );
+      Ascii7Seg_PoolDeinit( &Pool );
+
+      if ( workers == max_workers )
+      {
+         break;
+      }
+      workers = ( (workers * 2u) < max_workers ) ? (workers * 2u) : max_workers;
+   }
+
+   free( BulkCorpus );
+   free( BulkEncodings );
+}
+
+/******************************************************************************/
+static double NowNs( void )
+{
+   struct timespec ts;
+   (void)clock_gettime( CLOCK_MONOTONIC, &ts );
+   return ( (double)ts.tv_sec * 1e9 ) + (double)ts.tv_nsec;
+}
+
+/**
+ * Opens the core cycle, branch, and branch miss counters of this thread, in
+ * user space only. Whichever can't be opened are left at -1 and reported as NA.
+ */
+/******************************************************************************/
+static void CountersOpen( struct Counters_S * counters )
+{
+   for ( size_t i = 0; i < NUM_COUNTERS; i++ )
+   {
+      counters->fds[i] = -1;
+      counters->values[i] = 0;
+   }
+
+#ifdef __linux__
+   static const uint64_t Configs[NUM_COUNTERS] =
+   {
+      [COUNTER_CYCLES] = PERF_COUNT_HW_CPU_CYCLES,
+      [COUNTER_BRANCHES] = PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+      [COUNTER_BRANCH_MISSES] = PERF_COUNT_HW_BRANCH_MISSES
+   };
+
+   for ( size_t i = 0; i < NUM_COUNTERS; i++ )
+   {
+      struct perf_event_attr attr;
+      (void)memset( &attr, 0, sizeof(attr) );
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.size = sizeof(attr);
+      attr.config = Configs[i];
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      counters->fds[i] = (int)syscall( SYS_perf_event_open, &attr, 0, -1, -1, 0UL );
+   }
+#endif
+}
+
+/******************************************************************************/
+static void CountersClose( struct Counters_S * counters )
+{
+#ifdef __linux__
+   for ( size_t i = 0; i < NUM_COUNTERS; i++ )
+   {
+      if ( counters->fds[i] >= 0 )
+      {
+         (void)close( counters->fds[i] );
+      }
+   }
+#else
+   (void)counters;
+#endif
+}
+
+/******************************************************************************/
+static void CountersStart( struct Counters_S * counters )
+{
+#ifdef __linux__
+   for ( size_t i = 0; i < NUM_COUNTERS; i++ )
+   {
+      if ( counters->fds[i] >= 0 )
+      {
+         (void)ioctl( counters->fds[i], PERF_EVENT_IOC_RESET, 0 );
+         (void)ioctl( counters->fds[i], PERF_EVENT_IOC_ENABLE, 0 );
+      }
+   }
+#else
+   (void)counters;
+#endif
+}
+
+/******************************************************************************/
+static void CountersStop( struct Counters_S * counters )
+{
+#ifdef __linux__
+   for ( size_t i = 0; i < NUM_COUNTERS; i++ )
+   {
+      counters->values[i] = 0;
+      if ( counters->fds[i] >= 0 )
+      {
+         (void)ioctl( counters->fds[i], PERF_EVENT_IOC_DISABLE, 0 );
+         if ( read(counters->fds[i], &counters->values[i], sizeof(counters->values[i])) !=
+              (ssize_t)sizeof(counters->values[i]) )
+         {
+            counters->values[i] = 0;
+         }
+      }
+   }
+#else
+   (void)counters;
+#endif
+}
+
+/**
+ * Runs the benchmark NUM_TRIALS times of NUM_REPEATS passes over the corpus,
+ * after a warm-up pass, and keeps the fastest trial.
+ */
+/******************************************************************************/
+static struct Measurement_S Measure( BenchFn_T run, const char * corpus, size_t len, struct Counters_S * counters )
+{
+   struct Measurement_S best;
+   (void)memset( &best, 0, sizeof(best) );
+   best.ns = -1.0;
+
+   Sink += run( corpus, len );
+
+   for ( size_t t = 0; t < NUM_TRIALS; t++ )
+   {
+      uint64_t sum = 0;
+      CountersStart( counters );
+      const double start = NowNs();
+      for ( size_t r = 0; r < NUM_REPEATS; r++ )
+      {
+         sum += run( corpus, len );
+      }
+      const double elapsed = NowNs() - start;
+      CountersStop( counters );
+      Sink += sum;
+
+      if ( (best.ns < 0.0) || (elapsed < best.ns) )
+      {
+         best.ns = elapsed;
+         for ( size_t i = 0; i < NUM_COUNTERS; i++ )
+         {
+            best.counts[i] = counters->values[i];
+            best.counted[i] = ( counters->fds[i] >= 0 );
+         }
+      }
+   }
+
+   return best;
+}
+
+/******************************************************************************/
+static void PrintRow( FILE * out, const char * function, const char * corpus, size_t len, const struct Measurement_S * m )
+{
+   const double chars = (double)len * (double)NUM_REPEATS;
+
+   (void)fprintf( out, "%s,%s,%s,%s,%s,%s,%zu,%.3f,",
+                  VARIANT_NAME, VARIANT_RANGE, VARIANT_LOOKUP, VARIANT_LAYOUT,
+                  function, corpus, len, m->ns / chars );
+
+   if ( m->counted[COUNTER_CYCLES] )
+   {
+      (void)fprintf( out, "%.3f,", (double)m->counts[COUNTER_CYCLES] / chars );
+   }
+   else
+   {
+      (void)fprintf( out, "NA," );
+   }
+
+   if ( m->counted[COUNTER_BRANCH_MISSES] )
+   {
+      (void)fprintf( out, "%.5f,", (double)m->counts[COUNTER_BRANCH_MISSES] / chars );
+   }
+   else
+   {
+      (void)fprintf( out, "NA," );
+   }
+
+   if ( m->counted[COUNTER_BRANCH_MISSES] && m->counted[COUNTER_BRANCHES] &&
+        (m->counts[COUNTER_BRANCHES] > 0u) )
+   {
+      (void)fprintf( out, "%.5f\n",
+                     (double)m->counts[COUNTER_BRANCH_MISSES] / (double)m->counts[COUNTER_BRANCHES] );
+   }
+   else
+   {
+      (void)fprintf( out, "NA\n" );
+   }
+}
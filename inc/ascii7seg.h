@@ -12,11 +12,24 @@
 
 /* File Inclusions */
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include "ascii7seg_config.h"
 
 /* Public Macro Definitions */
 
+//! Ascii7Seg_Result_S.invalid_idx when no unsupported character was found
+#define ASCII_7SEG_NO_INVALID_IDX   SIZE_MAX
+
+/**
+ * Defined if Ascii7Seg_Encoding_U has a decimal point segment (segments.dp),
+ * which is the case in the bit-packed and the padded layouts, where it takes
+ * the otherwise unused eighth bit/bool. The 7-byte layout has no room for it.
+ */
+#if defined(ASCII_7SEG_BIT_PACK) || defined(ASCII_7SEG_PAD_TO_8_BYTES)
+#define ASCII_7SEG_HAS_DP
+#endif
+
 /* Public Datatypes */
 
 /**
@@ -28,12 +41,18 @@
  *
  * When ASCII_7SEG_BIT_PACK is defined:
  *   - Each segment (a-g) is represented as a single bit within a struct, allowing compact storage in one byte.
- *   - The 'reserved' bit encourages the compiler to use one byte to store all 8 bitfield members.
+ *   - The 'dp' bit is the decimal point segment, which also encourages the compiler to use one byte to store all 8 bitfield members.
  *   - The entire encoding can also be accessed as an unsigned integer via 'encoding_as_val'.
  *
  * When ASCII_7SEG_BIT_PACK is not defined:
  *   - Each segment is represented as a separate bool field.
  *   - The entire encoding can also be accessed as a bool array via 'encoding_as_val'.
+ *   - If ASCII_7SEG_PAD_TO_8_BYTES is defined, a 'dp' bool (the decimal point
+ *     segment) pads each encoding out to 8 bytes, and 'encoding_as_word' aligns
+ *     it to 8 bytes, so that each encoding is read or written with one 64-bit access.
+ *
+ * The conversion functions always leave the decimal point off. Only the
+ * formatters that place one (see ascii7seg_format.h) turn it on.
  *
  * This design provides the user flexibility in the way they want to represent the 7-segment display states.
  */
@@ -74,7 +93,7 @@ union Ascii7Seg_Encoding_U
       unsigned e : 1;
       unsigned f : 1;
       unsigned g : 1;
-      unsigned reserved : 1; // UNUSED. Helps encourage the compiler to store all these bits in a single byte for tighter storage.
+      unsigned dp : 1; // Decimal point. Also helps encourage the compiler to store all these bits in a single byte for tighter storage.
    } segments;
 #ifdef _MSC_VER
 #pragma pack(pop)
@@ -92,6 +111,9 @@ union Ascii7Seg_Encoding_U
       bool e;
       bool f;
       bool g;
+#ifdef ASCII_7SEG_PAD_TO_8_BYTES
+      bool dp; // Decimal point. Also pads the encoding out to 8 bytes.
+#endif
    } segments;
 #endif // ASCII_7SEG_BIT_PACK
 
@@ -101,10 +123,44 @@ union Ascii7Seg_Encoding_U
    bool encoding_as_val[7]; // NOTE: Unioning this with a struct of 7 bool's is
                             //       not guaranteed to work as intended by the
                             //       standard but practically, this should be ok...
+#ifdef ASCII_7SEG_PAD_TO_8_BYTES
+   uint64_t encoding_as_word;
+#endif
 #endif
 
 };
 
+/**
+ * @brief Outcome of Ascii7Seg_ConvertBytes().
+ *
+ * If converted is less than the number of characters passed in and invalid_idx
+ * is ASCII_7SEG_NO_INVALID_IDX, the conversion stopped because buf was full.
+ */
+struct Ascii7Seg_Result_S
+{
+   size_t converted;    //!< Number of encodings written to the front of buf
+   size_t invalid_idx;  //!< Index of the first unsupported character, or ASCII_7SEG_NO_INVALID_IDX
+   char invalid_char;   //!< The unsupported character at invalid_idx ('\0' if there is none)
+};
+
+#ifdef ASCII_7SEG_HAS_DP
+
+//! Ascii7Seg_ConvertWordEx() options
+#define ASCII_7SEG_WORD_NONE      0u
+#define ASCII_7SEG_WORD_FOLD_DP   (1u << 0) //!< Fold each '.' into the decimal point of the encoding before it
+
+/**
+ * @brief Outcome of Ascii7Seg_ConvertWordEx(). With ASCII_7SEG_WORD_FOLD_DP,
+ *        the two differ by the number of dots folded away.
+ */
+struct Ascii7Seg_WordResult_S
+{
+   size_t consumed;     //!< Number of characters of the input used up
+   size_t produced;     //!< Number of encodings written to the front of buf
+};
+
+#endif // ASCII_7SEG_HAS_DP
+
 /* Public API */
 
 // To allow usage in C++ code...
@@ -149,6 +205,18 @@ bool Ascii7Seg_ConvertChar( char ascii_char, union Ascii7Seg_Encoding_U * buf );
  *       or str_len characters.
  * @note This also means that if there is at least one valid character and
  *       str_len is > 1, buf is mutated!
+ * @note buf is never written past the number of characters converted.
+ * @note In the bit-packed, full range, lookup table variant on x86 hosts, this
+ *       converts 16-64 characters per step using SIMD (see ASCII_7SEG_NO_SIMD
+ *       in ascii7seg_config.h). To do so, it may read past the null terminator
+ *       up to the end of the enclosing aligned 16/32/64-byte block, which can
+ *       never cross into another page.
+ * @note In the ASCII_7SEG_NUMS_ONLY and ASCII_7SEG_NUMS_AND_ERROR_ONLY variants,
+ *       this converts a machine word (4 or 8 characters) per step using SWAR.
+ *       It may likewise read past the null terminator up to the end of the
+ *       enclosing aligned word, but never past str_len characters. Sanitizers
+ *       or an MPU that guard the end of str will flag this unless str_len is
+ *       the length of the string.
  *
  * @param[in]  str      Pointer to the input ASCII string.
  * @param[in]  str_len  Length of the input string to convert.
@@ -160,6 +228,37 @@ size_t Ascii7Seg_ConvertWord( const char * str,
                               size_t str_len,
                               union Ascii7Seg_Encoding_U * buf );
 
+/**
+ * @brief Converts exactly src_len characters to their 7-segment display
+ *        encodings, for callers that already know the length of their input
+ *        (e.g., length-prefixed messages).
+ *
+ * Unlike Ascii7Seg_ConvertWord(), a null character is not treated as the end
+ * of src but as an unsupported character like any other. Conversion stops at
+ * the first unsupported character or after buf_cap characters, whichever comes
+ * first.
+ *
+ * @note buf[result.converted] to buf[buf_cap - 1] may be overwritten with
+ *       scratch values. Passing the real capacity of buf, rather than src_len,
+ *       lets the SIMD paths finish with a full vector store.
+ * @note If src or buf is NULL, nothing is converted and invalid_idx is
+ *       ASCII_7SEG_NO_INVALID_IDX.
+ * @note The same SIMD over-read of src as in Ascii7Seg_ConvertWord() applies.
+ *       The SWAR path of the numeric variants never reads past src_len.
+ *
+ * @param[in]  src      Pointer to the input ASCII characters (need not be null terminated).
+ * @param[in]  src_len  Number of characters in src.
+ * @param[out] buf      Pointer to the buffer where the 7-segment encodings will be stored.
+ * @param[in]  buf_cap  Number of encodings buf can hold.
+ *
+ * @return The number of characters converted and, if the conversion stopped
+ *         on an unsupported character, where it is and what it was
+ */
+struct Ascii7Seg_Result_S Ascii7Seg_ConvertBytes( const char * src,
+                                                  size_t src_len,
+                                                  union Ascii7Seg_Encoding_U * buf,
+                                                  size_t buf_cap );
+
 /**
  * @brief Checks if the given ASCII character is supported by this module.
  *
@@ -168,6 +267,43 @@ size_t Ascii7Seg_ConvertWord( const char * str,
  */
 bool Ascii7Seg_IsSupportedChar( char ascii_char );
 
+#ifdef ASCII_7SEG_HAS_DP
+
+/**
+ * @brief Converts a word like Ascii7Seg_ConvertWord(), with options.
+ *
+ * With ASCII_7SEG_WORD_FOLD_DP, a '.' does not end the word. It turns on the
+ * decimal point of the encoding before it, so "3.14" is 3 encodings and
+ * "1.2.3" is 3 encodings. A dot with no encoding of its own to go on (at the
+ * start of the word, or right after another dot) becomes a blank encoding with
+ * just its decimal point on, so ".5" is 2 encodings and "1..2" is 3. This
+ * happens in the same pass as the encoding, with no temporary buffer.
+ *
+ * Conversion stops at the null terminator, at str_len characters, at an
+ * unsupported character, or when buf is full. A dot that can be folded into
+ * the last encoding is still consumed when buf is full.
+ *
+ * @note Runs of characters between dots are converted by
+ *       Ascii7Seg_ConvertBytes(), so its SIMD paths, its over-read of str, and
+ *       its scratch writes to the rest of buf apply.
+ *
+ * @param[in]  str      Pointer to the input ASCII string.
+ * @param[in]  str_len  Most characters to convert.
+ * @param[out] buf      Pointer to the buffer where the 7-segment encodings will be stored.
+ * @param[in]  buf_cap  Number of encodings buf can hold.
+ * @param[in]  options  ASCII_7SEG_WORD_x options.
+ *
+ * @return How many characters were consumed and how many encodings were
+ *         produced (both 0 if str or buf is NULL)
+ */
+struct Ascii7Seg_WordResult_S Ascii7Seg_ConvertWordEx( const char * str,
+                                                       size_t str_len,
+                                                       union Ascii7Seg_Encoding_U * buf,
+                                                       size_t buf_cap,
+                                                       unsigned int options );
+
+#endif // ASCII_7SEG_HAS_DP
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,250 @@
+/**
+ * @file ascii7seg.hpp
+ * @brief Compile-time (constexpr) ASCII to 7-segment encoding for C++ users.
+ *
+ * Everything here is header-only and encodes from the same table data as the C
+ * library (scripts/ascii7seg_encodings.csv), for the same configuration (see
+ * ascii7seg_config.h), so the results match Ascii7Seg_ConvertChar() and
+ * Ascii7Seg_ConvertWord() exactly. The point is to move the encoding of
+ * constant messages out of the program entirely:
+ *
+ *    using namespace ascii7seg::literals;
+ *    constexpr auto & ready = "rEAdY"_7seg;   // std::array of 5 encodings, in rodata
+ *
+ * An unsupported character in a _7seg literal is a compile error.
+ *
+ * Requires C++17. The _7seg literal also requires C++20, or GCC/clang, which
+ * support string literal operator templates as an extension.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_HPP_
+#define ASCII_7SEG_HPP_
+
+/* File Inclusions */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include "ascii7seg.h"
+#include "ascii7seg_config.h"
+
+/* Public Macro Definitions */
+
+#if defined(__cpp_nontype_template_args) && (__cpp_nontype_template_args >= 201911L)
+#define ASCII_7SEG_HPP_LITERAL_NTTP    // C++20 string literals as template arguments
+#elif defined(__GNUC__) || defined(__clang__)
+#define ASCII_7SEG_HPP_LITERAL_GNU     // GNU string literal operator templates
+#endif
+
+namespace ascii7seg
+{
+
+namespace detail
+{
+
+/**
+ * One byte per ASCII value, where bit s is segment s (a = 0 ... g = 6), and 0
+ * marks an unsupported character. Generated from scripts/ascii7seg_encodings.csv
+ * by scripts/gen_constexpr_table.py, so edit the CSV and re-run the script with
+ * `--write inc/ascii7seg.hpp` rather than editing the table by hand.
+ */
+// BEGIN GENERATED CODE: scripts/gen_constexpr_table.py (do not edit by hand)
+inline constexpr std::uint8_t PackedLUT[128] =
+{
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x00 - 0x07
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x08 - 0x0F
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x10 - 0x17
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x18 - 0x1F
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // 0x20 - 0x27
+   0x39, 0x0F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,  // '(' - '/'
+   0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07,  // '0' - '7'
+   0x7F, 0x6F, 0x00, 0x00, 0x58, 0x48, 0x4C, 0x00,  // '8' - '?'
+   0x00, 0x77, 0x7F, 0x39, 0x3F, 0x79, 0x71, 0x7D,  // '@' - 'G'
+   0x76, 0x06, 0x0E, 0x75, 0x38, 0x15, 0x37, 0x3F,  // 'H' - 'O'
+   0x73, 0x6B, 0x33, 0x6D, 0x78, 0x3E, 0x3E, 0x2A,  // 'P' - 'W'
+   0x76, 0x6E, 0x5B, 0x39, 0x00, 0x0F, 0x00, 0x08,  // 'X' - '_'
+   0x00, 0x5F, 0x7C, 0x58, 0x5E, 0x7B, 0x71, 0x6F,  // '`' - 'g'
+   0x76, 0x10, 0x0E, 0x75, 0x30, 0x14, 0x54, 0x5C,  // 'h' - 'o'
+   0x73, 0x6F, 0x50, 0x6D, 0x78, 0x1C, 0x1C, 0x14,  // 'p' - 'w'
+   0x76, 0x6E, 0x5B, 0x00, 0x06, 0x00, 0x00, 0x00   // 'x' - 0x7F
+};
+// END GENERATED CODE (72 supported characters)
+
+//! Whether segment s of a packed encoding is on
+constexpr bool Segment( std::uint8_t packed, unsigned s )
+{
+   return 0u != ( (packed >> s) & 1u );
+}
+
+/**
+ * Builds the Ascii7Seg_Encoding_U of a packed encoding. Aggregate initialization
+ * initializes the first member of a union, which is segments in every layout.
+ */
+constexpr union Ascii7Seg_Encoding_U Unpack( std::uint8_t packed )
+{
+   return { { Segment(packed, 0), Segment(packed, 1), Segment(packed, 2),
+              Segment(packed, 3), Segment(packed, 4), Segment(packed, 5),
+              Segment(packed, 6)
+#if defined(ASCII_7SEG_BIT_PACK) || defined(ASCII_7SEG_PAD_TO_8_BYTES)
+              , false  // dp
+#endif
+            } };
+}
+
+} // namespace detail
+
+/**
+ * @brief constexpr equivalent of Ascii7Seg_IsSupportedChar().
+ */
+constexpr bool IsSupportedChar( char ascii_char )
+{
+#ifdef ASCII_7SEG_NUMS_ONLY
+   return (ascii_char >= '0') && (ascii_char <= '9');
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+   return ( (ascii_char >= '0') && (ascii_char <= '9') ) ||
+          (ascii_char == 'E') || (ascii_char == 'e') ||
+          (ascii_char == 'R') || (ascii_char == 'r') ||
+          (ascii_char == 'O') || (ascii_char == 'o');
+#else
+   return (ascii_char > 0) && (0u != detail::PackedLUT[static_cast<std::uint8_t>(ascii_char)]);
+#endif // ASCII_7SEG_NUMS_ONLY
+}
+
+/**
+ * @brief constexpr equivalent of Ascii7Seg_ConvertChar().
+ *
+ * @return true if ascii_char is supported and buf isn't NULL (and buf has been
+ *         written to), false otherwise
+ */
+constexpr bool ConvertChar( char ascii_char, union Ascii7Seg_Encoding_U * buf )
+{
+   if ( (nullptr == buf) || !IsSupportedChar(ascii_char) )
+   {
+      return false;
+   }
+
+   *buf = detail::Unpack( detail::PackedLUT[static_cast<std::uint8_t>(ascii_char)] );
+   return true;
+}
+
+/**
+ * @brief constexpr equivalent of Ascii7Seg_ConvertWord().
+ *
+ * @return Number of characters converted, up to the first unsupported
+ *         character, the null terminator, or str_len characters
+ */
+constexpr std::size_t ConvertWord( const char * str,
+                                   std::size_t str_len,
+                                   union Ascii7Seg_Encoding_U * buf )
+{
+   if ( (nullptr == str) || (nullptr == buf) )
+   {
+      return 0;
+   }
+
+   std::size_t chars_converted = 0;
+   while ( (chars_converted < str_len) && (str[chars_converted] != '\0') &&
+           ConvertChar(str[chars_converted], &buf[chars_converted]) )
+   {
+      chars_converted++;
+   }
+
+   return chars_converted;
+}
+
+namespace detail
+{
+
+//! Encodes a pack of characters that are already known to be supported
+template <char... Chars>
+inline constexpr std::array<union Ascii7Seg_Encoding_U, sizeof...(Chars)> EncodedChars =
+   { { Unpack( PackedLUT[static_cast<std::uint8_t>(Chars)] )... } };
+
+#ifdef ASCII_7SEG_HPP_LITERAL_NTTP
+
+//! A string literal that can be used as a template argument
+template <std::size_t N>
+struct Literal
+{
+   char chars[N];
+
+   constexpr Literal( const char (&str)[N] ) : chars{}
+   {
+      for ( std::size_t i = 0; i < N; i++ )
+      {
+         chars[i] = str[i];
+      }
+   }
+};
+
+template <Literal Str, std::size_t... Idx>
+constexpr const auto & EncodedLiteral( std::index_sequence<Idx...> )
+{
+   static_assert( (IsSupportedChar(Str.chars[Idx]) && ...),
+                  "_7seg literal contains a character this variant of the library does not support" );
+   return EncodedChars<Str.chars[Idx]...>;
+}
+
+#endif // ASCII_7SEG_HPP_LITERAL_NTTP
+
+} // namespace detail
+
+inline namespace literals
+{
+
+#if defined(ASCII_7SEG_HPP_LITERAL_NTTP)
+
+/**
+ * @brief Encodes a string literal at compile time, e.g. "Err"_7seg.
+ *
+ * @return Reference to a constexpr std::array with one encoding per character
+ *         (no terminator), which lives in rodata
+ */
+template <detail::Literal Str>
+constexpr const auto & operator""_7seg()
+{
+   return detail::EncodedLiteral<Str>( std::make_index_sequence<sizeof(Str.chars) - 1>{} );
+}
+
+#elif defined(ASCII_7SEG_HPP_LITERAL_GNU)
+
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wgnu-string-literal-operator-template"
+#elif defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#endif
+
+/**
+ * @brief Encodes a string literal at compile time, e.g. "Err"_7seg.
+ *
+ * @return Reference to a constexpr std::array with one encoding per character
+ *         (no terminator), which lives in rodata
+ */
+template <typename CharT, CharT... Chars>
+constexpr const auto & operator""_7seg()
+{
+   static_assert( sizeof(CharT) == 1, "_7seg only applies to narrow string literals" );
+   static_assert( (IsSupportedChar(static_cast<char>(Chars)) && ...),
+                  "_7seg literal contains a character this variant of the library does not support" );
+   return detail::EncodedChars<static_cast<char>(Chars)...>;
+}
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#elif defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // ASCII_7SEG_HPP_LITERAL_NTTP / ASCII_7SEG_HPP_LITERAL_GNU
+
+} // namespace literals
+
+} // namespace ascii7seg
+
+#endif // ASCII_7SEG_HPP_
@@ -0,0 +1,112 @@
+/**
+ * @file ascii7seg_decode.h
+ * @brief Decode 7-segment encodings back to ASCII, e.g. to check what a
+ *        display under test actually shows against the text it was sent.
+ *
+ * Decoding is the inverse of Ascii7Seg_ConvertChar() over the full range of
+ * characters, whatever range variant the library is built as: segments a to g
+ * are packed into 7 bits and looked up in a generated 128-entry table. The
+ * decimal point is ignored, so check segments.dp directly where it matters.
+ *
+ * Several characters share a glyph on 7 segments ('0', 'D' and 'O', '5', 'S'
+ * and 's', '8' and 'B', ...), so an encoding decodes to a canonical character
+ * plus the full set of candidates. The canonical one is a digit if there is
+ * one, then an uppercase letter, then a lowercase letter, then a symbol. To
+ * check readback against expected text, use Ascii7Seg_DecodeMatches(), which
+ * accepts any of the candidates.
+ *
+ * The tables are generated by scripts/gen_decode_table.py from
+ * scripts/ascii7seg_encodings.csv.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_DECODE_H_
+#define ASCII_7SEG_DECODE_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+#define ASCII_7SEG_DECODE_NUM_GLYPHS   128u  //!< Every combination of segments a to g
+
+/* Public Datatypes */
+
+/**
+ * @brief What an encoding decodes to.
+ */
+struct Ascii7Seg_Decoded_S
+{
+   char canonical;            //!< The character it decodes to, or '\0' if no character is encoded like this
+   const char * candidates;   //!< Every character encoded like this, canonical first (empty if none)
+};
+
+/**
+ * @brief Outcome of Ascii7Seg_DecodeSegmentsBulk().
+ */
+struct Ascii7Seg_DecodeResult_S
+{
+   size_t decoded;            //!< Number of encodings that decoded to a character
+   size_t first_undecodable;  //!< Index of the first one that didn't, or ASCII_7SEG_NO_INVALID_IDX
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Decodes one encoding.
+ *
+ * @param[in] encoding  The encoding to decode.
+ *
+ * @return The canonical character and the candidates; '\0' and an empty string
+ *         if nothing is encoded like this or encoding is NULL
+ */
+struct Ascii7Seg_Decoded_S Ascii7Seg_DecodeSegments( const union Ascii7Seg_Encoding_U * encoding );
+
+/**
+ * @brief Decodes num_encodings encodings into their canonical characters.
+ *
+ * Unlike the conversion functions, this doesn't stop at the first encoding it
+ * can't decode: that one gets '\0' and decoding carries on, so a whole readback
+ * can be compared or logged at once.
+ *
+ * @param[in]  encodings      The encodings to decode.
+ * @param[in]  num_encodings  Number of encodings.
+ * @param[out] buf            Where the num_encodings characters go (not null
+ *                            terminated).
+ *
+ * @return How many decoded and where the first one that didn't is (nothing
+ *         decoded and no index if an argument is NULL)
+ */
+struct Ascii7Seg_DecodeResult_S Ascii7Seg_DecodeSegmentsBulk( const union Ascii7Seg_Encoding_U * encodings,
+                                                              size_t num_encodings,
+                                                              char * buf );
+
+/**
+ * @brief Whether an encoding could be showing the given character, i.e.
+ *        whether the character is one of its candidates.
+ *
+ * @param[in] encoding  The encoding read back.
+ * @param[in] expected  The character that should be showing.
+ *
+ * @return true if encoding is how expected is encoded; false otherwise
+ */
+bool Ascii7Seg_DecodeMatches( const union Ascii7Seg_Encoding_U * encoding, char expected );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_DECODE_H_
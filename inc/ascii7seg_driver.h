@@ -0,0 +1,243 @@
+/**
+ * @file ascii7seg_driver.h
+ * @brief Send encodings to common 7-segment driver ICs: MAX7219, TM1637, and
+ *        HT16K33.
+ *
+ * Each driver IC wants the segments of a digit in its own bit order, wrapped in
+ * its own framing. The backends here take a frame of encodings (buf[0] being
+ * digit 0 of the IC) and build the exact bytes the IC expects in one pass, into
+ * a single buffer that can be handed to DMA as is:
+ *
+ *  - MAX7219 (SPI): one 2-byte register/data packet per digit, each of which
+ *    is its own transaction (i.e., latched by LOAD/CS going high).
+ *  - TM1637 (two-wire, I2C-like but without a device address): a data command
+ *    for auto-increment, then the address command followed by every digit in
+ *    one burst, then the display control command with the brightness.
+ *  - HT16K33 (I2C): the RAM address pointer followed by the whole 16-byte
+ *    display RAM, with digit i in byte 2i, in one transaction.
+ *
+ * The bytes go out through a transport: a function that performs one
+ * transaction (chip select, or start to stop condition, around the bytes
+ * given), plus a context pointer for it. Bit timing, bit order on the wire
+ * (the TM1637 is LSB first), and the I2C device address are the transport's
+ * business. Ascii7Seg_MockTransportWrite() is a transport that just records
+ * what it was given, for testing and benchmarking off-target.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_DRIVER_H_
+#define ASCII_7SEG_DRIVER_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+#define ASCII_7SEG_MAX7219_MAX_DIGITS        8u
+#define ASCII_7SEG_MAX7219_MAX_BRIGHTNESS    15u
+#define ASCII_7SEG_MAX7219_PACKET_LEN        2u    //!< Bytes per MAX7219 transaction
+//! Bytes of a MAX7219 frame of num_digits digits
+#define ASCII_7SEG_MAX7219_FRAME_LEN(num_digits)   ( ASCII_7SEG_MAX7219_PACKET_LEN * (num_digits) )
+
+#define ASCII_7SEG_TM1637_MAX_DIGITS         6u
+#define ASCII_7SEG_TM1637_MAX_BRIGHTNESS     7u
+//! Bytes of a TM1637 frame of num_digits digits (3 commands plus the digits)
+#define ASCII_7SEG_TM1637_FRAME_LEN(num_digits)    ( 3u + (num_digits) )
+
+#define ASCII_7SEG_HT16K33_MAX_DIGITS        8u
+#define ASCII_7SEG_HT16K33_MAX_BRIGHTNESS    15u
+//! Bytes of an HT16K33 frame (the RAM address and all 16 bytes of RAM), whatever the number of digits
+#define ASCII_7SEG_HT16K33_FRAME_LEN         17u
+
+/* Public Datatypes */
+
+/**
+ * @brief Performs one transaction with the IC: sends len bytes of data.
+ *
+ * @return true if the bytes were sent
+ */
+typedef bool (*Ascii7Seg_TransportWrite_T)( void * ctx, const uint8_t * data, size_t len );
+
+/**
+ * @brief Where a backend sends its bytes.
+ */
+struct Ascii7Seg_Transport_S
+{
+   Ascii7Seg_TransportWrite_T write;
+   void * ctx;                         //!< Passed to write as is (e.g., the bus handle and device address)
+};
+
+/**
+ * @brief State of a mock transport, which appends the bytes of each transaction
+ *        to a log and the length of each transaction to another.
+ *
+ * Point a transport's ctx at one of these and its write at
+ * Ascii7Seg_MockTransportWrite(), after Ascii7Seg_MockTransportInit().
+ */
+struct Ascii7Seg_MockTransport_S
+{
+   uint8_t * log;          //!< Caller's array for the bytes of every transaction, back to back
+   size_t log_cap;
+   size_t log_len;
+   size_t * txn_lens;      //!< Caller's array for the length of each transaction
+   size_t txn_cap;
+   size_t num_txns;
+   bool fail;              //!< Set to make every write fail (without logging it)
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Builds a MAX7219 frame: for each digit i, the digit register (i + 1)
+ *        and the segments in no-decode mode (DP, A, B, ..., G from MSB to LSB).
+ *
+ * @param[in]  digits      Encodings of digits 0 to num_digits - 1 of the IC.
+ * @param[in]  num_digits  Number of digits (1 to ASCII_7SEG_MAX7219_MAX_DIGITS).
+ * @param[out] buf         Where the frame goes, ASCII_7SEG_MAX7219_PACKET_LEN bytes per transaction.
+ * @param[in]  buf_cap     Number of bytes buf can hold.
+ *
+ * @return Number of bytes written (ASCII_7SEG_MAX7219_FRAME_LEN(num_digits));
+ *         0 if an argument is invalid or buf is too small
+ */
+size_t Ascii7Seg_Max7219BuildFrame( const union Ascii7Seg_Encoding_U * digits,
+                                    size_t num_digits,
+                                    uint8_t * buf,
+                                    size_t buf_cap );
+
+/**
+ * @brief Sets a MAX7219 up for Ascii7Seg_Max7219WriteFrame(): no BCD decoding,
+ *        scanning num_digits digits, the given brightness, display test off,
+ *        and out of shutdown.
+ *
+ * @return true if every command was sent; false if an argument is invalid or
+ *         the transport failed
+ */
+bool Ascii7Seg_Max7219Init( const struct Ascii7Seg_Transport_S * transport,
+                            size_t num_digits,
+                            unsigned int brightness );
+
+/**
+ * @brief Builds a MAX7219 frame and sends it, one transaction per digit.
+ *
+ * @return true if the whole frame was sent; false if an argument is invalid
+ *         or the transport failed
+ */
+bool Ascii7Seg_Max7219WriteFrame( const struct Ascii7Seg_Transport_S * transport,
+                                  const union Ascii7Seg_Encoding_U * digits,
+                                  size_t num_digits );
+
+/**
+ * @brief Builds a TM1637 frame: the data command (write, auto-increment), the
+ *        address command for digit 0 followed by the segments of every digit
+ *        (A, B, ..., G, DP from LSB to MSB), and the display control command
+ *        (display on, at the given brightness).
+ *
+ * The three commands are transactions of 1, 1 + num_digits, and 1 bytes.
+ *
+ * @param[in]  digits      Encodings of digits 0 to num_digits - 1 of the IC.
+ * @param[in]  num_digits  Number of digits (1 to ASCII_7SEG_TM1637_MAX_DIGITS).
+ * @param[in]  brightness  0 to ASCII_7SEG_TM1637_MAX_BRIGHTNESS.
+ * @param[out] buf         Where the frame goes.
+ * @param[in]  buf_cap     Number of bytes buf can hold.
+ *
+ * @return Number of bytes written (ASCII_7SEG_TM1637_FRAME_LEN(num_digits));
+ *         0 if an argument is invalid or buf is too small
+ */
+size_t Ascii7Seg_Tm1637BuildFrame( const union Ascii7Seg_Encoding_U * digits,
+                                   size_t num_digits,
+                                   unsigned int brightness,
+                                   uint8_t * buf,
+                                   size_t buf_cap );
+
+/**
+ * @brief Builds a TM1637 frame and sends it, as its three transactions. The
+ *        TM1637 needs no other setup.
+ *
+ * @return true if the whole frame was sent; false if an argument is invalid
+ *         or the transport failed
+ */
+bool Ascii7Seg_Tm1637WriteFrame( const struct Ascii7Seg_Transport_S * transport,
+                                 const union Ascii7Seg_Encoding_U * digits,
+                                 size_t num_digits,
+                                 unsigned int brightness );
+
+/**
+ * @brief Builds an HT16K33 frame: RAM address 0, then the 16 bytes of display
+ *        RAM, with the segments of digit i (A, B, ..., G, DP from LSB to MSB)
+ *        in byte 2i and every other byte 0.
+ *
+ * The whole frame is one transaction, and it clears the digits past num_digits.
+ *
+ * @param[in]  digits      Encodings of digits 0 to num_digits - 1 of the IC.
+ * @param[in]  num_digits  Number of digits (1 to ASCII_7SEG_HT16K33_MAX_DIGITS).
+ * @param[out] buf         Where the frame goes.
+ * @param[in]  buf_cap     Number of bytes buf can hold.
+ *
+ * @return Number of bytes written (ASCII_7SEG_HT16K33_FRAME_LEN); 0 if an
+ *         argument is invalid or buf is too small
+ */
+size_t Ascii7Seg_Ht16k33BuildFrame( const union Ascii7Seg_Encoding_U * digits,
+                                    size_t num_digits,
+                                    uint8_t * buf,
+                                    size_t buf_cap );
+
+/**
+ * @brief Sets an HT16K33 up for Ascii7Seg_Ht16k33WriteFrame(): oscillator on,
+ *        the given brightness, and display on without blinking.
+ *
+ * @return true if every command was sent; false if an argument is invalid or
+ *         the transport failed
+ */
+bool Ascii7Seg_Ht16k33Init( const struct Ascii7Seg_Transport_S * transport,
+                            unsigned int brightness );
+
+/**
+ * @brief Builds an HT16K33 frame and sends it, as one transaction.
+ *
+ * @return true if the frame was sent; false if an argument is invalid or the
+ *         transport failed
+ */
+bool Ascii7Seg_Ht16k33WriteFrame( const struct Ascii7Seg_Transport_S * transport,
+                                  const union Ascii7Seg_Encoding_U * digits,
+                                  size_t num_digits );
+
+/**
+ * @brief Sets up a mock transport that logs into the given arrays, and points
+ *        transport at it.
+ *
+ * @return true if the mock was set up; false if an argument is invalid
+ */
+bool Ascii7Seg_MockTransportInit( struct Ascii7Seg_MockTransport_S * mock,
+                                  uint8_t * log,
+                                  size_t log_cap,
+                                  size_t * txn_lens,
+                                  size_t txn_cap,
+                                  struct Ascii7Seg_Transport_S * transport );
+
+/**
+ * @brief Ascii7Seg_TransportWrite_T of the mock transport. ctx is its
+ *        Ascii7Seg_MockTransport_S.
+ *
+ * @return true if the transaction was logged; false if the mock is set to
+ *         fail or either of its logs is full
+ */
+bool Ascii7Seg_MockTransportWrite( void * ctx, const uint8_t * data, size_t len );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_DRIVER_H_
@@ -0,0 +1,207 @@
+/**
+ * @file ascii7seg_encoder.h
+ * @brief Pick the range and strategy of the encoding at runtime, through an
+ *        encoder handle.
+ *
+ * The range (ASCII_7SEG_NUMS_ONLY, ASCII_7SEG_NUMS_AND_ERROR_ONLY or the full
+ * range) and the strategy (lookup table or ASCII_7SEG_DONT_USE_LOOKUP_TABLE) of
+ * the core API are fixed when the library is compiled. An encoder instead
+ * picks them when it is set up, so one process can hold several:
+ *
+ *    struct Ascii7Seg_Encoder_S digits;
+ *    struct Ascii7Seg_Encoder_S text;
+ *    (void)Ascii7Seg_EncoderInit( &digits, ASCII_7SEG_RANGE_NUMS_ONLY, ASCII_7SEG_STRATEGY_LOOKUP_TABLE );
+ *    (void)Ascii7Seg_EncoderInit( &text, ASCII_7SEG_RANGE_FULL, ASCII_7SEG_STRATEGY_LOOKUP_TABLE );
+ *    n = Ascii7Seg_EncoderConvertWord( &text, msg, strlen(msg), buf );
+ *
+ * Each range/strategy pair has a kernel: the core API compiled for it, with
+ * its functions renamed. Init looks the kernel up once, so every conversion is
+ * one indirect call to it. Within the full range, lookup table kernel,
+ * Ascii7Seg_ConvertWord() and Ascii7Seg_ConvertBytes() still run the best SIMD
+ * path the CPU supports, which is picked once at load time.
+ *
+ * Every kernel is only in the library if it was built with
+ * ASCII_7SEG_RUNTIME_DISPATCH (`make RUNTIME=1 ...`). Otherwise, the only one
+ * is the configured range and strategy, i.e. the core API itself, and
+ * Ascii7Seg_EncoderInit() refuses the others. Either way, the core API is
+ * called directly, with no dispatch.
+ *
+ * The layout of Ascii7Seg_Encoding_U (ASCII_7SEG_BIT_PACK,
+ * ASCII_7SEG_PAD_TO_8_BYTES) is a type, not a kernel, so it is still chosen at
+ * compile time and shared by every kernel.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_ENCODER_H_
+#define ASCII_7SEG_ENCODER_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Datatypes */
+
+/**
+ * @brief Range of characters an encoder supports.
+ */
+enum Ascii7Seg_Range_E
+{
+   ASCII_7SEG_RANGE_NUMS_ONLY,            //!< As with ASCII_7SEG_NUMS_ONLY
+   ASCII_7SEG_RANGE_NUMS_AND_ERROR_ONLY,  //!< As with ASCII_7SEG_NUMS_AND_ERROR_ONLY
+   ASCII_7SEG_RANGE_FULL,                 //!< The Default Encodable Range
+
+   ASCII_7SEG_NUM_OF_RANGES
+};
+
+/**
+ * @brief How an encoder gets from a character to its encoding.
+ */
+enum Ascii7Seg_Strategy_E
+{
+   ASCII_7SEG_STRATEGY_LOOKUP_TABLE,      //!< The default
+   ASCII_7SEG_STRATEGY_COMPUTED,          //!< As with ASCII_7SEG_DONT_USE_LOOKUP_TABLE
+
+   ASCII_7SEG_NUM_OF_STRATEGIES
+};
+
+/**
+ * @brief The core API of one range and strategy.
+ */
+struct Ascii7Seg_Kernel_S
+{
+   bool (*convert_char)( char ascii_char, union Ascii7Seg_Encoding_U * buf );
+   size_t (*convert_word)( const char * str, size_t str_len, union Ascii7Seg_Encoding_U * buf );
+   struct Ascii7Seg_Result_S (*convert_bytes)( const char * src, size_t src_len,
+                                               union Ascii7Seg_Encoding_U * buf, size_t buf_cap );
+   bool (*is_supported_char)( char ascii_char );
+#ifdef ASCII_7SEG_HAS_DP
+   struct Ascii7Seg_WordResult_S (*convert_word_ex)( const char * str, size_t str_len,
+                                                     union Ascii7Seg_Encoding_U * buf, size_t buf_cap,
+                                                     unsigned int options );
+#endif
+};
+
+/**
+ * @brief An encoder. Allocate it wherever suits (static, stack, etc.), set it
+ *        up with Ascii7Seg_EncoderInit(), and only access it through the
+ *        Ascii7Seg_Encoder...() functions.
+ */
+struct Ascii7Seg_Encoder_S
+{
+   const struct Ascii7Seg_Kernel_S * kernel; //!< The kernel of range and strategy
+   enum Ascii7Seg_Range_E range;
+   enum Ascii7Seg_Strategy_E strategy;
+};
+
+/* Public Macro Definitions */
+
+//! The range the core API was compiled for, which every build has a kernel of
+#if defined(ASCII_7SEG_NUMS_ONLY)
+#define ASCII_7SEG_CONFIGURED_RANGE      ASCII_7SEG_RANGE_NUMS_ONLY
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+#define ASCII_7SEG_CONFIGURED_RANGE      ASCII_7SEG_RANGE_NUMS_AND_ERROR_ONLY
+#else
+#define ASCII_7SEG_CONFIGURED_RANGE      ASCII_7SEG_RANGE_FULL
+#endif
+
+//! The strategy the core API was compiled for
+#ifdef ASCII_7SEG_DONT_USE_LOOKUP_TABLE
+#define ASCII_7SEG_CONFIGURED_STRATEGY   ASCII_7SEG_STRATEGY_COMPUTED
+#else
+#define ASCII_7SEG_CONFIGURED_STRATEGY   ASCII_7SEG_STRATEGY_LOOKUP_TABLE
+#endif
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Sets up an encoder with the kernel of the given range and strategy.
+ *
+ * @param[out] encoder   The encoder to set up.
+ * @param[in]  range     Range of characters to support.
+ * @param[in]  strategy  Lookup table or computed.
+ *
+ * @return true if the encoder was set up; false if an argument is invalid or
+ *         the library has no kernel of this range and strategy (see
+ *         ASCII_7SEG_RUNTIME_DISPATCH)
+ */
+bool Ascii7Seg_EncoderInit( struct Ascii7Seg_Encoder_S * encoder,
+                            enum Ascii7Seg_Range_E range,
+                            enum Ascii7Seg_Strategy_E strategy );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertChar(), in the encoder's range and strategy.
+ *
+ * @return true if the conversion was successful; false otherwise (or if
+ *         encoder is NULL)
+ */
+bool Ascii7Seg_EncoderConvertChar( const struct Ascii7Seg_Encoder_S * encoder,
+                                   char ascii_char,
+                                   union Ascii7Seg_Encoding_U * buf );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertWord(), in the encoder's range and strategy.
+ *
+ * @return Number of characters converted (0 if encoder is NULL)
+ */
+size_t Ascii7Seg_EncoderConvertWord( const struct Ascii7Seg_Encoder_S * encoder,
+                                     const char * str,
+                                     size_t str_len,
+                                     union Ascii7Seg_Encoding_U * buf );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertBytes(), in the encoder's range and strategy.
+ *
+ * @return The number of characters converted and, if the conversion stopped
+ *         on an unsupported character, where it is and what it was (nothing
+ *         converted and no index if encoder is NULL)
+ */
+struct Ascii7Seg_Result_S Ascii7Seg_EncoderConvertBytes( const struct Ascii7Seg_Encoder_S * encoder,
+                                                         const char * src,
+                                                         size_t src_len,
+                                                         union Ascii7Seg_Encoding_U * buf,
+                                                         size_t buf_cap );
+
+/**
+ * @brief Same as Ascii7Seg_IsSupportedChar(), in the encoder's range.
+ *
+ * @return true if the character is supported; false otherwise (or if encoder
+ *         is NULL)
+ */
+bool Ascii7Seg_EncoderIsSupportedChar( const struct Ascii7Seg_Encoder_S * encoder,
+                                       char ascii_char );
+
+#ifdef ASCII_7SEG_HAS_DP
+
+/**
+ * @brief Same as Ascii7Seg_ConvertWordEx(), in the encoder's range and
+ *        strategy.
+ *
+ * @return How many characters were consumed and how many encodings were
+ *         produced (both 0 if encoder is NULL)
+ */
+struct Ascii7Seg_WordResult_S Ascii7Seg_EncoderConvertWordEx( const struct Ascii7Seg_Encoder_S * encoder,
+                                                              const char * str,
+                                                              size_t str_len,
+                                                              union Ascii7Seg_Encoding_U * buf,
+                                                              size_t buf_cap,
+                                                              unsigned int options );
+
+#endif // ASCII_7SEG_HAS_DP
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_ENCODER_H_
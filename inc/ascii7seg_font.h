@@ -0,0 +1,147 @@
+/**
+ * @file ascii7seg_font.h
+ * @brief Encode for 7-, 14- and 16-segment displays through one engine, with
+ *        the segment width as a parameter.
+ *
+ * Ascii7Seg_Encoding_U and the tables behind Ascii7Seg_ConvertChar() are
+ * built for exactly 7 segments (plus the decimal point), which is what lets
+ * them pack into a byte and be looked up 16-64 at a time. Alphanumeric
+ * displays have 14 or 16 segments, so they need another font and wider cells.
+ *
+ * A font here is a table of 128 uint16_t glyphs, one per ASCII character
+ * (bit s = segment s, 0 for unsupported characters), plus its width, or, for
+ * Ascii7Seg_Font7Seg, the 7-segment core of ascii7seg.h itself. The
+ * functions below take the font as a parameter and follow the semantics of
+ * their 7-segment counterparts in ascii7seg.h, results included, so code
+ * written against them works for any width. Cells are uint16_t. To track which
+ * cells changed, use the cell framebuffer in ascii7seg_framebuffer.h.
+ *
+ * Three fonts are built in:
+ *
+ *    Ascii7Seg_Font7Seg:   a b c d e f g (bits 0-6), DP in bit 7
+ *    Ascii7Seg_Font14Seg:  A B C D E F G1 G2 H J K L M N (bits 0-13), DP in bit 14
+ *    Ascii7Seg_Font16Seg:  A1 A2 B C D1 D2 E F G1 G2 H J K L M N (bits 0-15), no DP
+ *
+ * where H, J and K are the upper diagonal, vertical and diagonal (left to
+ * right), and N, M and L the lower ones, e.g. for 14 segments:
+ *
+ *     ----A----
+ *    |\   |   /|
+ *    F H  J  K B
+ *    |  \ | /  |
+ *     -G1- -G2-
+ *    |  / | \  |
+ *    E N  M  L C
+ *    |/   |   \|
+ *     ----D----  DP
+ *
+ * Ascii7Seg_Font7Seg converts through Ascii7Seg_ConvertChar() and
+ * Ascii7Seg_ConvertBytes(), so it has the same encodings and range variant as
+ * the rest of the library, and its bulk conversions use the same SIMD/SWAR
+ * kernels (with their over-read of the input) before being widened to uint16_t
+ * cells. The 14- and 16-segment fonts have the digits, the letters (lowercase
+ * looks like uppercase), and [ ] ( ) _ - | = > < + * / and backslash, and are
+ * converted with one table load per character. The vector kernels are not
+ * generalized to 16-bit glyphs. The 14- and 16-segment glyphs are generated by
+ * scripts/gen_font_tables.py.
+ *
+ * The 7-segment API in ascii7seg.h is the specialization of this engine for 7
+ * segments in a byte, and is unaffected by it.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_FONT_H_
+#define ASCII_7SEG_FONT_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+#define ASCII_7SEG_FONT_NUM_CHARS   128u  //!< Every ASCII character has a glyph (0 if unsupported)
+
+/* Public Datatypes */
+
+/**
+ * @brief A font for displays of a given segment width.
+ */
+struct Ascii7Seg_Font_S
+{
+   const uint16_t * glyphs;   //!< ASCII_7SEG_FONT_NUM_CHARS glyphs, bit s = segment s, 0 if unsupported; NULL for the 7-segment core
+   uint16_t dp_mask;          //!< Bit of the decimal point, or 0 if there is none
+   uint8_t num_segments;      //!< 7, 14 or 16, not counting the decimal point
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+//! The built-in fonts
+extern const struct Ascii7Seg_Font_S Ascii7Seg_Font7Seg;
+extern const struct Ascii7Seg_Font_S Ascii7Seg_Font14Seg;
+extern const struct Ascii7Seg_Font_S Ascii7Seg_Font16Seg;
+
+/**
+ * @brief Same as Ascii7Seg_ConvertChar(), in the given font.
+ *
+ * @param[in]  font        The font.
+ * @param[in]  ascii_char  The ASCII character to convert.
+ * @param[out] buf         Where the glyph goes (0 if the character is not
+ *                         supported).
+ *
+ * @return true if the conversion was successful; false otherwise
+ */
+bool Ascii7Seg_FontConvertChar( const struct Ascii7Seg_Font_S * font,
+                                char ascii_char,
+                                uint16_t * buf );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertWord(), in the given font: stops at the
+ *        first unsupported character, the null terminator, or str_len
+ *        characters, whichever comes first.
+ *
+ * @return Number of characters converted (0 if an argument is NULL)
+ */
+size_t Ascii7Seg_FontConvertWord( const struct Ascii7Seg_Font_S * font,
+                                  const char * str,
+                                  size_t str_len,
+                                  uint16_t * buf );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertBytes(), in the given font: converts up to
+ *        src_len characters, stopping at the first unsupported one (the null
+ *        character included) or after buf_cap of them.
+ *
+ * @note buf is never written past the number of characters converted.
+ *
+ * @return The number of characters converted and, if the conversion stopped
+ *         on an unsupported character, where it is and what it was
+ */
+struct Ascii7Seg_Result_S Ascii7Seg_FontConvertBytes( const struct Ascii7Seg_Font_S * font,
+                                                      const char * src,
+                                                      size_t src_len,
+                                                      uint16_t * buf,
+                                                      size_t buf_cap );
+
+/**
+ * @brief Same as Ascii7Seg_IsSupportedChar(), in the given font.
+ */
+bool Ascii7Seg_FontIsSupportedChar( const struct Ascii7Seg_Font_S * font,
+                                    char ascii_char );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_FONT_H_
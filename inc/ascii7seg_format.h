@@ -0,0 +1,188 @@
+/**
+ * @file ascii7seg_format.h
+ * @brief Format numbers straight into 7-segment encodings.
+ *
+ * Showing a number with the core API takes two passes: snprintf() into a char
+ * buffer, then Ascii7Seg_ConvertWord() over it. The functions here go from the
+ * value to the encodings in one pass, two digits at a time, and without any
+ * division (which many MCUs do in software), so they work the same in every
+ * range variant of the library.
+ *
+ * The number is right-aligned in a field of width digits (e.g., the digits of
+ * the display). The digits to the left of it are blank, or '0' with
+ * ASCII_7SEG_FMT_ZERO_PAD. A negative number gets a minus sign (segment g only)
+ * just left of its most significant digit, or in the leftmost digit of the
+ * field with ASCII_7SEG_FMT_ZERO_PAD.
+ *
+ * Where Ascii7Seg_Encoding_U has a decimal point (ASCII_7SEG_HAS_DP), there
+ * are also fixed-point and float formatters, which light the decimal point of
+ * the ones digit instead of spending a digit on it, e.g. "12.5" in 3 digits.
+ *
+ * Ascii7Seg_ConvertHex() is the odd one out: it dumps a run of bytes as hex
+ * digits, two per byte, for register and memory views, and is meant to keep up
+ * with memory bandwidth on long runs.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_FORMAT_H_
+#define ASCII_7SEG_FORMAT_H_
+
+/* File Inclusions */
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+// Flags for the functions in this module, OR'd together
+#define ASCII_7SEG_FMT_NONE       0u
+#define ASCII_7SEG_FMT_ZERO_PAD   (1u << 0) //!< Fill the field with leading zeros instead of blanks
+
+// Flags for Ascii7Seg_ConvertHex() only. The default hex digits are A b C d E F,
+// since a capital B and D are indistinguishable from 8 and 0 on 7 segments.
+
+/**
+ * Hex digits A B C D E F.
+ *
+ * @warning B is drawn like 8 and D like 0, so a dump in these digits can't be
+ *          read back unambiguously (e.g. "8D" and "B0" look the same). Only
+ *          use it where the reader already knows which digits to expect.
+ */
+#define ASCII_7SEG_FMT_HEX_UPPER     (1u << 1)
+#define ASCII_7SEG_FMT_HEX_LOWER     (1u << 2) //!< Hex digits a b c d e f
+#define ASCII_7SEG_FMT_HEX_REVERSE   (1u << 3) //!< Last byte first, e.g. a little-endian word as a number
+
+//! Most digits after the decimal point that Ascii7Seg_ConvertFixed()/Float() will format
+#define ASCII_7SEG_FMT_MAX_FRAC_DIGITS   9u
+
+/* Public Datatypes */
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Formats an unsigned 32-bit value into width encodings.
+ *
+ * @note buf is only written if the value fits in width digits.
+ *
+ * @param[in]  value  The value to format.
+ * @param[out] buf    Where the width encodings go, most significant digit first.
+ * @param[in]  width  Number of digits in the field.
+ * @param[in]  flags  ASCII_7SEG_FMT_x flags.
+ *
+ * @return width if the value was formatted; 0 if it doesn't fit in width
+ *         digits or buf is NULL
+ */
+size_t Ascii7Seg_ConvertU32( uint32_t value,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t width,
+                             unsigned int flags );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertU32(), for a signed 32-bit value. The minus
+ *        sign of a negative value takes up a digit of the field.
+ */
+size_t Ascii7Seg_ConvertI32( int32_t value,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t width,
+                             unsigned int flags );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertU32(), for an unsigned 64-bit value.
+ */
+size_t Ascii7Seg_ConvertU64( uint64_t value,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t width,
+                             unsigned int flags );
+
+#ifdef ASCII_7SEG_HAS_DP
+
+/**
+ * @brief Formats a fixed-point value, i.e. value / 10^frac_digits, into width
+ *        encodings, with the decimal point on the ones digit.
+ *
+ * There is always a digit before the decimal point, so e.g. 5 with 2
+ * frac_digits is "0.05", in 3 digits.
+ *
+ * @note buf is only written if the value fits in width digits.
+ *
+ * @param[in]  value        The value, in units of 10^-frac_digits.
+ * @param[in]  frac_digits  Digits after the decimal point (0 to ASCII_7SEG_FMT_MAX_FRAC_DIGITS).
+ * @param[out] buf          Where the width encodings go, most significant digit first.
+ * @param[in]  width        Number of digits in the field.
+ * @param[in]  flags        ASCII_7SEG_FMT_x flags.
+ *
+ * @return width if the value was formatted; 0 if it doesn't fit in width
+ *         digits, frac_digits is too big, or buf is NULL
+ */
+size_t Ascii7Seg_ConvertFixed( int32_t value,
+                               unsigned int frac_digits,
+                               union Ascii7Seg_Encoding_U * buf,
+                               size_t width,
+                               unsigned int flags );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertFixed(), for a float rounded to frac_digits
+ *        digits after the decimal point.
+ *
+ * Rounding is exact and ties go to even, the same as printf("%.*f"), except
+ * that a value that rounds to 0 has no minus sign. No floating-point
+ * operations are used.
+ *
+ * @return width if the value was formatted; 0 if it doesn't fit in width
+ *         digits, is infinite or NaN, frac_digits is too big, or buf is NULL
+ */
+size_t Ascii7Seg_ConvertFloat( float value,
+                               unsigned int frac_digits,
+                               union Ascii7Seg_Encoding_U * buf,
+                               size_t width,
+                               unsigned int flags );
+
+#endif // ASCII_7SEG_HAS_DP
+
+/**
+ * @brief Dumps num_bytes bytes as hex digits, two encodings per byte, high
+ *        nibble first.
+ *
+ * Bytes are shown in memory order, or from the last one to the first with
+ * ASCII_7SEG_FMT_HEX_REVERSE, which is how to show a multi-byte value on a
+ * little-endian CPU as the number it holds, e.g.:
+ * @code
+ * uint32_t reg = 0x1234ABCDu;
+ * union Ascii7Seg_Encoding_U digits[8];
+ * (void)Ascii7Seg_ConvertHex( &reg, sizeof(reg), digits, 8, ASCII_7SEG_FMT_HEX_REVERSE ); // "1234AbCd"
+ * @endcode
+ *
+ * The hex digits use their own table, so they are the same in every range
+ * variant of the library, even where ASCII letters aren't supported.
+ *
+ * @param[in]  bytes      The bytes to dump.
+ * @param[in]  num_bytes  Number of bytes to dump.
+ * @param[out] buf        Where the encodings go.
+ * @param[in]  buf_cap    Number of encodings buf can hold.
+ * @param[in]  flags      ASCII_7SEG_FMT_HEX_x flags (ASCII_7SEG_FMT_ZERO_PAD has no effect).
+ *
+ * @return Number of encodings written, which is 2 * num_bytes unless buf_cap
+ *         cuts it short to whole bytes; 0 if bytes or buf is NULL, or both
+ *         ASCII_7SEG_FMT_HEX_UPPER and ASCII_7SEG_FMT_HEX_LOWER are set
+ */
+size_t Ascii7Seg_ConvertHex( const void * bytes,
+                             size_t num_bytes,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t buf_cap,
+                             unsigned int flags );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_FORMAT_H_
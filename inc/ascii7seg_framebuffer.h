@@ -0,0 +1,168 @@
+/**
+ * @file ascii7seg_framebuffer.h
+ * @brief Send a display only the digits that changed since the last frame.
+ *
+ * On displays behind a bus (SPI, I2C, etc.), rewriting every digit for each
+ * frame wastes the bus on digits that didn't change. A framebuffer keeps a
+ * shadow copy of what the display shows, and each update compares the new
+ * frame against it and lists the changed digits as ranges, for the transport
+ * to send as burst writes:
+ *
+ *    union Ascii7Seg_Encoding_U shadow[8], frame[8];
+ *    struct Ascii7Seg_Framebuffer_S fb;
+ *    struct Ascii7Seg_DirtyRange_S ranges[4];
+ *    (void)Ascii7Seg_FramebufferInit( &fb, shadow, 8, 1 );
+ *
+ *    ... fill frame ...
+ *    size_t n = Ascii7Seg_FramebufferUpdate( &fb, frame, ranges, 4 );
+ *    for ( size_t r = 0; r < n; r++ )
+ *    {
+ *       bus_write( ranges[r].first, &frame[ranges[r].first], ranges[r].len );
+ *    }
+ *
+ * Dirty digits next to each other always share a range. Runs of dirty digits
+ * separated by at most merge_gap clean digits share one too, since resending a
+ * clean digit or two is usually cheaper than starting another write.
+ *
+ * The cell framebuffer (Ascii7Seg_CellFramebuffer...()) does the same for the
+ * uint16_t cells of ascii7seg_font.h, i.e. for 14- and 16-segment displays.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_FRAMEBUFFER_H_
+#define ASCII_7SEG_FRAMEBUFFER_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+/* Public Datatypes */
+
+/**
+ * @brief A run of digits to send: frame[first] to frame[first + len - 1].
+ */
+struct Ascii7Seg_DirtyRange_S
+{
+   size_t first;  //!< Index of the first digit of the run
+   size_t len;    //!< Number of digits in the run (at least 1)
+};
+
+/**
+ * @brief State of a framebuffer. Allocate it wherever suits (static, stack,
+ *        etc.), set it up with Ascii7Seg_FramebufferInit(), and only access it
+ *        through the Ascii7Seg_Framebuffer...() functions.
+ */
+struct Ascii7Seg_Framebuffer_S
+{
+   union Ascii7Seg_Encoding_U * shadow;   //!< Caller's array of what the display shows
+   size_t num_digits;                     //!< Number of digits on the display
+   size_t merge_gap;                      //!< Most clean digits between two dirty runs that share a range
+   bool all_dirty;                        //!< The shadow is out of date, so the next update sends everything
+};
+
+/**
+ * @brief State of a cell framebuffer, the Ascii7Seg_Framebuffer_S of uint16_t
+ *        cells. Likewise, only access it through the
+ *        Ascii7Seg_CellFramebuffer...() functions.
+ */
+struct Ascii7Seg_CellFramebuffer_S
+{
+   uint16_t * shadow;                     //!< Caller's array of what the display shows
+   size_t num_cells;                      //!< Number of cells on the display
+   size_t merge_gap;                      //!< Most clean cells between two dirty runs that share a range
+   bool all_dirty;                        //!< The shadow is out of date, so the next update sends everything
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Sets up a framebuffer for a display of num_digits digits.
+ *
+ * What the display shows is unknown until the first update, so that update
+ * reports every digit as dirty.
+ *
+ * @param[out] fb          The framebuffer to set up.
+ * @param[in]  shadow      Array of num_digits encodings for the framebuffer to
+ *                         keep its shadow copy in. It must outlive fb.
+ * @param[in]  num_digits  Number of digits on the display (at least 1).
+ * @param[in]  merge_gap   Most clean digits between two dirty runs for them to
+ *                         be merged into one range (0 to only merge touching
+ *                         digits).
+ *
+ * @return true if the framebuffer was set up; false if an argument is invalid
+ */
+bool Ascii7Seg_FramebufferInit( struct Ascii7Seg_Framebuffer_S * fb,
+                                union Ascii7Seg_Encoding_U * shadow,
+                                size_t num_digits,
+                                size_t merge_gap );
+
+/**
+ * @brief Lists the digits of frame that differ from what the display shows,
+ *        and takes frame as what it shows from now on.
+ *
+ * Ranges are in order of their first digit and don't overlap. If there are
+ * more than max_ranges of them, the last one is stretched to the end of the
+ * last dirty digit, so the ranges always cover every change.
+ *
+ * @note The shadow is updated as if the ranges were sent. If a transfer fails,
+ *       call Ascii7Seg_FramebufferInvalidate().
+ *
+ * @param[in,out] fb          The framebuffer.
+ * @param[in]     frame       The new frame, fb's num_digits encodings.
+ * @param[out]    ranges      Where the dirty ranges go.
+ * @param[in]     max_ranges  Number of ranges that ranges can hold (at least 1).
+ *
+ * @return Number of ranges written; 0 if nothing changed or an argument is
+ *         invalid (in which case fb is left as is)
+ */
+size_t Ascii7Seg_FramebufferUpdate( struct Ascii7Seg_Framebuffer_S * fb,
+                                    const union Ascii7Seg_Encoding_U * frame,
+                                    struct Ascii7Seg_DirtyRange_S * ranges,
+                                    size_t max_ranges );
+
+/**
+ * @brief Forgets what the display shows (e.g., after it was reset or a write
+ *        to it failed), so that the next update sends every digit.
+ */
+void Ascii7Seg_FramebufferInvalidate( struct Ascii7Seg_Framebuffer_S * fb );
+
+/**
+ * @brief Same as Ascii7Seg_FramebufferInit(), for uint16_t cells.
+ */
+bool Ascii7Seg_CellFramebufferInit( struct Ascii7Seg_CellFramebuffer_S * fb,
+                                    uint16_t * shadow,
+                                    size_t num_cells,
+                                    size_t merge_gap );
+
+/**
+ * @brief Same as Ascii7Seg_FramebufferUpdate(), for uint16_t cells.
+ */
+size_t Ascii7Seg_CellFramebufferUpdate( struct Ascii7Seg_CellFramebuffer_S * fb,
+                                        const uint16_t * frame,
+                                        struct Ascii7Seg_DirtyRange_S * ranges,
+                                        size_t max_ranges );
+
+/**
+ * @brief Same as Ascii7Seg_FramebufferInvalidate(), for uint16_t cells.
+ */
+void Ascii7Seg_CellFramebufferInvalidate( struct Ascii7Seg_CellFramebuffer_S * fb );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_FRAMEBUFFER_H_
@@ -0,0 +1,170 @@
+/**
+ * @file ascii7seg_marquee.h
+ * @brief Scroll a message that is longer than the display across it.
+ *
+ * Scrolling with the core API means converting a shifted substring of the
+ * message every frame. A marquee instead encodes the message once, into a ring
+ * that the caller allocates, and each frame is then just a window into that
+ * ring: a pointer to the first digit, plus a second span from the start of the
+ * ring when the window wraps around its end. Nothing is converted or copied
+ * per frame, so a frame costs the same no matter how long the message is:
+ *
+ *    union Ascii7Seg_Encoding_U ring[64];
+ *    struct Ascii7Seg_Marquee_S marquee;
+ *    const struct Ascii7Seg_MarqueeConfig_S cfg =
+ *       { .width = 4, .mode = ASCII_7SEG_MARQUEE_LOOP, .step = 1, .pause_frames = 10 };
+ *    (void)Ascii7Seg_MarqueeInit( &marquee, &cfg, ring, 64, msg, strlen(msg) );
+ *
+ *    for ( ;; )  // once per scroll tick
+ *    {
+ *       struct Ascii7Seg_MarqueeFrame_S frame = Ascii7Seg_MarqueeFrame( &marquee );
+ *       show( frame.head, frame.head_len );                // leftmost digits
+ *       show_next( frame.wrap, frame.wrap_len );           // the rest, if any
+ *       Ascii7Seg_MarqueeAdvance( &marquee );
+ *    }
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_MARQUEE_H_
+#define ASCII_7SEG_MARQUEE_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+/* Public Datatypes */
+
+/**
+ * @brief How the message moves across the display.
+ */
+enum Ascii7Seg_MarqueeMode_E
+{
+   /**
+    * Right to left, over and over. The message is followed by a display's
+    * worth of blanks, so it scrolls all the way off before coming back in from
+    * the right. The ends are where the message is flush left, at the start.
+    */
+   ASCII_7SEG_MARQUEE_LOOP,
+
+   /**
+    * Back and forth between the message flush left and flush right, never
+    * showing blanks past its ends. A message that fits the display doesn't move.
+    */
+   ASCII_7SEG_MARQUEE_BOUNCE,
+
+   ASCII_7SEG_MARQUEE_NUM_OF_MODES
+};
+
+/**
+ * @brief How a marquee scrolls.
+ */
+struct Ascii7Seg_MarqueeConfig_S
+{
+   size_t width;           //!< Number of digits on the display (at least 1)
+   enum Ascii7Seg_MarqueeMode_E mode;
+   size_t step;            //!< Digits moved per frame (at least 1)
+   size_t pause_frames;    //!< Extra frames to hold the window at each end
+};
+
+/**
+ * @brief A frame of a marquee: width encodings, head_len from head, then
+ *        wrap_len from wrap. Both point into the marquee's ring.
+ */
+struct Ascii7Seg_MarqueeFrame_S
+{
+   const union Ascii7Seg_Encoding_U * head;  //!< Leftmost digits of the frame
+   size_t head_len;
+   const union Ascii7Seg_Encoding_U * wrap;  //!< The rest, from the start of the ring (NULL if there is none)
+   size_t wrap_len;
+};
+
+/**
+ * @brief State of a marquee. Allocate it wherever suits (static, stack, etc.),
+ *        set it up with Ascii7Seg_MarqueeInit(), and only access it through the
+ *        Ascii7Seg_Marquee...() functions.
+ */
+struct Ascii7Seg_Marquee_S
+{
+   const union Ascii7Seg_Encoding_U * ring;  //!< Caller's ring, holding the encoded message and its padding
+   size_t ring_len;                          //!< Encodings in use in ring
+   struct Ascii7Seg_MarqueeConfig_S cfg;
+   size_t pos;                               //!< Index in ring of the leftmost digit of the frame
+   size_t pause_left;                        //!< Frames left to hold the window where it is
+   bool backwards;                           //!< ASCII_7SEG_MARQUEE_BOUNCE is heading back to the start
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Encodes a message into the given ring and sets up a marquee to
+ *        scroll it, starting with the message flush left (and holding there
+ *        for cfg->pause_frames).
+ *
+ * Unsupported characters are encoded as blanks. Under ASCII_7SEG_MARQUEE_LOOP
+ * the ring needs room for text_len + cfg->width encodings, and under
+ * ASCII_7SEG_MARQUEE_BOUNCE for the larger of text_len and cfg->width.
+ *
+ * @param[out] marquee   The marquee to set up.
+ * @param[in]  cfg       How to scroll (copied).
+ * @param[in]  ring      Array of ring_cap encodings that the marquee will use.
+ *                       It must outlive the marquee.
+ * @param[in]  ring_cap  Number of encodings ring can hold.
+ * @param[in]  text      The message (need not be null terminated).
+ * @param[in]  text_len  Number of characters in text.
+ *
+ * @return true if the marquee was set up; false if an argument is invalid or
+ *         ring is too small
+ */
+bool Ascii7Seg_MarqueeInit( struct Ascii7Seg_Marquee_S * marquee,
+                            const struct Ascii7Seg_MarqueeConfig_S * cfg,
+                            union Ascii7Seg_Encoding_U * ring,
+                            size_t ring_cap,
+                            const char * text,
+                            size_t text_len );
+
+/**
+ * @brief The current frame of the marquee.
+ *
+ * @param[in] marquee  The marquee.
+ *
+ * @return The frame (all NULL/0 if marquee is NULL)
+ */
+struct Ascii7Seg_MarqueeFrame_S Ascii7Seg_MarqueeFrame( const struct Ascii7Seg_Marquee_S * marquee );
+
+/**
+ * @brief Moves the marquee on to its next frame: cfg.step digits along, or
+ *        not at all while it is pausing at an end.
+ *
+ * Under ASCII_7SEG_MARQUEE_LOOP, a step that would go past the end of the ring
+ * lands on its start instead, so that every lap pauses with the message flush
+ * left whatever the step. Under ASCII_7SEG_MARQUEE_BOUNCE, a step that would
+ * overshoot an end stops at it.
+ *
+ * @param[in,out] marquee  The marquee.
+ */
+void Ascii7Seg_MarqueeAdvance( struct Ascii7Seg_Marquee_S * marquee );
+
+/**
+ * @brief Goes back to the first frame, as right after Ascii7Seg_MarqueeInit().
+ */
+void Ascii7Seg_MarqueeRestart( struct Ascii7Seg_Marquee_S * marquee );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_MARQUEE_H_
@@ -0,0 +1,188 @@
+/**
+ * @file ascii7seg_parallel.h
+ * @brief Convert very large inputs on several cores, through a small pool of
+ *        worker threads.
+ *
+ * Ascii7Seg_ConvertBytes() runs on the core that calls it. A pool splits the
+ * same conversion into chunks of ASCII_7SEG_POOL_CHUNK_LEN characters, and each
+ * of its workers converts chunks with Ascii7Seg_ConvertBytes() itself, i.e. with
+ * the fastest kernel of the variant (SIMD or SWAR where there is one):
+ *
+ *    static struct Ascii7Seg_Pool_S pool;
+ *    (void)Ascii7Seg_PoolInit( &pool, 0 );   // One worker per online CPU
+ *    result = Ascii7Seg_PoolConvertBytes( &pool, log, log_len, encodings, cap );
+ *    ...
+ *    Ascii7Seg_PoolDeinit( &pool );
+ *
+ * Each worker starts with an even share of the chunks, and once it runs out, it
+ * steals from the others, so a slow core doesn't hold up the whole call. The
+ * calling thread is one of the workers. Chunks start where the encodings start
+ * a cache line, so no two workers ever write to the same line of the output.
+ * The first unsupported character is tracked across all of the chunks, and
+ * chunks after it are skipped.
+ *
+ * The result is exactly that of Ascii7Seg_ConvertBytes(). The only difference
+ * is that encodings after the first unsupported character may have been
+ * written too, so only the first result.converted encodings of buf are
+ * meaningful. Inputs shorter than two chunks are converted by the caller
+ * directly, without waking the workers.
+ *
+ * The workers are POSIX threads (link with -pthread). Where those aren't
+ * available (e.g., on an MCU), or with ASCII_7SEG_NO_THREADS, a pool has no
+ * threads and converts everything on the calling thread, with the same API.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_PARALLEL_H_
+#define ASCII_7SEG_PARALLEL_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+#if !defined(ASCII_7SEG_NO_THREADS) && \
+    (defined(__unix__) || defined(__APPLE__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define ASCII_7SEG_THREADS
+#include <pthread.h>
+#endif
+
+/* Public Macro Definitions */
+
+//! Most workers a pool can have, including the calling thread
+#define ASCII_7SEG_POOL_MAX_WORKERS    16u
+
+/**
+ * Characters per chunk. The source and encodings of a chunk (4 KiB to 32 KiB,
+ * depending on the layout) fit in the L2 cache of the worker converting it.
+ */
+#ifndef ASCII_7SEG_POOL_CHUNK_LEN
+#define ASCII_7SEG_POOL_CHUNK_LEN      4096u
+#endif
+
+//! Size of a cache line, which the workers' shared state is padded out to
+#define ASCII_7SEG_CACHE_LINE          64u
+
+/* Public Datatypes */
+
+#ifdef ASCII_7SEG_THREADS
+
+/**
+ * @brief A worker's thread and its share of the chunks. The counters sit
+ *        between a cache line of padding on either side, so that the workers
+ *        claiming chunks don't invalidate each other's lines.
+ */
+struct Ascii7Seg_PoolWorker_S
+{
+   struct Ascii7Seg_Pool_S * pool;
+   pthread_t thread;
+   size_t idx;
+   unsigned char pad_front[ASCII_7SEG_CACHE_LINE];
+   size_t next;   //!< Next chunk to claim (by the worker, or a thief)
+   size_t end;    //!< One past the worker's last chunk
+   unsigned char pad_back[ASCII_7SEG_CACHE_LINE];
+};
+
+/**
+ * @brief The conversion the workers are on.
+ */
+struct Ascii7Seg_PoolJob_S
+{
+   const char * src;
+   union Ascii7Seg_Encoding_U * buf;
+   size_t len;          //!< Characters to convert (src_len, capped at buf_cap)
+   size_t head;         //!< Length of chunk 0, up to the first cache-line-aligned encoding
+   unsigned char pad_front[ASCII_7SEG_CACHE_LINE];
+   size_t first_invalid;   //!< Lowest index of an unsupported character found so far
+   unsigned char pad_back[ASCII_7SEG_CACHE_LINE];
+};
+
+#endif // ASCII_7SEG_THREADS
+
+/**
+ * @brief A pool of workers. Allocate it wherever suits (static, stack, etc.),
+ *        set it up with Ascii7Seg_PoolInit(), and only access it through the
+ *        Ascii7Seg_Pool...() functions. One conversion at a time per pool.
+ */
+struct Ascii7Seg_Pool_S
+{
+   size_t num_workers;  //!< Including the calling thread (always 1 without threads)
+#ifdef ASCII_7SEG_THREADS
+   pthread_mutex_t lock;
+   pthread_cond_t start;      //!< Signaled when there is a new job (or on Deinit)
+   pthread_cond_t finished;   //!< Signaled when the last of the threads is done with it
+   unsigned long generation;  //!< Incremented for each job
+   size_t busy;               //!< Threads still on the current job
+   bool stop;
+   struct Ascii7Seg_PoolJob_S job;
+   struct Ascii7Seg_PoolWorker_S workers[ASCII_7SEG_POOL_MAX_WORKERS];
+#endif
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Sets up a pool and starts its worker threads.
+ *
+ * @param[out] pool         The pool to set up.
+ * @param[in]  num_workers  Workers, including the calling thread. 0 for one per
+ *                          online CPU. Capped at ASCII_7SEG_POOL_MAX_WORKERS.
+ *
+ * @return true if the pool was set up; false if pool is NULL or a thread
+ *         couldn't be started (none are left running)
+ */
+bool Ascii7Seg_PoolInit( struct Ascii7Seg_Pool_S * pool, size_t num_workers );
+
+/**
+ * @brief Stops and joins the worker threads of a pool.
+ *
+ * @param[in,out] pool  The pool, set up with Ascii7Seg_PoolInit().
+ */
+void Ascii7Seg_PoolDeinit( struct Ascii7Seg_Pool_S * pool );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertBytes(), split across the workers of a pool.
+ *
+ * @param[in]  pool     The pool, set up with Ascii7Seg_PoolInit().
+ * @param[in]  src      Source characters.
+ * @param[in]  src_len  Number of characters in src.
+ * @param[out] buf      Output buffer.
+ * @param[in]  buf_cap  Capacity of buf, in encodings.
+ *
+ * @return Same as Ascii7Seg_ConvertBytes() (nothing converted and no index if
+ *         pool is NULL). Encodings of buf past result.converted may have been
+ *         written.
+ */
+struct Ascii7Seg_Result_S Ascii7Seg_PoolConvertBytes( struct Ascii7Seg_Pool_S * pool,
+                                                      const char * src,
+                                                      size_t src_len,
+                                                      union Ascii7Seg_Encoding_U * buf,
+                                                      size_t buf_cap );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertWord(), split across the workers of a pool.
+ *
+ * @return Number of characters converted (0 if pool is NULL)
+ */
+size_t Ascii7Seg_PoolConvertWord( struct Ascii7Seg_Pool_S * pool,
+                                  const char * str,
+                                  size_t str_len,
+                                  union Ascii7Seg_Encoding_U * buf );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_PARALLEL_H_
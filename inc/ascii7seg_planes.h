@@ -0,0 +1,137 @@
+/**
+ * @file ascii7seg_planes.h
+ * @brief Convert an ASCII string to bit-sliced 7-segment planes.
+ *
+ * Displays that are multiplexed by segment (one segment line driven at a time,
+ * with every digit's enable on the other port) want the encoding "sideways":
+ * for each segment, one bit per digit. This module produces exactly that, so
+ * that a scan ISR can drive a whole segment row with a single store.
+ *
+ * Plane s holds segment s of every digit, where bit i of the plane belongs to
+ * digit i (i.e., the i-th character of the string, so the first character is
+ * the least significant bit). Digits past the converted characters are blank.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_PLANES_H_
+#define ASCII_7SEG_PLANES_H_
+
+/* File Inclusions */
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+//! Number of planes written by the functions in this module (segments a-g + decimal point)
+#define ASCII_7SEG_NUM_PLANES    8
+
+// Index of each segment's plane within a planes array
+#define ASCII_7SEG_PLANE_A       0
+#define ASCII_7SEG_PLANE_B       1
+#define ASCII_7SEG_PLANE_C       2
+#define ASCII_7SEG_PLANE_D       3
+#define ASCII_7SEG_PLANE_E       4
+#define ASCII_7SEG_PLANE_F       5
+#define ASCII_7SEG_PLANE_G       6
+#define ASCII_7SEG_PLANE_DP      7 //!< Always 0 unless Ascii7Seg_Encoding_U has a decimal point (ASCII_7SEG_HAS_DP)
+
+/* Public Datatypes */
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Converts an ASCII string to segment planes for up to 8 digits.
+ *
+ * Characters are converted the same way as Ascii7Seg_ConvertWord(): until an
+ * unsupported character, the end of the string, or str_len characters, and
+ * here additionally until the width of a plane (8 digits).
+ *
+ * @note All ASCII_7SEG_NUM_PLANES planes are always written (when str and
+ *       planes aren't NULL), and the bits of the digits that weren't converted
+ *       are 0 (i.e., blank digits).
+ *
+ * @param[in]  str      Pointer to the input ASCII string.
+ * @param[in]  str_len  Length of the input string to convert.
+ * @param[out] planes   Array of ASCII_7SEG_NUM_PLANES planes, indexed by ASCII_7SEG_PLANE_x.
+ *
+ * @return Number of characters converted (i.e., digits filled in)
+ */
+size_t Ascii7Seg_ConvertWordToPlanes8( const char * str,
+                                       size_t str_len,
+                                       uint8_t planes[ASCII_7SEG_NUM_PLANES] );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertWordToPlanes8(), for up to 16 digits.
+ */
+size_t Ascii7Seg_ConvertWordToPlanes16( const char * str,
+                                        size_t str_len,
+                                        uint16_t planes[ASCII_7SEG_NUM_PLANES] );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertWordToPlanes8(), for up to 32 digits.
+ */
+size_t Ascii7Seg_ConvertWordToPlanes32( const char * str,
+                                        size_t str_len,
+                                        uint32_t planes[ASCII_7SEG_NUM_PLANES] );
+
+/**
+ * @brief Same as Ascii7Seg_ConvertWordToPlanes8(), for up to 64 digits.
+ */
+size_t Ascii7Seg_ConvertWordToPlanes64( const char * str,
+                                        size_t str_len,
+                                        uint64_t planes[ASCII_7SEG_NUM_PLANES] );
+
+/**
+ * @brief Transposes already-converted encodings (e.g., from
+ *        Ascii7Seg_ConvertWord()) into segment planes for up to 8 digits.
+ *
+ * @note All ASCII_7SEG_NUM_PLANES planes are always written (when encodings and
+ *       planes aren't NULL), and the bits of the digits past num_encodings are 0.
+ *
+ * @param[in]  encodings      Array of encodings, one per digit.
+ * @param[in]  num_encodings  Number of encodings in the array.
+ * @param[out] planes         Array of ASCII_7SEG_NUM_PLANES planes, indexed by ASCII_7SEG_PLANE_x.
+ *
+ * @return Number of encodings transposed (i.e., the lesser of num_encodings and 8)
+ */
+size_t Ascii7Seg_EncodingsToPlanes8( const union Ascii7Seg_Encoding_U * encodings,
+                                     size_t num_encodings,
+                                     uint8_t planes[ASCII_7SEG_NUM_PLANES] );
+
+/**
+ * @brief Same as Ascii7Seg_EncodingsToPlanes8(), for up to 16 digits.
+ */
+size_t Ascii7Seg_EncodingsToPlanes16( const union Ascii7Seg_Encoding_U * encodings,
+                                      size_t num_encodings,
+                                      uint16_t planes[ASCII_7SEG_NUM_PLANES] );
+
+/**
+ * @brief Same as Ascii7Seg_EncodingsToPlanes8(), for up to 32 digits.
+ */
+size_t Ascii7Seg_EncodingsToPlanes32( const union Ascii7Seg_Encoding_U * encodings,
+                                      size_t num_encodings,
+                                      uint32_t planes[ASCII_7SEG_NUM_PLANES] );
+
+/**
+ * @brief Same as Ascii7Seg_EncodingsToPlanes8(), for up to 64 digits.
+ */
+size_t Ascii7Seg_EncodingsToPlanes64( const union Ascii7Seg_Encoding_U * encodings,
+                                      size_t num_encodings,
+                                      uint64_t planes[ASCII_7SEG_NUM_PLANES] );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_PLANES_H_
@@ -0,0 +1,135 @@
+/**
+ * @file ascii7seg_profile.h
+ * @brief Encode straight into the port byte of a particular display: its
+ *        wiring, its polarity, and its orientation.
+ *
+ * Boards rarely wire segments a to g to bits 0 to 6 of a port, common-anode
+ * displays light a segment with a 0, and a display mounted upside down needs
+ * every glyph rotated by 180 degrees (a <-> d, b <-> e, c <-> f). Doing all of
+ * that per character after Ascii7Seg_ConvertChar() costs a bit shuffle and an
+ * invert each time. A profile does it once instead: Ascii7Seg_ProfileInit()
+ * runs every ASCII character through the library's own encoder and stores the
+ * port byte it ends up as in a 128-byte table. Encoding through a profile is
+ * then a single table load, like the default lookup table path.
+ *
+ * A profile is self-contained, so there can be as many as there are physical
+ * displays, each with its own wiring.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_PROFILE_H_
+#define ASCII_7SEG_PROFILE_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+#define ASCII_7SEG_PROFILE_NUM_SEGMENTS   8u    //!< a to g, then the decimal point
+#define ASCII_7SEG_PROFILE_NUM_CHARS      128u  //!< Every ASCII character has an entry
+
+/* Public Datatypes */
+
+/**
+ * @brief How a display is wired and mounted.
+ */
+struct Ascii7Seg_ProfileConfig_S
+{
+   uint8_t segment_bits[ASCII_7SEG_PROFILE_NUM_SEGMENTS];  //!< Port bit (0 to 7) of each segment (a, b, ..., g, dp), all different
+   bool active_low;                                        //!< A segment is lit by a 0 (e.g., common anode)
+   bool rotate_180;                                        //!< The display is mounted upside down
+};
+
+/**
+ * @brief A display's encoding tables. Allocate it wherever suits (static,
+ *        etc.), set it up with Ascii7Seg_ProfileInit(), and only access it
+ *        through the Ascii7Seg_Profile...() functions.
+ */
+struct Ascii7Seg_Profile_S
+{
+   uint8_t table[ASCII_7SEG_PROFILE_NUM_CHARS];       //!< Port byte of each character (blank if unsupported)
+   uint8_t supported[ASCII_7SEG_PROFILE_NUM_CHARS / 8u]; //!< Bit c is set if character c is supported
+   uint8_t low_nibble[16];                            //!< Port bits of segments a to d, by packed encoding nibble
+   uint8_t high_nibble[16];                           //!< Port bits of segments e to g and dp, likewise
+   uint8_t blank;                                     //!< Port byte with every segment off
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Builds a profile's tables for the given display.
+ *
+ * The rotation is applied to the glyph first, then the wiring, then the
+ * polarity. The decimal point is left where it is by the rotation, since an
+ * upside-down display has it at the top left of the digit.
+ *
+ * @param[out] profile  The profile to set up.
+ * @param[in]  cfg      The display's wiring, polarity, and orientation.
+ *
+ * @return true if the profile was set up; false if an argument is NULL or
+ *         cfg->segment_bits is not a permutation of 0 to 7
+ */
+bool Ascii7Seg_ProfileInit( struct Ascii7Seg_Profile_S * profile,
+                            const struct Ascii7Seg_ProfileConfig_S * cfg );
+
+/**
+ * @brief Like Ascii7Seg_ConvertChar(), but into the display's port byte.
+ *
+ * @param[in]  profile     The display's profile.
+ * @param[in]  ascii_char  The ASCII character to convert.
+ * @param[out] buf         Where the port byte goes (blank if the character
+ *                         is not supported).
+ *
+ * @return true if the conversion was successful; false otherwise
+ */
+bool Ascii7Seg_ProfileConvertChar( const struct Ascii7Seg_Profile_S * profile,
+                                   char ascii_char,
+                                   uint8_t * buf );
+
+/**
+ * @brief Like Ascii7Seg_ConvertWord(), but into the display's port bytes:
+ *        stops at the first unsupported character, the null terminator, or
+ *        str_len characters, whichever comes first.
+ *
+ * @return Number of characters converted
+ */
+size_t Ascii7Seg_ProfileConvertWord( const struct Ascii7Seg_Profile_S * profile,
+                                     const char * str,
+                                     size_t str_len,
+                                     uint8_t * buf );
+
+/**
+ * @brief Maps encodings that already exist (e.g., from ascii7seg_format.h,
+ *        with a decimal point) to the display's port bytes, through two
+ *        16-entry nibble tables.
+ *
+ * @param[in]  profile        The display's profile.
+ * @param[in]  encodings      The encodings to map.
+ * @param[in]  num_encodings  Number of encodings.
+ * @param[out] buf            Where the num_encodings port bytes go.
+ *
+ * @return true if the encodings were mapped; false if an argument is NULL
+ */
+bool Ascii7Seg_ProfileApply( const struct Ascii7Seg_Profile_S * profile,
+                             const union Ascii7Seg_Encoding_U * encodings,
+                             size_t num_encodings,
+                             uint8_t * buf );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_PROFILE_H_
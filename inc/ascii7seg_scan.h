@@ -0,0 +1,160 @@
+/**
+ * @file ascii7seg_scan.h
+ * @brief Multiplex a display wired straight to GPIO, from a timer interrupt, in
+ *        constant time per tick.
+ *
+ * A multiplexed display lights one digit at a time, fast enough that they all
+ * look lit. Working out which pins to drive from each encoding on every tick
+ * makes the tick's length depend on the digit, which shows up as uneven
+ * brightness. A scan scheduler works the pins out once per frame instead, in
+ * Ascii7Seg_ScanSetFrame(): for each digit, a mask of segment pins to set and
+ * a mask to clear, and the same for the digit-select pins. Each
+ * Ascii7Seg_ScanTick() then only writes masks:
+ *
+ *    1. all digits off (so the old digit never shows the new segments, which
+ *       is what causes ghosting),
+ *    2. the digit's segment set/clear masks,
+ *    3. the digit's select set/clear masks,
+ *
+ * followed by blank_ticks ticks with all digits off, if configured, to give
+ * slow drivers time to turn off (and to dim the display).
+ *
+ * The pins are driven through a Ascii7Seg_ScanGpio_S of two functions, each of
+ * which sets and clears bits of a port in one go (e.g., one write to a
+ * set/reset register such as the STM32's BSRR), so the scheduler is
+ * independent of the MCU and can be tested against a mock on the host.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_SCAN_H_
+#define ASCII_7SEG_SCAN_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+#define ASCII_7SEG_SCAN_MAX_DIGITS     8u
+#define ASCII_7SEG_SCAN_NUM_SEGMENTS   8u   //!< a to g, then the decimal point
+
+/* Public Datatypes */
+
+/**
+ * @brief Writes a port: sets the bits of set_mask and clears those of
+ *        clear_mask, which never overlap.
+ */
+typedef void (*Ascii7Seg_ScanPortWrite_T)( void * ctx, uint32_t set_mask, uint32_t clear_mask );
+
+/**
+ * @brief The GPIO that the scheduler drives. The segment pins and the digit
+ *        pins may be on the same port or not.
+ */
+struct Ascii7Seg_ScanGpio_S
+{
+   Ascii7Seg_ScanPortWrite_T write_segments;
+   Ascii7Seg_ScanPortWrite_T write_digits;
+   void * ctx;                                 //!< Passed to both as is
+};
+
+/**
+ * @brief How the display is wired to the ports.
+ */
+struct Ascii7Seg_ScanPinMap_S
+{
+   uint32_t segment_pins[ASCII_7SEG_SCAN_NUM_SEGMENTS];  //!< Mask of the pin of each segment (a, b, ..., g, dp) on the segment port (0 if not wired)
+   uint32_t digit_pins[ASCII_7SEG_SCAN_MAX_DIGITS];      //!< Mask of the select pin of each digit on the digit port
+   size_t num_digits;                                    //!< Number of digits (1 to ASCII_7SEG_SCAN_MAX_DIGITS)
+   bool segments_active_low;                             //!< A segment pin is low to light it (e.g., common anode)
+   bool digits_active_low;                               //!< A select pin is low to select its digit (e.g., PNP high-side drivers)
+};
+
+/**
+ * @brief Precomputed port writes for one digit.
+ */
+struct Ascii7Seg_ScanSlot_S
+{
+   uint32_t segments_set;
+   uint32_t segments_clear;
+   uint32_t digit_set;
+   uint32_t digit_clear;
+};
+
+/**
+ * @brief State of a scan scheduler. Allocate it wherever suits (static, etc.),
+ *        set it up with Ascii7Seg_ScanInit(), and only access it through the
+ *        Ascii7Seg_Scan...() functions.
+ *
+ * Slots are double-buffered: Ascii7Seg_ScanSetFrame() fills the bank that the
+ * ticks aren't reading, then switches banks with a single store, so a frame can
+ * be set from the main loop while a timer interrupt ticks (on a single core).
+ */
+struct Ascii7Seg_Scan_S
+{
+   struct Ascii7Seg_ScanSlot_S slots[2][ASCII_7SEG_SCAN_MAX_DIGITS];
+   volatile uint8_t active_bank;                //!< Bank of slots the ticks read from
+   struct Ascii7Seg_ScanPinMap_S pins;
+   struct Ascii7Seg_ScanGpio_S gpio;
+   uint32_t digits_off_set;                     //!< Digit port write that deselects every digit
+   uint32_t digits_off_clear;
+   size_t blank_ticks;                          //!< All-off ticks after each digit
+   size_t digit;                                //!< Digit that the next lit tick shows
+   size_t phase;                                //!< 0 for the lit tick of a digit, then 1 to blank_ticks
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Sets up a scan scheduler with a blank frame, and turns every digit
+ *        off.
+ *
+ * @param[out] scan         The scheduler to set up.
+ * @param[in]  pins         How the display is wired (copied).
+ * @param[in]  gpio         The ports to drive (copied).
+ * @param[in]  blank_ticks  Ticks with every digit off after each digit.
+ *
+ * @return true if the scheduler was set up; false if an argument is invalid
+ */
+bool Ascii7Seg_ScanInit( struct Ascii7Seg_Scan_S * scan,
+                         const struct Ascii7Seg_ScanPinMap_S * pins,
+                         const struct Ascii7Seg_ScanGpio_S * gpio,
+                         size_t blank_ticks );
+
+/**
+ * @brief Works out the port writes for a new frame, which the ticks show from
+ *        the next digit on.
+ *
+ * @param[in,out] scan    The scheduler.
+ * @param[in]     digits  The pins' num_digits encodings, digit 0 first.
+ *
+ * @return true if the frame was set; false if an argument is NULL
+ */
+bool Ascii7Seg_ScanSetFrame( struct Ascii7Seg_Scan_S * scan,
+                             const union Ascii7Seg_Encoding_U * digits );
+
+/**
+ * @brief Advances the scan by one tick. Call it from a periodic timer
+ *        interrupt. Every lit tick makes the same three port writes, and every
+ *        blank tick one, whatever the frame.
+ *
+ * @param[in,out] scan  The scheduler (must have been set up).
+ */
+void Ascii7Seg_ScanTick( struct Ascii7Seg_Scan_S * scan );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_SCAN_H_
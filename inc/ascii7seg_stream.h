@@ -0,0 +1,177 @@
+/**
+ * @file ascii7seg_stream.h
+ * @brief Convert an unbounded stream of ASCII characters, chunk by chunk, into
+ *        a ring of 7-segment encodings.
+ *
+ * Ascii7Seg_ConvertWord() needs the whole string in memory and stops at the
+ * first unsupported character. A stream instead takes its input in chunks of
+ * any size (e.g., as they come off a UART or a log pipe), carries its position
+ * over from one chunk to the next, and writes the encodings into a ring that
+ * the caller allocates and drains at its own pace. Unsupported characters are
+ * handled by a policy instead of ending the conversion, so memory use is
+ * constant no matter how long the input is:
+ *
+ *    union Ascii7Seg_Encoding_U ring[64];
+ *    struct Ascii7Seg_Stream_S stream;
+ *    (void)Ascii7Seg_StreamInit( &stream, ring, 64, ASCII_7SEG_STREAM_SKIP, NULL );
+ *
+ *    while ( (len = uart_read(chunk, sizeof(chunk))) > 0 )
+ *    {
+ *       for ( size_t done = 0; done < len; )
+ *       {
+ *          done += Ascii7Seg_StreamFeed( &stream, &chunk[done], len - done );
+ *          n = Ascii7Seg_StreamRead( &stream, out, OUT_LEN );  // drain
+ *          ...
+ *       }
+ *    }
+ *    struct Ascii7Seg_StreamStats_S stats = Ascii7Seg_StreamFlush( &stream );
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_STREAM_H_
+#define ASCII_7SEG_STREAM_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Public Macro Definitions */
+
+//! Ascii7Seg_StreamStats_S.first_invalid_offset when no unsupported character was seen
+#define ASCII_7SEG_STREAM_NO_INVALID_OFFSET   SIZE_MAX
+
+/* Public Datatypes */
+
+/**
+ * @brief What a stream does with a character it can't encode.
+ *
+ * Either way, the character is consumed and counted in the stream's stats.
+ */
+enum Ascii7Seg_StreamPolicy_E
+{
+   ASCII_7SEG_STREAM_SKIP,    //!< Drop it (no encoding is written)
+   ASCII_7SEG_STREAM_REPLACE, //!< Write the stream's replacement encoding in its place
+   ASCII_7SEG_STREAM_NUM_OF_POLICIES
+};
+
+/**
+ * @brief Totals for the input fed to a stream since it was initialized or
+ *        last flushed.
+ */
+struct Ascii7Seg_StreamStats_S
+{
+   size_t chars_consumed;        //!< Characters consumed from the input
+   size_t encodings_written;     //!< Encodings written to the ring (including replacements)
+   size_t num_invalid;           //!< Unsupported characters consumed
+   size_t first_invalid_offset;  //!< Offset into the input of the first of those, or ASCII_7SEG_STREAM_NO_INVALID_OFFSET
+   char first_invalid_char;      //!< The first of those ('\0' if there is none)
+};
+
+/**
+ * @brief State of a stream. Allocate it wherever suits (static, stack, etc.),
+ *        set it up with Ascii7Seg_StreamInit(), and only access it through the
+ *        Ascii7Seg_Stream...() functions.
+ */
+struct Ascii7Seg_Stream_S
+{
+   union Ascii7Seg_Encoding_U * ring;        //!< Caller's ring of encodings
+   size_t ring_cap;                          //!< Number of encodings ring can hold
+   size_t write_idx;                         //!< Where the next encoding goes in ring
+   size_t num_pending;                       //!< Encodings in ring not yet read out
+   enum Ascii7Seg_StreamPolicy_E policy;
+   union Ascii7Seg_Encoding_U replacement;   //!< Written for unsupported characters under ASCII_7SEG_STREAM_REPLACE
+   struct Ascii7Seg_StreamStats_S stats;
+};
+
+/* Public API */
+
+// To allow usage in C++ code...
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Sets up a stream that writes into the given ring.
+ *
+ * @param[out] stream       The stream to set up.
+ * @param[in]  ring         Array of ring_cap encodings the stream will write into.
+ *                          It must outlive the stream.
+ * @param[in]  ring_cap     Number of encodings ring can hold (at least 1).
+ * @param[in]  policy       What to do with unsupported characters.
+ * @param[in]  replacement  Encoding written for unsupported characters under
+ *                          ASCII_7SEG_STREAM_REPLACE. NULL means a blank digit.
+ *                          Ignored under ASCII_7SEG_STREAM_SKIP.
+ *
+ * @return true if the stream was set up; false if an argument is invalid
+ */
+bool Ascii7Seg_StreamInit( struct Ascii7Seg_Stream_S * stream,
+                           union Ascii7Seg_Encoding_U * ring,
+                           size_t ring_cap,
+                           enum Ascii7Seg_StreamPolicy_E policy,
+                           const union Ascii7Seg_Encoding_U * replacement );
+
+/**
+ * @brief Encodes the next chunk of the input into the stream's ring.
+ *
+ * Characters are consumed in order until the chunk runs out or the ring is
+ * full. Unlike Ascii7Seg_ConvertWord(), a null character is not the end of the
+ * input but an unsupported character like any other.
+ *
+ * @note If the ring fills up, the rest of the chunk is not consumed. Read some
+ *       encodings out and feed the rest of the chunk again.
+ * @note The same SIMD over-read of chunk as in Ascii7Seg_ConvertWord() applies.
+ *
+ * @param[in,out] stream     The stream.
+ * @param[in]     chunk      Next characters of the input (need not be null terminated).
+ * @param[in]     chunk_len  Number of characters in chunk.
+ *
+ * @return Number of characters of chunk consumed
+ */
+size_t Ascii7Seg_StreamFeed( struct Ascii7Seg_Stream_S * stream,
+                             const char * chunk,
+                             size_t chunk_len );
+
+/**
+ * @brief Moves up to buf_len of the oldest encodings out of the stream's ring.
+ *
+ * @param[in,out] stream   The stream.
+ * @param[out]    buf      Where the encodings go, in the order they were written.
+ * @param[in]     buf_len  Number of encodings buf can hold.
+ *
+ * @return Number of encodings moved into buf
+ */
+size_t Ascii7Seg_StreamRead( struct Ascii7Seg_Stream_S * stream,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t buf_len );
+
+/**
+ * @brief Number of encodings in the stream's ring waiting to be read.
+ */
+size_t Ascii7Seg_StreamPending( const struct Ascii7Seg_Stream_S * stream );
+
+/**
+ * @brief Ends the current input (e.g., one message of a feed) and starts the
+ *        next one.
+ *
+ * Encodings still in the ring are kept and can be read out as usual. Only the
+ * stats restart, so input offsets in the next stats count from the flush.
+ *
+ * @param[in,out] stream  The stream.
+ *
+ * @return Totals for the input fed since the stream was initialized or last
+ *         flushed (all zero, with no invalid offset, if stream is NULL)
+ */
+struct Ascii7Seg_StreamStats_S Ascii7Seg_StreamFlush( struct Ascii7Seg_Stream_S * stream );
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ASCII_7SEG_STREAM_H_
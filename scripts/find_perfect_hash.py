@@ -0,0 +1,357 @@
+"""
+Searches for a collision-free, division-free hash over the full range of
+supported characters (scripts/ascii7seg_encodings.csv) and emits the dense
+encoding table used by the ASCII_7SEG_USE_PERFECT_HASH variant of the library.
+
+MasterLUT is indexed directly by the ASCII value, so it has 128 entries to serve
+72 characters. A perfect hash maps each supported character to its own slot in
+a table of T >= 72 entries. Three hash families are searched:
+
+    multiply-shift:  h = (((c * M) & (2^w - 1)) >> s) - base
+    xor-fold:        h = ((c ^ (c >> k)) & (2^n - 1)) - base     (or c << k)
+    displacement:    h = (c & (2^b - 1)) + D[(c >> b) - base]
+
+The displacement family is the row-displacement scheme used to compress sparse
+parser tables: the 7-bit key space is cut into rows of 2^b characters, and each
+row is slid along the dense table by D[row] until its characters land on free
+slots. It needs a small side table, but it is the only family here that reaches
+a minimal (T == 72) hash.
+
+Every candidate is costed in Cortex-M0+ cycles (the MCU in mcu_opts.mk) with a
+simple Thumb-1 model: ALU ops and MULS take 1 cycle, loads take 2, and a
+constant costs a MOVS (1 cycle) if it fits in 8 bits or a literal pool LDR (2
+cycles + 4 bytes) otherwise. The winner is the candidate with the least rodata
+(dense table + side table + key set), ties broken by cycles, unless
+--objective cycles is given.
+
+None of the hashes reject unsupported characters by themselves, so a 128-bit
+set of the supported characters is emitted alongside the table. Every full range
+variant uses that set for Ascii7Seg_IsSupportedChar(), hash or not, so it is
+emitted outside of the ASCII_7SEG_USE_PERFECT_HASH guard.
+
+Usage:
+    python scripts/find_perfect_hash.py                      # report + print the code
+    python scripts/find_perfect_hash.py --write src/ascii7seg.c
+        # replace the code between the GENERATED markers in the given file
+"""
+
+import argparse
+import csv
+import sys
+
+CSV_PATH = 'scripts/ascii7seg_encodings.csv'
+SEGMENTS = 'abcdefg'
+BEGIN_MARKER = '// BEGIN GENERATED CODE: scripts/find_perfect_hash.py'
+END_MARKER = '// END GENERATED CODE'
+
+# Size of one table entry in the default (non-bit-packed) layout, which is the
+# layout where the table size matters most.
+ENTRY_SIZE_BOOL = 7
+ENTRY_SIZE_BIT_PACK = 1
+CHAR_SET_SIZE = 16
+
+# Cortex-M0+ cost model (cycles)
+CYCLES_ALU = 1
+CYCLES_LOAD = 2
+
+
+def read_encodings(path):
+    encodings = {}
+    with open(path, newline='') as csvfile:
+        for row in csv.reader(csvfile):
+            if not row or row[0].startswith('//'):
+                continue  # Skip comments or empty lines
+            encodings[int(row[0])] = int(row[1])
+    return encodings
+
+
+def const_cycles(value):
+    """Cycles to get a constant into a register"""
+    return CYCLES_ALU if value <= 0xFF else CYCLES_LOAD
+
+
+def mask_cycles(bits):
+    """Cycles to AND a value with (2^bits - 1)"""
+    if bits in (8, 16):
+        return CYCLES_ALU                       # UXTB / UXTH
+    return const_cycles((1 << bits) - 1) + CYCLES_ALU  # MOVS + ANDS
+
+
+class Candidate:
+    def __init__(self, family, params, slots, cycles, side_table=None):
+        self.family = family
+        self.params = params
+        self.slots = slots                    # key -> slot
+        self.size = max(slots.values()) + 1   # T
+        self.cycles = cycles
+        self.side_table = side_table or []
+
+    def rodata(self, entry_size):
+        return self.size * entry_size + len(self.side_table) + CHAR_SET_SIZE
+
+    def describe(self):
+        p = self.params
+        if self.family == 'multiply-shift':
+            return 'h = (((c * {M}) mod 2^{w}) >> {s}) - {base}'.format(**p)
+        if self.family == 'xor-fold':
+            return 'h = ((c ^ (c {op} {k})) & 0x{mask:X}) - {base}'.format(
+                mask=(1 << p['n']) - 1, **p)
+        return 'h = (c & 0x{mask:X}) + D[(c >> {b}) - {base}]'.format(
+            mask=(1 << p['b']) - 1, **p)
+
+
+def normalize(hashes):
+    """Subtracts the smallest hash so that the table starts at slot 0. Returns
+    None if two keys collide."""
+    if len(set(hashes.values())) != len(hashes):
+        return None, 0
+    base = min(hashes.values())
+    return {k: h - base for k, h in hashes.items()}, base
+
+
+def search_multiply_shift(keys):
+    best = {}
+    for w in (8, 16, 32):
+        full = (1 << w) - 1
+        for M in range(1, 4096, 2):  # even multipliers are just an extra shift
+            for s in range(0, w):
+                if (127 * M) >> s == 0:
+                    break
+                slots, base = normalize({c: ((c * M) & full) >> s for c in keys})
+                if slots is None:
+                    continue
+                # MOVS/LDR M, MULS, mask (not needed if the product never
+                # overflows w bits), LSRS, SUBS
+                cycles = const_cycles(M) + CYCLES_ALU if M > 1 else 0
+                if 127 * M > full and w < 32:
+                    cycles += mask_cycles(w)
+                cycles += CYCLES_ALU if s else 0
+                cycles += CYCLES_ALU if base else 0
+                cand = Candidate('multiply-shift', dict(M=M, w=w, s=s, base=base),
+                                 slots, cycles)
+                keep_best(best, cand)
+    return best
+
+
+def search_xor_fold(keys):
+    best = {}
+    for op in ('>>', '<<'):
+        for k in range(1, 7):
+            for n in range(6, 9):
+                mask = (1 << n) - 1
+                fold = (lambda c: c ^ (c >> k)) if op == '>>' else (lambda c: c ^ (c << k))
+                slots, base = normalize({c: fold(c) & mask for c in keys})
+                if slots is None:
+                    continue
+                # LSRS/LSLS, EORS, mask, SUBS
+                cycles = 2 * CYCLES_ALU
+                if op == '<<' or n < 7:
+                    cycles += mask_cycles(n)
+                cycles += CYCLES_ALU if base else 0
+                cand = Candidate('xor-fold', dict(op=op, k=k, n=n, base=base),
+                                 slots, cycles)
+                keep_best(best, cand)
+    return best
+
+
+def search_displacement(keys):
+    best = {}
+    for b in range(1, 6):
+        width = 1 << b
+        rows = {}
+        for c in keys:
+            rows.setdefault(c >> b, []).append(c & (width - 1))
+        # First-fit decreasing: place the fullest rows first
+        occupied = set()
+        displacement = {}
+        for row in sorted(rows, key=lambda r: (-len(rows[r]), r)):
+            d = 0
+            while any((d + col) in occupied for col in rows[row]):
+                d += 1
+            displacement[row] = d
+            occupied |= {d + col for col in rows[row]}
+        base = min(rows)
+        side = [displacement.get(r, 0) for r in range(base, max(rows) + 1)]
+        if max(side) > 0xFF:
+            continue
+        slots = {c: (c & (width - 1)) + displacement[c >> b] for c in keys}
+        # LSRS, SUBS, LDR &D, LDRB, MOVS + ANDS, ADDS
+        cycles = CYCLES_ALU + (CYCLES_ALU if base else 0) + 2 * CYCLES_LOAD + \
+                 mask_cycles(b) + CYCLES_ALU
+        cand = Candidate('displacement', dict(b=b, base=base), slots, cycles, side)
+        keep_best(best, cand)
+    return best
+
+
+def keep_best(best, cand):
+    """Keeps the cheapest candidate for each table size"""
+    old = best.get(cand.size)
+    if old is None or (cand.cycles, len(cand.side_table)) < (old.cycles, len(old.side_table)):
+        best[cand.size] = cand
+
+
+def choose(candidates, objective, entry_size):
+    if objective == 'cycles':
+        key = lambda c: (c.cycles, c.rodata(entry_size))
+    else:
+        key = lambda c: (c.rodata(entry_size), c.cycles)
+    return min(candidates, key=key)
+
+
+def report(families, winner, out):
+    out.write('{:<16}{:>5}{:>8}{:>13}{:>11}  {}\n'.format(
+        'family', 'T', 'cycles', 'rodata bool', 'rodata BP', 'hash'))
+    for name, best in families:
+        if not best:
+            continue
+        for cand in (best[min(best)], min(best.values(), key=lambda c: c.cycles)):
+            out.write('{}{:<15}{:>5}{:>8}{:>13}{:>11}  {}\n'.format(
+                '*' if cand is winner else ' ', name, cand.size, cand.cycles,
+                cand.rodata(ENTRY_SIZE_BOOL), cand.rodata(ENTRY_SIZE_BIT_PACK),
+                cand.describe()))
+            if best[min(best)] is min(best.values(), key=lambda c: c.cycles):
+                break
+
+
+def c_char(c):
+    ch = chr(c)
+    return "'\\''" if ch == "'" else "'{}'".format(ch)
+
+
+def generate(encodings, cand):
+    keys = sorted(encodings)
+    p = cand.params
+    lines = [BEGIN_MARKER + ' (do not edit by hand)']
+
+    if cand.family == 'multiply-shift':
+        expr = '( (((uint32_t)(c) * {}u)'.format(p['M'])
+        if 127 * p['M'] > (1 << p['w']) - 1 and p['w'] < 32:
+            expr += ' & 0x{:X}u'.format((1 << p['w']) - 1)
+        expr += ') >> {}u )'.format(p['s'])
+        if p['base']:
+            expr = '( {} - {}u )'.format(expr, p['base'])
+    elif cand.family == 'xor-fold':
+        expr = '( ((uint32_t)(c) ^ ((uint32_t)(c) {} {}u)) & 0x{:X}u )'.format(
+            p['op'], p['k'], (1 << p['n']) - 1)
+        if p['base']:
+            expr = '( {} - {}u )'.format(expr, p['base'])
+    else:
+        index = '((uint32_t)(c) >> {}u)'.format(p['b'])
+        if p['base']:
+            index = '({} - {}u)'.format(index, p['base'])
+        expr = '( ((uint32_t)(c) & 0x{:X}u) + PerfectHashDisplacement[{}] )'.format(
+            (1 << p['b']) - 1, index)
+
+    lines.append('#define SUPPORTED_CHAR_SET_HAS(c)  ( ((unsigned)SupportedCharSet[(c) >> 3u] >> ((c) & 7u)) & 1u )')
+    lines.append('')
+
+    char_set = [0] * CHAR_SET_SIZE
+    for c in keys:
+        char_set[c >> 3] |= 1 << (c & 7)
+    lines.append('static const uint8_t SupportedCharSet[{}] ='.format(CHAR_SET_SIZE))
+    lines.append('{')
+    for i in range(0, CHAR_SET_SIZE, 8):
+        lines.append('   ' + ', '.join('0x{:02X}'.format(v) for v in char_set[i:i + 8]) +
+                     (',' if i + 8 < CHAR_SET_SIZE else ''))
+    lines.append('};')
+    lines.append('')
+
+    lines.append('#if !defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE) && defined(ASCII_7SEG_USE_PERFECT_HASH)')
+    lines.append('')
+    lines.append('// {} hash, {} slots for {} characters: {}'.format(
+        cand.family, cand.size, len(keys), cand.describe()))
+    lines.append('#define PERFECT_HASH(c)  {}'.format(expr))
+    lines.append('')
+
+    if cand.side_table:
+        n = len(cand.side_table)
+        lines.append('static const uint8_t PerfectHashDisplacement[{}] ='.format(n))
+        lines.append('{')
+        for i in range(0, n, 12):
+            lines.append('   ' + ', '.join('{:>2}'.format(v) for v in cand.side_table[i:i + 12]) +
+                         (',' if i + 12 < n else ''))
+        lines.append('};')
+        lines.append('')
+
+    by_slot = {slot: c for c, slot in cand.slots.items()}
+    lines.append('static const union Ascii7Seg_Encoding_U PerfectHashLUT[{}] ='.format(cand.size))
+    lines.append('{')
+    for slot in range(cand.size):
+        sep = ',' if slot + 1 < cand.size else ''
+        if slot not in by_slot:
+            lines.append('   {{ /* {:>2}: --- */ .encoding_as_val = {{ 0 }} }}{}'.format(slot, sep))
+            continue
+        c = by_slot[slot]
+        enc = encodings[c]
+        segs = ', '.join('.{} = {}'.format(s, (enc >> i) & 1) for i, s in enumerate(SEGMENTS))
+        lines.append('   {{ /* {:>2}: {} */ .segments = {{ {} }} }}{}'.format(
+            slot, c_char(c), segs, sep))
+    lines.append('};')
+    lines.append('')
+    lines.append('#endif // ASCII_7SEG_USE_PERFECT_HASH')
+    lines.append(END_MARKER + ' ({} bytes bit-packed, {} bytes otherwise)'.format(
+        cand.rodata(ENTRY_SIZE_BIT_PACK), cand.rodata(ENTRY_SIZE_BOOL)))
+    return '\n'.join(lines)
+
+
+def self_check(encodings, cand):
+    slots = set()
+    for c in encodings:
+        p = cand.params
+        if cand.family == 'multiply-shift':
+            h = (((c * p['M']) & ((1 << p['w']) - 1)) >> p['s']) - p['base']
+        elif cand.family == 'xor-fold':
+            folded = c ^ (c >> p['k']) if p['op'] == '>>' else c ^ (c << p['k'])
+            h = (folded & ((1 << p['n']) - 1)) - p['base']
+        else:
+            h = (c & ((1 << p['b']) - 1)) + cand.side_table[(c >> p['b']) - p['base']]
+        assert h == cand.slots[c] and 0 <= h < cand.size, chr(c)
+        slots.add(h)
+    assert len(slots) == len(encodings)
+
+
+def write_into(path, code):
+    with open(path) as f:
+        text = f.read()
+    begin = text.index(BEGIN_MARKER)
+    end = text.index(END_MARKER, begin)
+    end = text.index('\n', end)
+    text = text[:begin] + code + text[end:]
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--csv', default=CSV_PATH)
+    parser.add_argument('--objective', choices=('size', 'cycles'), default='size',
+                        help='what to minimize first (default: size)')
+    parser.add_argument('--bit-pack', action='store_true',
+                        help='weigh table sizes for the bit-packed layout')
+    parser.add_argument('--write', metavar='FILE',
+                        help='replace the generated region of FILE instead of printing')
+    args = parser.parse_args()
+
+    encodings = read_encodings(args.csv)
+    keys = sorted(encodings)
+    assert max(keys) < 128
+
+    families = [('multiply-shift', search_multiply_shift(keys)),
+                ('xor-fold', search_xor_fold(keys)),
+                ('displacement', search_displacement(keys))]
+    entry_size = ENTRY_SIZE_BIT_PACK if args.bit_pack else ENTRY_SIZE_BOOL
+    winner = choose([c for _, best in families for c in best.values()],
+                    args.objective, entry_size)
+    self_check(encodings, winner)
+
+    report(families, winner, sys.stderr)
+    code = generate(encodings, winner)
+    if args.write:
+        write_into(args.write, code)
+    else:
+        print(code)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,82 @@
+"""
+Generates the table of packed encodings that inc/ascii7seg.hpp encodes from at
+compile time, from the same scripts/ascii7seg_encodings.csv that the C sources
+are generated from.
+
+The table has one byte per ASCII value, where bit s is segment s (a = 0 ...
+g = 6), and 0 marks an unsupported character (every supported character has at
+least one segment on).
+
+Usage:
+    python scripts/gen_constexpr_table.py                        # print the code
+    python scripts/gen_constexpr_table.py --write inc/ascii7seg.hpp
+        # replace the code between the GENERATED markers in the given file
+"""
+
+import argparse
+import csv
+import sys
+
+CSV_PATH = 'scripts/ascii7seg_encodings.csv'
+TABLE_SIZE = 128
+PER_LINE = 8
+BEGIN_MARKER = '// BEGIN GENERATED CODE: scripts/gen_constexpr_table.py'
+END_MARKER = '// END GENERATED CODE'
+
+
+def read_encodings(path):
+    encodings = {}
+    with open(path, newline='') as csvfile:
+        for row in csv.reader(csvfile):
+            if not row or row[0].startswith('//'):
+                continue  # Skip comments or empty lines
+            encodings[int(row[0])] = int(row[1])
+    return encodings
+
+
+def label(c):
+    return "'{}'".format(chr(c)) if (0x20 < c < 0x7F) and chr(c) not in "'\\" else '0x{:02X}'.format(c)
+
+
+def generate(encodings):
+    assert all(0 < enc < 0x80 for enc in encodings.values())
+    lines = [BEGIN_MARKER + ' (do not edit by hand)']
+    lines.append('inline constexpr std::uint8_t PackedLUT[{}] ='.format(TABLE_SIZE))
+    lines.append('{')
+    for row in range(0, TABLE_SIZE, PER_LINE):
+        values = ', '.join('0x{:02X}'.format(encodings.get(c, 0)) for c in range(row, row + PER_LINE))
+        sep = ',' if row + PER_LINE < TABLE_SIZE else ' '
+        lines.append('   {}{}  // {} - {}'.format(values, sep, label(row), label(row + PER_LINE - 1)))
+    lines.append('};')
+    lines.append(END_MARKER + ' ({} supported characters)'.format(len(encodings)))
+    return '\n'.join(lines)
+
+
+def write_into(path, code):
+    with open(path) as f:
+        text = f.read()
+    begin = text.index(BEGIN_MARKER)
+    end = text.index(END_MARKER, begin)
+    end = text.index('\n', end)
+    text = text[:begin] + code + text[end:]
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--csv', default=CSV_PATH)
+    parser.add_argument('--write', metavar='FILE',
+                        help='replace the generated region of FILE instead of printing')
+    args = parser.parse_args()
+
+    code = generate(read_encodings(args.csv))
+    if args.write:
+        write_into(args.write, code)
+    else:
+        print(code)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
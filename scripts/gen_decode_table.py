@@ -0,0 +1,133 @@
+"""
+Generates the inverse lookup tables of src/ascii7seg_decode.c from
+scripts/ascii7seg_encodings.csv.
+
+Every 7-bit packed encoding (bit s = segment s, a = 0 ... g = 6) gets the
+canonical character it decodes to, or '\\0' if no character is encoded that
+way, and the offset in a pool of null-terminated strings of every character
+encoded that way (canonical first). When several characters share a glyph,
+the canonical one is a digit if there is one, then an uppercase letter, then
+a lowercase letter, then a symbol, since readback is usually checked against
+numbers and the uppercase letters are the library's main rendering.
+
+Usage:
+    python scripts/gen_decode_table.py                              # print the code
+    python scripts/gen_decode_table.py --write src/ascii7seg_decode.c
+        # replace the code between the GENERATED markers in the given file
+"""
+
+import argparse
+import csv
+import sys
+
+CSV_PATH = 'scripts/ascii7seg_encodings.csv'
+TABLE_SIZE = 128
+PER_LINE = 8
+BEGIN_MARKER = '// BEGIN GENERATED CODE: scripts/gen_decode_table.py'
+END_MARKER = '// END GENERATED CODE'
+
+
+def read_encodings(path):
+    encodings = {}
+    with open(path, newline='') as csvfile:
+        for row in csv.reader(csvfile):
+            if not row or row[0].startswith('//'):
+                continue  # Skip comments or empty lines
+            encodings[int(row[0])] = int(row[1]) & 0x7F
+    return encodings
+
+
+def priority(c):
+    ch = chr(c)
+    if ch.isdigit():
+        return (0, c)
+    if ch.isupper():
+        return (1, c)
+    if ch.islower():
+        return (2, c)
+    return (3, c)
+
+
+def c_char(c):
+    ch = chr(c)
+    return "'\\\\'" if ch == '\\' else "'\\''" if ch == "'" else "'{}'".format(ch)
+
+
+def c_string(chars):
+    return '"' + ''.join('\\\\' if ch == '\\' else '\\"' if ch == '"' else ch for ch in chars) + '\\0"'
+
+
+def generate(encodings):
+    by_glyph = {}
+    for c, glyph in encodings.items():
+        assert glyph != 0, 'character {} has no segments on'.format(c)
+        by_glyph.setdefault(glyph, []).append(c)
+    for chars in by_glyph.values():
+        chars.sort(key=priority)
+
+    # The pool starts with an empty string for the glyphs that decode to nothing
+    pool = ['']
+    offsets = {}
+    offset = 1
+    for glyph in sorted(by_glyph):
+        chars = ''.join(chr(c) for c in by_glyph[glyph])
+        offsets[glyph] = offset
+        pool.append(chars)
+        offset += len(chars) + 1
+    assert offset <= 256, 'the candidate pool no longer fits uint8_t offsets'
+
+    lines = [BEGIN_MARKER + ' (do not edit by hand)']
+    lines.append('static const char DecodeCanonical[ASCII_7SEG_DECODE_NUM_GLYPHS] =')
+    lines.append('{')
+    for row in range(0, TABLE_SIZE, PER_LINE):
+        values = ', '.join(
+            c_char(by_glyph[g][0]) if g in by_glyph else "'\\0'" for g in range(row, row + PER_LINE))
+        sep = ',' if row + PER_LINE < TABLE_SIZE else ' '
+        lines.append('   {}{}  // 0x{:02X} - 0x{:02X}'.format(values, sep, row, row + PER_LINE - 1))
+    lines.append('};')
+    lines.append('')
+    lines.append('static const uint8_t DecodeCandidateOffsets[ASCII_7SEG_DECODE_NUM_GLYPHS] =')
+    lines.append('{')
+    for row in range(0, TABLE_SIZE, PER_LINE):
+        values = ', '.join('{:3d}'.format(offsets.get(g, 0)) for g in range(row, row + PER_LINE))
+        sep = ',' if row + PER_LINE < TABLE_SIZE else ' '
+        lines.append('   {}{}  // 0x{:02X} - 0x{:02X}'.format(values, sep, row, row + PER_LINE - 1))
+    lines.append('};')
+    lines.append('')
+    lines.append('static const char DecodeCandidatePool[] =')
+    for i, chars in enumerate(pool):
+        end = ';' if i == len(pool) - 1 else ''
+        lines.append('   {}{}'.format(c_string(chars), end))
+    lines.append(END_MARKER + ' ({} glyphs, {} of them ambiguous)'.format(
+        len(by_glyph), sum(1 for chars in by_glyph.values() if len(chars) > 1)))
+    return '\n'.join(lines)
+
+
+def write_into(path, code):
+    with open(path) as f:
+        text = f.read()
+    begin = text.index(BEGIN_MARKER)
+    end = text.index(END_MARKER, begin)
+    end = text.index('\n', end)
+    text = text[:begin] + code + text[end:]
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--csv', default=CSV_PATH)
+    parser.add_argument('--write', metavar='FILE',
+                        help='replace the generated region of FILE instead of printing')
+    args = parser.parse_args()
+
+    code = generate(read_encodings(args.csv))
+    if args.write:
+        write_into(args.write, code)
+    else:
+        print(code)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
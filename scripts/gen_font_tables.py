@@ -0,0 +1,119 @@
+"""
+Generates the glyph tables of the 14- and 16-segment fonts in
+src/ascii7seg_font.c from scripts/ascii14seg_encodings.csv. The 7-segment font
+has no table of its own: it is backed by the library's 7-segment core.
+
+Each table has one uint16_t per ASCII value, where bit s is segment s, and 0
+marks an unsupported character (every supported character has at least one
+segment on). The segment bits are:
+
+    14-segment:  A B C D E F G1 G2 H J K L M N                  (bits 0-13)
+    16-segment:  A1 A2 B C D1 D2 E F G1 G2 H J K L M N          (bits 0-15)
+
+The 16-segment glyphs are the 14-segment ones with A split into A1 + A2 and
+D into D1 + D2. Lowercase letters share the uppercase glyphs on 14 and 16
+segments.
+
+Usage:
+    python scripts/gen_font_tables.py                            # print the code
+    python scripts/gen_font_tables.py --write src/ascii7seg_font.c
+        # replace the code between the GENERATED markers in the given file
+"""
+
+import argparse
+import csv
+import sys
+
+CSV14_PATH = 'scripts/ascii14seg_encodings.csv'
+TABLE_SIZE = 128
+PER_LINE = 8
+BEGIN_MARKER = '// BEGIN GENERATED CODE: scripts/gen_font_tables.py'
+END_MARKER = '// END GENERATED CODE'
+
+SEGMENTS_14 = ['A', 'B', 'C', 'D', 'E', 'F', 'G1', 'G2', 'H', 'J', 'K', 'L', 'M', 'N']
+SEGMENTS_16 = ['A1', 'A2', 'B', 'C', 'D1', 'D2', 'E', 'F', 'G1', 'G2', 'H', 'J', 'K', 'L', 'M', 'N']
+SPLIT_16 = {'A': ['A1', 'A2'], 'D': ['D1', 'D2']}
+
+
+def read_rows(path):
+    with open(path, newline='') as csvfile:
+        for row in csv.reader(csvfile):
+            if not row or row[0].startswith('//'):
+                continue  # Skip comments or empty lines
+            yield row
+
+
+def read_14seg(path):
+    glyphs14 = {}
+    glyphs16 = {}
+    for row in read_rows(path):
+        c = int(row[0])
+        names = row[1].split()
+        assert all(name in SEGMENTS_14 for name in names), row
+        glyphs14[c] = sum(1 << SEGMENTS_14.index(name) for name in names)
+        names16 = [part for name in names for part in SPLIT_16.get(name, [name])]
+        glyphs16[c] = sum(1 << SEGMENTS_16.index(name) for name in names16)
+
+    # Lowercase letters share the uppercase glyphs
+    for c in range(ord('a'), ord('z') + 1):
+        upper = c - (ord('a') - ord('A'))
+        if upper in glyphs14 and c not in glyphs14:
+            glyphs14[c] = glyphs14[upper]
+            glyphs16[c] = glyphs16[upper]
+    return glyphs14, glyphs16
+
+
+def label(c):
+    return "'{}'".format(chr(c)) if (0x20 < c < 0x7F) and chr(c) not in "'\\" else '0x{:02X}'.format(c)
+
+
+def table(name, glyphs):
+    assert all(0 < glyph <= 0xFFFF for glyph in glyphs.values())
+    lines = ['static const uint16_t {}[ASCII_7SEG_FONT_NUM_CHARS] ='.format(name), '{']
+    for row in range(0, TABLE_SIZE, PER_LINE):
+        values = ', '.join('0x{:04X}'.format(glyphs.get(c, 0)) for c in range(row, row + PER_LINE))
+        sep = ',' if row + PER_LINE < TABLE_SIZE else ' '
+        lines.append('   {}{}  // {} - {}'.format(values, sep, label(row), label(row + PER_LINE - 1)))
+    lines.append('};')
+    return lines
+
+
+def generate(glyphs14, glyphs16):
+    lines = [BEGIN_MARKER + ' (do not edit by hand)']
+    lines += table('Font14Glyphs', glyphs14)
+    lines.append('')
+    lines += table('Font16Glyphs', glyphs16)
+    lines.append(END_MARKER + ' ({} / {} supported characters)'.format(
+        len(glyphs14), len(glyphs16)))
+    return '\n'.join(lines)
+
+
+def write_into(path, code):
+    with open(path) as f:
+        text = f.read()
+    begin = text.index(BEGIN_MARKER)
+    end = text.index(END_MARKER, begin)
+    end = text.index('\n', end)
+    text = text[:begin] + code + text[end:]
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--csv14', default=CSV14_PATH)
+    parser.add_argument('--write', metavar='FILE',
+                        help='replace the generated region of FILE instead of printing')
+    args = parser.parse_args()
+
+    glyphs14, glyphs16 = read_14seg(args.csv14)
+    code = generate(glyphs14, glyphs16)
+    if args.write:
+        write_into(args.write, code)
+    else:
+        print(code)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,105 @@
+"""
+Generates the digit and hex tables of src/ascii7seg_format.c from
+scripts/ascii7seg_encodings.csv, so that the formatted numbers are drawn with
+exactly the glyphs the rest of the library uses.
+
+Both tables hold packed encodings (bit s = segment s, a = 0 ... g = 6):
+    - HexGlyphs[hex_case][n], the 16 hex digits for each set of hex letters
+      (mixed case is A b C d E F, so that b/8 and d/0 can be told apart)
+    - DigitPairLUT[n], both digits of n (00 to 99), tens digit first
+
+Usage:
+    python scripts/gen_format_tables.py                              # print the code
+    python scripts/gen_format_tables.py --write src/ascii7seg_format.c
+        # replace the code between the GENERATED markers in the given file
+"""
+
+import argparse
+import csv
+import sys
+
+CSV_PATH = 'scripts/ascii7seg_encodings.csv'
+PAIRS_PER_LINE = 5
+BEGIN_MARKER = '// BEGIN GENERATED CODE: scripts/gen_format_tables.py'
+END_MARKER = '// END GENERATED CODE'
+
+DIGITS = '0123456789'
+HEX_CASES = (
+    ('HEX_CASE_MIXED', 'AbCdEF', ''),
+    ('HEX_CASE_UPPER', 'ABCDEF', ' (B and D look like 8 and 0)'),
+    ('HEX_CASE_LOWER', 'abcdef', ''),
+)
+
+
+def read_encodings(path):
+    encodings = {}
+    with open(path, newline='') as csvfile:
+        for row in csv.reader(csvfile):
+            if not row or row[0].startswith('//'):
+                continue  # Skip comments or empty lines
+            encodings[int(row[0])] = int(row[1]) & 0x7F
+    return encodings
+
+
+def glyph(encodings, c):
+    if ord(c) not in encodings:
+        sys.exit('{} has no encoding in the CSV'.format(c))
+    return encodings[ord(c)]
+
+
+def generate(encodings):
+    lines = [BEGIN_MARKER + ' (do not edit by hand)']
+    lines.append('static const uint8_t HexGlyphs[HEX_CASE_NUM_OF_CASES][16] =')
+    lines.append('{')
+    for i, (name, letters, note) in enumerate(HEX_CASES):
+        values = ', '.join('0x{:02X}'.format(glyph(encodings, c)) for c in DIGITS + letters)
+        sep = ',' if i + 1 < len(HEX_CASES) else ''
+        lines.append('   // 0-9 {}{}'.format(letters, note))
+        lines.append('   [{}] = {{ {} }}{}'.format(name, values, sep))
+    lines.append('};')
+    lines.append('')
+    lines.append('#ifndef ASCII_7SEG_DONT_USE_LOOKUP_TABLE')
+    lines.append('')
+    lines.append('static const uint8_t DigitPairLUT[100][2] =')
+    lines.append('{')
+    for row in range(0, 100, PAIRS_PER_LINE):
+        values = ', '.join('{{ 0x{:02X}, 0x{:02X} }}'.format(glyph(encodings, DIGITS[n // 10]),
+                                                           glyph(encodings, DIGITS[n % 10]))
+                           for n in range(row, row + PAIRS_PER_LINE))
+        sep = ',' if row + PAIRS_PER_LINE < 100 else ' '
+        lines.append('   {}{}  // {:02d} - {:02d}'.format(values, sep, row, row + PAIRS_PER_LINE - 1))
+    lines.append('};')
+    lines.append('')
+    lines.append('#endif // ASCII_7SEG_DONT_USE_LOOKUP_TABLE')
+    lines.append(END_MARKER)
+    return '\n'.join(lines)
+
+
+def write_into(path, code):
+    with open(path) as f:
+        text = f.read()
+    begin = text.index(BEGIN_MARKER)
+    end = text.index(END_MARKER, begin)
+    end = text.index('\n', end)
+    text = text[:begin] + code + text[end:]
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--csv', default=CSV_PATH)
+    parser.add_argument('--write', metavar='FILE',
+                        help='replace the generated region of FILE instead of printing')
+    args = parser.parse_args()
+
+    code = generate(read_encodings(args.csv))
+    if args.write:
+        write_into(args.write, code)
+    else:
+        print(code)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,192 @@
+"""
+Generates the lookup-table-free encoder for the full range of supported
+characters (ASCII_7SEG_DONT_USE_LOOKUP_TABLE without a range-limiting macro).
+
+Each segment is a boolean function of the 7 bits of the ASCII character. The
+72 supported characters (scripts/ascii7seg_encodings.csv) fix the function's
+value, and every other character is a don't-care, because Ascii7Seg_ConvertChar()
+rejects unsupported characters before it encodes anything. This script runs a
+two-level (sum-of-products) minimization per segment with Quine-McCluskey to
+find the prime implicants followed by an exact minimum cover, tries both the
+segment and its complement, and emits one branchless C expression per segment.
+
+Every product term comes out as a single masked compare, ((x & mask) == value),
+and the terms are OR'd together with the bitwise | so that there is no
+short-circuit evaluation (i.e., no branches) in the generated code.
+
+Usage:
+    python scripts/gen_segment_logic.py                      # print the code
+    python scripts/gen_segment_logic.py --write src/ascii7seg.c
+        # replace the code between the GENERATED markers in the given file
+"""
+
+import argparse
+import csv
+import sys
+from itertools import combinations
+
+CSV_PATH = 'scripts/ascii7seg_encodings.csv'
+NUM_BITS = 7
+SEGMENTS = 'abcdefg'
+BEGIN_MARKER = '// BEGIN GENERATED CODE: scripts/gen_segment_logic.py'
+END_MARKER = '// END GENERATED CODE'
+
+
+def read_encodings(path):
+    encodings = {}
+    with open(path, newline='') as csvfile:
+        for row in csv.reader(csvfile):
+            if not row or row[0].startswith('//'):
+                continue  # Skip comments or empty lines
+            encodings[int(row[0])] = int(row[1])
+    return encodings
+
+
+def prime_implicants(minterms):
+    """Quine-McCluskey. Implicants are (value, mask) pairs, where mask holds the
+    bits that are fixed and value holds what those bits must be."""
+    full = (1 << NUM_BITS) - 1
+    current = {(m, full) for m in minterms}
+    primes = set()
+    while current:
+        merged = set()
+        used = set()
+        for (v1, m1), (v2, m2) in combinations(current, 2):
+            if m1 != m2:
+                continue
+            diff = v1 ^ v2
+            if diff and (diff & (diff - 1)) == 0:
+                merged.add((v1 & ~diff, m1 & ~diff))
+                used.add((v1, m1))
+                used.add((v2, m2))
+        primes |= current - used
+        current = merged
+    return primes
+
+
+def covers(implicant, minterm):
+    value, mask = implicant
+    return (minterm & mask) == value
+
+
+def literal_count(implicant):
+    return bin(implicant[1]).count('1')
+
+
+def minimum_cover(primes, on_set):
+    """Exact minimum cover (fewest terms, then fewest literals) by branch and
+    bound. The problem sizes here are small enough for this to take seconds."""
+    primes = sorted(primes, key=lambda p: (-sum(covers(p, m) for m in on_set), literal_count(p)))
+    best = [None]
+
+    def cost(cover):
+        return (len(cover), sum(literal_count(p) for p in cover))
+
+    def search(uncovered, chosen):
+        if best[0] is not None and len(chosen) >= best[0][0][0] and uncovered:
+            return
+        if not uncovered:
+            c = cost(chosen)
+            if best[0] is None or c < best[0][0]:
+                best[0] = (c, list(chosen))
+            return
+        # Branch on the minterm with the fewest covering primes
+        pivot = min(uncovered, key=lambda m: sum(covers(p, m) for p in primes))
+        for p in primes:
+            if covers(p, pivot):
+                chosen.append(p)
+                search({m for m in uncovered if not covers(p, m)}, chosen)
+                chosen.pop()
+
+    search(set(on_set), [])
+    return best[0][1]
+
+
+def minimize(on_set, off_set):
+    dont_care = set(range(1 << NUM_BITS)) - on_set - off_set
+    if not on_set:
+        return []
+    return minimum_cover(prime_implicants(on_set | dont_care), on_set)
+
+
+def term_to_c(implicant):
+    value, mask = implicant
+    if mask == 0:
+        return '1u'
+    return '((x & 0x{:02X}u) == 0x{:02X}u)'.format(mask, value)
+
+
+def segment_expression(on_set, off_set):
+    cover = minimize(on_set, off_set)
+    inverse = minimize(off_set, on_set)
+    cover_cost = (len(cover), sum(literal_count(p) for p in cover))
+    inverse_cost = (len(inverse), sum(literal_count(p) for p in inverse))
+    if inverse_cost < cover_cost:
+        return '!( ' + ' | '.join(term_to_c(p) for p in inverse) + ' )', inverse
+    return '( ' + ' | '.join(term_to_c(p) for p in cover) + ' )', cover
+
+
+def generate(encodings):
+    lines = [BEGIN_MARKER + ' (do not edit by hand)']
+    lines.append('   const uint8_t x = (uint8_t)ascii_char;')
+    lines.append('')
+    total_terms = 0
+    for bit, segment in enumerate(SEGMENTS):
+        on_set = {ch for ch, enc in encodings.items() if (enc >> bit) & 1}
+        off_set = {ch for ch, enc in encodings.items() if not (enc >> bit) & 1}
+        expr, terms = segment_expression(on_set, off_set)
+        total_terms += len(terms)
+        # Self-check against the table before emitting anything
+        for ch, enc in encodings.items():
+            value = any(covers(p, ch) for p in terms)
+            if expr.startswith('!'):
+                value = not value
+            assert value == bool((enc >> bit) & 1), (segment, chr(ch))
+        prefix = '   buf->segments.{} = '.format(segment)
+        indent = len(prefix) + expr.index('(') + 2
+        lines.append(prefix + wrap(expr, indent) + ';')
+    lines.append('   ' + END_MARKER + ' ({} product terms)'.format(total_terms))
+    return '\n'.join(lines)
+
+
+def wrap(expr, indent, width=3):
+    """Puts at most `width` product terms per line to keep the output readable"""
+    terms = expr.split(' | ')
+    if len(terms) <= width:
+        return expr
+    out = []
+    for i in range(0, len(terms), width):
+        out.append(' | '.join(terms[i:i + width]))
+    return (' |\n' + ' ' * indent).join(out)
+
+
+def write_into(path, code):
+    with open(path) as f:
+        text = f.read()
+    begin = text.index(BEGIN_MARKER)
+    # Keep the indentation in front of the begin marker intact
+    end = text.index(END_MARKER, begin)
+    end = text.index('\n', end)
+    text = text[:begin] + code.lstrip() + text[end:]
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('--csv', default=CSV_PATH)
+    parser.add_argument('--write', metavar='FILE',
+                        help='replace the generated region of FILE instead of printing')
+    args = parser.parse_args()
+
+    encodings = read_encodings(args.csv)
+    code = generate(encodings)
+    if args.write:
+        write_into(args.write, code)
+    else:
+        print('   ' + code)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,179 @@
+"""
+Builds the per-variant footprint and hot-spot report from what `make profile`
+leaves in build/profile/, one directory per build named
+<target>-<variant>-<opt>, e.g. host-full-bp-Os or arm-nums-nolut-O3:
+
+    lib<name>.a          the variant's static library, not instrumented
+    gprof.txt            gprof's flat profile of the benchmark harness (host only)
+    ascii7seg.c.gcov     gcov's line counts of the core source (host only)
+
+Sizes come from nm, per symbol and per section (.text, .rodata, .data, .bss).
+The comparison table covers ascii7seg.o, which is what the variant options
+change, and the whole library, which is what gets linked if everything is used.
+
+Usage:
+    python scripts/profile_report.py build/profile/                # print the report
+    python scripts/profile_report.py build/profile/ --readme README.md
+        # also replace the table between the GENERATED markers in README.md
+"""
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+
+CORE_OBJECT = 'ascii7seg.o'
+CORE_SOURCE = 'ascii7seg.c.gcov'
+SECTIONS = ['text', 'rodata', 'data', 'bss']
+NM_SECTIONS = {'t': 'text', 'r': 'rodata', 'd': 'data', 'b': 'bss'}
+TOOL_PREFIXES = {'host': '', 'arm': 'arm-none-eabi-'}
+RANGES = ['nums', 'numerr', 'full']
+NUM_HOT_SPOTS = 5
+BEGIN_MARKER = '<!-- BEGIN GENERATED TABLE: scripts/profile_report.py'
+END_MARKER = '<!-- END GENERATED TABLE -->'
+BUILD_NAME = re.compile(r'^(host|arm)-(.+)-(O[0-3s])$')
+
+
+def symbol_sizes(prefix, archive):
+    """{object: [(section, symbol, size)]} of every sized symbol in the archive."""
+    out = subprocess.run([prefix + 'nm', '-S', '--size-sort', '-t', 'd', archive],
+                         capture_output=True, text=True, check=True).stdout
+    objects = {}
+    current = None
+    for line in out.splitlines():
+        if line.endswith('.o:'):
+            current = objects.setdefault(line[:-1], [])
+            continue
+        fields = line.split()
+        if current is None or len(fields) != 4:
+            continue
+        section = NM_SECTIONS.get(fields[2].lower())
+        if section is not None:
+            current.append((section, fields[3], int(fields[1])))
+    return objects
+
+
+def totals(symbols):
+    sums = dict.fromkeys(SECTIONS, 0)
+    for section, _, size in symbols:
+        sums[section] += size
+    return sums
+
+
+def gprof_hot_spots(path):
+    """[(% time, self calls, function)] of the flat profile, hottest first."""
+    if not os.path.exists(path):
+        return []
+    spots = []
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            # %time, cumulative s, self s, [calls, self ms/call, total ms/call,] name
+            if len(fields) in (4, 7) and re.match(r'^\d+\.\d+$', fields[0]):
+                calls = fields[3] if len(fields) == 7 else '-'
+                spots.append((float(fields[0]), calls, fields[-1]))
+    return spots[:NUM_HOT_SPOTS]
+
+
+def gcov_hot_spots(path):
+    """[(count, line number, source)] of the most executed lines, hottest first."""
+    if not os.path.exists(path):
+        return []
+    lines = []
+    with open(path) as f:
+        for line in f:
+            parts = line.split(':', 2)
+            if len(parts) == 3 and parts[0].strip().rstrip('*').isdigit():
+                lines.append((int(parts[0].strip().rstrip('*')), int(parts[1]), parts[2].strip()))
+    lines.sort(key=lambda l: -l[0])
+    return lines[:NUM_HOT_SPOTS]
+
+
+def build_order(build):
+    """Host first, then by range, layout, lookup table, and -Os before -O3."""
+    variant = build['variant']
+    rng = variant.split('-')[0]
+    rng_idx = RANGES.index(rng) if rng in RANGES else len(RANGES)
+    return (build['target'] != 'host', rng_idx, '-bp' in variant, '-nolut' in variant,
+            variant, build['opt'] != '-Os')
+
+
+def collect(profile_dir, lib_name):
+    builds = []
+    for name in sorted(os.listdir(profile_dir)):
+        match = BUILD_NAME.match(name)
+        archive = os.path.join(profile_dir, name, 'lib{}.a'.format(lib_name))
+        if not match or not os.path.exists(archive):
+            continue
+        target, variant, opt = match.groups()
+        objects = symbol_sizes(TOOL_PREFIXES[target], archive)
+        builds.append({
+            'name': name, 'target': target, 'variant': variant, 'opt': '-' + opt,
+            'core': totals(objects.get(CORE_OBJECT, [])),
+            'all': totals([s for symbols in objects.values() for s in symbols]),
+            'symbols': sorted(objects.get(CORE_OBJECT, []), key=lambda s: -s[2]),
+            'gprof': gprof_hot_spots(os.path.join(profile_dir, name, 'gprof.txt')),
+            'gcov': gcov_hot_spots(os.path.join(profile_dir, name, CORE_SOURCE)),
+        })
+    return sorted(builds, key=build_order)
+
+
+def comparison_table(builds):
+    lines = ['| Target | Variant | Opt | ascii7seg.o .text | .rodata | .data | .bss | Whole lib .text | .rodata |',
+             '|--------|---------|-----|------------------:|--------:|------:|-----:|----------------:|--------:|']
+    for b in builds:
+        lines.append('| {} | `{}` | `{}` | {} B | {} B | {} B | {} B | {} B | {} B |'.format(
+            b['target'], b['variant'], b['opt'],
+            b['core']['text'], b['core']['rodata'], b['core']['data'], b['core']['bss'],
+            b['all']['text'], b['all']['rodata']))
+    return lines
+
+
+def report(builds):
+    lines = ['# Per-Variant Footprint and Profile', '', '## Comparison', '']
+    lines += comparison_table(builds)
+    for b in builds:
+        lines += ['', '## {}'.format(b['name']), '', '| Symbol | Section | Size |', '|--------|---------|-----:|']
+        lines += ['| `{}` | .{} | {} B |'.format(sym, section, size) for section, sym, size in b['symbols']]
+        if b['gprof']:
+            lines += ['', 'gprof (benchmark harness):', '', '| % time | Calls | Function |', '|-------:|------:|----------|']
+            lines += ['| {:.2f} | {} | `{}` |'.format(pct, calls, fn) for pct, calls, fn in b['gprof']]
+        if b['gcov']:
+            lines += ['', 'gcov, hottest lines of ascii7seg.c:', '', '| Count | Line | Source |', '|------:|-----:|--------|']
+            lines += ['| {} | {} | `{}` |'.format(count, num, src.replace('|', '\\|')) for count, num, src in b['gcov']]
+    return '\n'.join(lines)
+
+
+def write_readme(path, builds):
+    with open(path) as f:
+        text = f.read()
+    begin = text.index(BEGIN_MARKER)
+    begin = text.index('\n', begin) + 1
+    end = text.index(END_MARKER, begin)
+    text = text[:begin] + '\n'.join(comparison_table(builds)) + '\n' + text[end:]
+    with open(path, 'w') as f:
+        f.write(text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('profile_dir')
+    parser.add_argument('--lib', default='ascii7seg', help='library name, without lib and .a')
+    parser.add_argument('--readme', metavar='FILE',
+                        help='replace the generated comparison table of FILE too')
+    args = parser.parse_args()
+
+    builds = collect(args.profile_dir, args.lib)
+    if not builds:
+        print('No builds in {}. Run `make profile` first.'.format(args.profile_dir), file=sys.stderr)
+        return 1
+
+    print(report(builds))
+    if args.readme:
+        write_readme(args.readme, builds)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
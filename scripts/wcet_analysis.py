@@ -0,0 +1,569 @@
+"""
+Static worst-case (and best-case) execution time of the API functions of the
+ARM builds of the library, from their disassembly. `make test-mcu-builds`
+keeps each variant's library in build/mcu/<variant>/, e.g. build/mcu/full-bp/:
+
+    lib<name>.a          the variant's static library, built for the MCU
+
+Each function's control-flow graph is built from `objdump -dr`, and the longest
+and shortest paths through it are weighed with the Cortex-M0+ and Cortex-M4
+instruction timings of their Technical Reference Manuals (zero wait state
+memory, no interrupts). Calls to other functions of the library add the
+callee's bounds; anything that can't be bounded statically (indirect branches
+or calls, jump tables, calls out of the library, nested loops) is reported as
+unbounded along with why.
+
+Loops are cut at their back edges. For a function with loops, the bound is
+`wcet + iter * n`: wcet covers entry to return taking no back edge, iter is
+the worst single iteration of any of its loops, and n is the total number of
+iterations (e.g., characters converted).
+
+The report covers every API function, but plenty of them are unbounded by
+design (they call through a function pointer, e.g. a transport or the encoder's
+kernel, or call memcpy and the like). Only the functions given with --check,
+the leaf functions that ISR budgets rely on, are checked against stored bounds.
+
+With --bounds, the bound of every checked function is compared with the stored
+one, and the script fails if any got worse (or became unbounded). It also fails
+if a built variant or checked function has no stored bound, or if its stored
+bound is unbounded, since none of those would ever be checked. --update
+rewrites the stored bounds from this build instead, which is also how they are
+seeded, and fails if a checked function can't be bounded.
+
+Usage:
+    python scripts/wcet_analysis.py build/mcu/                        # print the report
+    python scripts/wcet_analysis.py build/mcu/ --check Ascii7Seg_ConvertChar \
+        --bounds scripts/wcet_bounds.csv [--update]
+"""
+
+import argparse
+import csv
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+CORES = ['cortex-m0plus', 'cortex-m4']
+CONDITIONS = ['eq', 'ne', 'cs', 'hs', 'cc', 'lo', 'mi', 'pl', 'vs', 'vc',
+              'hi', 'ls', 'ge', 'lt', 'gt', 'le', 'al']
+COND_BRANCHES = {'b' + cc for cc in CONDITIONS}
+ALU = {'add', 'adc', 'sub', 'sbc', 'rsb', 'mov', 'mvn', 'and', 'orr', 'orn',
+       'eor', 'bic', 'cmp', 'cmn', 'tst', 'teq', 'lsl', 'lsr', 'asr', 'ror',
+       'rrx', 'neg', 'sxtb', 'sxth', 'uxtb', 'uxth', 'sxtab', 'sxtah', 'uxtab',
+       'uxtah', 'rev', 'rev16', 'revsh', 'rbit', 'clz', 'adr', 'movw', 'movt',
+       'bfi', 'bfc', 'ubfx', 'sbfx', 'ssat', 'usat', 'sel', 'nop', 'cpsid', 'cpsie'}
+MULTIPLY = {'mul', 'mla', 'mls', 'smull', 'umull', 'smlal', 'umlal'}
+DIVIDE = {'sdiv', 'udiv'}
+LOADS = {'ldr', 'ldrb', 'ldrh', 'ldrsb', 'ldrsh', 'ldrex', 'ldrexb', 'ldrexh'}
+STORES = {'str', 'strb', 'strh', 'strex', 'strexb', 'strexh'}
+DOUBLES = {'ldrd', 'strd'}
+MULTIPLES = {'ldm', 'ldmia', 'ldmfd', 'ldmdb', 'stm', 'stmia', 'stmea', 'stmdb', 'stmfd', 'push', 'pop'}
+BARRIERS = {'dmb', 'dsb', 'isb'}
+BRANCHES = {'b', 'bl', 'blx', 'bx', 'cbz', 'cbnz', 'tbb', 'tbh'}
+KNOWN = ALU | MULTIPLY | DIVIDE | LOADS | STORES | DOUBLES | MULTIPLES | BARRIERS | BRANCHES
+IT_BLOCK = re.compile(r'^it[te]{0,3}$')
+DATA = {'.word', '.short', '.byte', '.inst', '<unknown>'}
+
+# Pipeline refill after a taken branch on the Cortex-M4, 1 to 3 cycles
+# depending on alignment and on whether the target is a load
+M4_REFILL = (1, 3)
+# The Cortex-M0+ multiplier is either single-cycle or 32-cycle iterative,
+# chosen by the silicon vendor. Set this to 32 for the latter
+M0PLUS_MULTIPLY_CYCLES = 1
+
+BOUND_FIELDS = ['variant', 'function', 'core', 'wcet_cycles', 'iter_cycles', 'wcet_instructions']
+HEADER = re.compile(r'^([0-9a-f]+) <([^>]+)>:$')
+MEMBER = re.compile(r'^(?:.*\()?([^()\s]+\.o)\)?:\s+file format')
+SECTION = re.compile(r'^Disassembly of section (\S+):$')
+RELOC = re.compile(r'^\s+([0-9a-f]+):\s+(R_ARM_\w+)\s+(\S+)')
+INSN = re.compile(r'^\s*([0-9a-f]+):(.*)$')
+TARGET = re.compile(r'(?:^|,\s*)(?:0x)?([0-9a-f]+)\s+<([^>+]+)(?:\+0x[0-9a-f]+)?>')
+GLOBAL_FUNCTION = re.compile(r'^[0-9a-f]+\s+g\s.*\sF\s+\S+\s+[0-9a-f]+\s+(\S+)$')
+EXIT = 'exit'
+# Costs are (best, worst cycles, best, worst instructions)
+NOTHING = (0, 0, 0, 0)
+
+
+class Unbounded(Exception):
+    pass
+
+
+class Insn:
+    def __init__(self, addr, mnemonic, operands):
+        self.addr = addr
+        self.mnemonic = mnemonic.split('.')[0]   # without a .n/.w width
+        self.base = base_mnemonic(self.mnemonic)
+        self.operands = operands
+        self.reloc = None         # symbol of the relocation at this address, if any
+        self.next = None          # address of the following instruction
+
+    def registers(self):
+        match = re.search(r'\{([^}]*)\}', self.operands)
+        regs = []
+        for part in (match.group(1).split(',') if match else []):
+            part = part.strip()
+            if '-' in part:
+                lo, hi = (int(r.strip()[1:]) for r in part.split('-'))
+                regs += ['r{}'.format(r) for r in range(lo, hi + 1)]
+            elif part:
+                regs.append(part)
+        return regs
+
+    def target(self):
+        match = TARGET.search(self.operands)
+        return (int(match.group(1), 16), match.group(2)) if match else (None, None)
+
+    def kind(self):
+        """What the instruction does to the control flow."""
+        m, base, ops = self.mnemonic, self.base, self.operands
+        conditional = m not in (base, base + 's')
+        if m in COND_BRANCHES or m in ('cbz', 'cbnz'):
+            return 'cond'
+        if m == 'b':
+            return 'jump'
+        if m in ('bl', 'blx') and TARGET.search(ops):
+            return 'call'
+        returns = ((base == 'bx' and ops == 'lr') or
+                   (base in MULTIPLES and 'pc' in self.registers()) or
+                   (base == 'ldr' and ops.startswith('pc, [sp]')) or
+                   (base == 'mov' and ops == 'pc, lr'))
+        if returns:
+            return 'cond-return' if conditional else 'return'
+        if base in ('bx', 'blx', 'tbb', 'tbh') or ops.startswith('pc,'):
+            return 'indirect'
+        return 'plain'
+
+
+def base_mnemonic(mnemonic):
+    """The mnemonic without a flag-setting s or an IT block condition, e.g.
+    lsls -> lsl, popeq -> pop, movseq -> mov (or as is if it isn't known)."""
+    for suffix in [''] + ['s'] + CONDITIONS + ['s' + cc for cc in CONDITIONS]:
+        candidate = mnemonic[:len(mnemonic) - len(suffix)]
+        if mnemonic.endswith(suffix) and (candidate in KNOWN or IT_BLOCK.match(candidate)):
+            return candidate
+    return mnemonic
+
+
+def cost(insn, core, outcome='fall'):
+    """(best, worst) cycles of insn on core, for branches given the outcome."""
+    m = insn.base
+    m0 = core == 'cortex-m0plus'
+    refill = (2, 2) if m0 else (1 + M4_REFILL[0], 1 + M4_REFILL[1])
+    kind = insn.kind()
+    if kind in ('cond', 'cond-return') and outcome != 'taken':
+        return (1, 1)
+    if kind in ('cond', 'jump'):
+        return refill
+    if kind == 'call':
+        return (3, 3) if m0 else refill
+    if m in MULTIPLES:
+        regs = insn.registers()
+        if 'pc' in regs:
+            # 3 + N on the M0+ with N not counting the PC, 1 + N + P on the M4
+            return (2 + len(regs), 2 + len(regs)) if m0 else (len(regs) + refill[0], len(regs) + refill[1])
+        return (1 + len(regs), 1 + len(regs))
+    if kind in ('return', 'cond-return'):   # bx lr, mov pc, lr or ldr pc, [sp], #4
+        return refill if m in ('bx', 'mov') else ((4, 4) if m0 else (2 + M4_REFILL[0], 2 + M4_REFILL[1]))
+    if IT_BLOCK.match(m):
+        return (0, 1)   # Folded into the previous instruction when it can be
+    if m in ALU:
+        return (1, 1)
+    if m in MULTIPLY:
+        return (M0PLUS_MULTIPLY_CYCLES, M0PLUS_MULTIPLY_CYCLES) if m0 else (1, 1)
+    if m in DIVIDE and not m0:
+        return (2, 12)
+    if m in LOADS or m in STORES:
+        return (2, 2) if m0 else (1, 2)
+    if m in DOUBLES and not m0:
+        return (2, 3)
+    if m in BARRIERS:
+        return (3, 3) if m0 else (1, 4)
+    raise Unbounded('no {} timing for `{}`'.format(core, insn.mnemonic))
+
+
+def disassemble(objdump, archive):
+    """{(object, function): [Insn]} of every function in the archive."""
+    out = subprocess.run(objdump + ['-dr', archive], capture_output=True, text=True, check=True).stdout
+    functions = {}
+    member, function, in_code, last = None, None, False, None
+    for line in out.splitlines():
+        match = MEMBER.match(line)
+        if match or SECTION.match(line):
+            member = match.group(1) if match else member
+            function, in_code, last = None, False, None
+            continue
+        match = HEADER.match(line)
+        if match:
+            name = match.group(2)
+            if not name.startswith('$'):
+                function, in_code, last = (member, name), True, None
+                functions[function] = []
+            else:
+                # Mapping symbols: $d starts a literal pool, $t the code after it
+                in_code = function is not None and name.startswith('$t')
+            continue
+        match = RELOC.match(line)
+        if match:
+            if last is not None and int(match.group(1), 16) == last.addr:
+                last.reloc = match.group(3)
+            continue
+        match = INSN.match(line)
+        if not match or not in_code:
+            continue
+        # Raw bytes, then a tab, then the mnemonic and its operands
+        _, _, text = match.group(2).lstrip('\t').partition('\t')
+        mnemonic, _, operands = text.strip().partition('\t')
+        operands = re.split(r'\s+[@;]', operands)[0].strip()
+        if not mnemonic or mnemonic in DATA:
+            continue
+        insn = Insn(int(match.group(1), 16), mnemonic, operands)
+        if last is not None:
+            last.next = insn.addr
+        functions[function].append(insn)
+        last = insn
+    return {key: insns for key, insns in functions.items() if insns}
+
+
+def global_functions(objdump, archive):
+    out = subprocess.run(objdump + ['-t', archive], capture_output=True, text=True, check=True).stdout
+    return [m.group(1) for m in map(GLOBAL_FUNCTION.match, out.splitlines()) if m]
+
+
+class Analysis:
+    """Bounds of every function of one archive, on one core."""
+
+    def __init__(self, functions, core):
+        self.functions = functions
+        self.core = core
+        self.bounds = {}
+        self.in_progress = set()
+
+    def callee(self, obj, name):
+        if (obj, name) in self.functions:
+            return (obj, name)
+        matches = [key for key in self.functions if key[1] == name]
+        if len(matches) != 1:
+            raise Unbounded('calls `{}`, which is not in the library'.format(name))
+        return matches[0]
+
+    def call_cost(self, obj, insn):
+        """(best, worst cycles, best, worst instructions) of what insn calls."""
+        name = insn.reloc or insn.target()[1]
+        bounds = self.of(self.callee(obj, name))
+        if bounds['iter'] is not None:
+            raise Unbounded('calls `{}`, which loops'.format(name))
+        return bounds['bcet'], bounds['wcet'], bounds['bcet_insns'], bounds['wcet_insns']
+
+    def of(self, key):
+        if key in self.bounds:
+            if isinstance(self.bounds[key], Unbounded):
+                raise Unbounded('calls `{}`, which is unbounded'.format(key[1]))
+            return self.bounds[key]
+        if key in self.in_progress:
+            raise Unbounded('`{}` is recursive'.format(key[1]))
+        self.in_progress.add(key)
+        try:
+            self.bounds[key] = self.analyse(key)
+        except Unbounded as e:
+            self.bounds[key] = e
+            raise
+        finally:
+            self.in_progress.discard(key)
+        return self.bounds[key]
+
+    def analyse(self, key):
+        obj, name = key
+        insns = self.functions[key]
+        by_addr = {i.addr: i for i in insns}
+
+        # Basic blocks start at the entry, at branch targets, and after branches
+        leaders = {insns[0].addr}
+        for i in insns:
+            kind = i.kind()
+            if kind == 'indirect':
+                raise Unbounded('indirect branch `{} {}` at 0x{:x}'.format(i.mnemonic, i.operands, i.addr))
+            if kind in ('cond', 'jump'):
+                addr, sym = i.target()
+                if i.reloc is None and sym == name:
+                    if addr not in by_addr:
+                        raise Unbounded('branch into data at 0x{:x}'.format(i.addr))
+                    leaders.add(addr)
+            if kind not in ('plain', 'call') and i.next is not None:
+                leaders.add(i.next)
+
+        # Each block: its body cost (every instruction but a branch at its
+        # end, calls included) and its out edges with the cost of taking them
+        blocks = {}
+        for leader in sorted(leaders):
+            body = NOTHING
+            edges = []
+            i = by_addr[leader]
+            while True:
+                kind = i.kind()
+                if kind in ('plain', 'call'):
+                    body = add(body, cost(i, self.core) + (1, 1))
+                    if kind == 'call':
+                        body = add(body, self.call_cost(obj, i))
+                    if i.next is None:
+                        raise Unbounded('falls off the end at 0x{:x}'.format(i.addr))
+                    if i.next in leaders:
+                        edges.append((i.next, NOTHING))
+                        break
+                    i = by_addr[i.next]
+                    continue
+
+                taken = cost(i, self.core, 'taken') + (1, 1)
+                not_taken = cost(i, self.core, 'fall') + (1, 1)
+                if kind in ('return', 'cond-return'):
+                    edges.append((EXIT, taken))
+                    if kind == 'cond-return':
+                        edges.append((i.next, not_taken))
+                    break
+                addr, sym = i.target()
+                if i.reloc is not None or sym != name:
+                    # A tail call: the branch, the callee, and then its return
+                    edges.append((EXIT, add(taken, self.call_cost(obj, i))))
+                else:
+                    edges.append((addr, taken))
+                if kind == 'cond':
+                    edges.append((i.next, not_taken))
+                break
+            blocks[leader] = (body, edges)
+
+        return bound_paths(insns[0].addr, blocks)
+
+
+def add(*costs):
+    return tuple(map(sum, zip(*costs)))
+
+
+def bound_paths(entry, blocks):
+    """Longest and shortest entry-to-exit paths, with loops cut at back edges."""
+    back_edges, order, state = [], [], {}
+
+    def visit(node):
+        state[node] = 'open'
+        for succ, _ in blocks[node][1]:
+            if succ == EXIT:
+                continue
+            if state.get(succ) == 'open':
+                back_edges.append((node, succ))
+            elif succ not in state:
+                visit(succ)
+        state[node] = 'done'
+        order.append(node)
+
+    visit(entry)
+    order.reverse()   # Topological order of the graph without its back edges
+
+    def paths(source, sink, pick):
+        """pick-est cost of every field from source to sink (the exit if None)."""
+        reach = {source: NOTHING}
+        found = None
+        for node in order:
+            if node not in reach:
+                continue
+            body, edges = blocks[node]
+            here = add(reach[node], body)
+            if sink is not None and node == sink:
+                found = here if found is None else tuple(map(pick, found, here))
+                continue
+            for succ, edge in edges:
+                if (node, succ) in back_edges:
+                    continue
+                total = add(here, edge)
+                if succ == EXIT:
+                    if sink is None:
+                        found = total if found is None else tuple(map(pick, found, total))
+                elif succ in reach:
+                    reach[succ] = tuple(map(pick, reach[succ], total))
+                else:
+                    reach[succ] = total
+        return found
+
+    best = paths(entry, None, min)
+    worst = paths(entry, None, max)
+    if best is None:
+        raise Unbounded('never returns')
+
+    iteration = None
+    headers = {h for _, h in back_edges}
+    for tail, header in back_edges:
+        body = loop_body(blocks, header, tail)
+        if (headers & body) - {header}:
+            raise Unbounded('nested loops')
+        edge = [e for s, e in blocks[tail][1] if s == header][0]
+        one = paths(header, tail, max)
+        iteration = max(iteration or 0, one[1] + edge[1])
+
+    return {'bcet': best[0], 'wcet': worst[1], 'bcet_insns': best[2], 'wcet_insns': worst[3], 'iter': iteration}
+
+
+def loop_body(blocks, header, tail):
+    """The blocks of the natural loop of the back edge tail -> header."""
+    preds = {}
+    for node, (_, edges) in blocks.items():
+        for succ, _ in edges:
+            preds.setdefault(succ, set()).add(node)
+    body, work = {header, tail}, [tail]
+    while work:
+        for pred in preds.get(work.pop(), ()):
+            if pred not in body:
+                body.add(pred)
+                work.append(pred)
+    return body
+
+
+def collect(mcu_dir, lib_name, objdump, prefix, cores):
+    """{variant: {(function, core): bounds or Unbounded}} of every kept build."""
+    results = {}
+    for variant in sorted(os.listdir(mcu_dir)):
+        archive = os.path.join(mcu_dir, variant, 'lib{}.a'.format(lib_name))
+        if not os.path.exists(archive):
+            continue
+        functions = disassemble(objdump, archive)
+        api = [f for f in global_functions(objdump, archive) if f.startswith(prefix)]
+        results[variant] = {}
+        for core in cores:
+            analysis = Analysis(functions, core)
+            for key in sorted(functions, key=lambda k: (k[0], functions[k][0].addr)):
+                if key[1] not in api:
+                    continue
+                try:
+                    results[variant][(key[1], core)] = analysis.of(key)
+                except Unbounded as e:
+                    results[variant][(key[1], core)] = e
+    return results
+
+
+def report(results):
+    lines = ['# Worst-Case Execution Time', '']
+    for variant, bounds in results.items():
+        lines += ['## {}'.format(variant), '',
+                  '| Function | Core | BCET cycles | WCET cycles | + cycles/iteration | Instructions |',
+                  '|----------|------|------------:|------------:|-------------------:|-------------:|']
+        for (function, core), b in bounds.items():
+            if isinstance(b, Unbounded):
+                lines.append('| `{}` | {} | - | unbounded: {} | - | - |'.format(function, core, b))
+            else:
+                lines.append('| `{}` | {} | {} | {} | {} | {} - {} |'.format(
+                    function, core, b['bcet'], b['wcet'], '-' if b['iter'] is None else b['iter'],
+                    b['bcet_insns'], b['wcet_insns']))
+        lines.append('')
+    return '\n'.join(lines)
+
+
+def as_row(variant, function, core, b):
+    bounded = not isinstance(b, Unbounded)
+    return {'variant': variant, 'function': function, 'core': core,
+            'wcet_cycles': b['wcet'] if bounded else '',
+            'iter_cycles': b['iter'] if bounded and b['iter'] is not None else '',
+            'wcet_instructions': b['wcet_insns'] if bounded else ''}
+
+
+def checked(results, functions, cores):
+    """results with only the bounds of the given functions, and messages for
+    any of them that a variant doesn't have."""
+    missing = ['{} {} on {}: not in the library'.format(variant, function, core)
+               for variant, bounds in results.items()
+               for function in functions for core in cores if (function, core) not in bounds]
+    return {variant: {key: b for key, b in bounds.items() if key[0] in functions}
+            for variant, bounds in results.items()}, missing
+
+
+def check(results, path):
+    """Messages for every bound that got worse than the stored one, or that
+    can't be checked because there is no stored bound to check it against."""
+    with open(path) as f:
+        stored = {(r['variant'], r['function'], r['core']): r for r in csv.DictReader(f)}
+    stored_variants = {variant for variant, _, _ in stored}
+    regressions = []
+    for variant, bounds in results.items():
+        if variant not in stored_variants:
+            regressions.append('{}: no stored bounds for this variant'.format(variant))
+            continue
+        for (function, core), b in bounds.items():
+            old = stored.get((variant, function, core))
+            if old is None:
+                regressions.append('{} {} on {}: no stored bound'.format(variant, function, core))
+                continue
+            if old['wcet_cycles'] == '':
+                regressions.append('{} {} on {}: stored as unbounded, so it is never checked{}'.format(
+                    variant, function, core, ', and still is: {}'.format(b) if isinstance(b, Unbounded) else ''))
+                continue
+            if isinstance(b, Unbounded):
+                regressions.append('{} {} on {}: now unbounded, {}'.format(variant, function, core, b))
+                continue
+            new = as_row(variant, function, core, b)
+            for field in BOUND_FIELDS[3:]:
+                # A function that didn't loop had 0 cycles per iteration
+                if int(new[field] or 0) > int(old[field] or 0):
+                    regressions.append('{} {} on {}: {} {} -> {}'.format(
+                        variant, function, core, field, old[field] or 0, new[field]))
+    return regressions
+
+
+def update(results, path):
+    """Rewrites the stored bounds, or returns why not if any is unbounded."""
+    unbounded = ['{} {} on {}: {}'.format(variant, function, core, b)
+                 for variant, bounds in results.items() for (function, core), b in bounds.items()
+                 if isinstance(b, Unbounded)]
+    if unbounded:
+        return unbounded
+    rows = [as_row(variant, function, core, b)
+            for variant, bounds in results.items() for (function, core), b in bounds.items()]
+    with open(path, 'w', newline='') as f:
+        writer = csv.DictWriter(f, fieldnames=BOUND_FIELDS, lineterminator='\n')
+        writer.writeheader()
+        writer.writerows(rows)
+    return []
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    parser.add_argument('mcu_dir')
+    parser.add_argument('--lib', default='ascii7seg', help='library name, without lib and .a')
+    parser.add_argument('--prefix', default='Ascii7Seg_', help='prefix of the API functions to bound')
+    parser.add_argument('--objdump', default='arm-none-eabi-objdump',
+                        help='objdump command (e.g. "llvm-objdump --mcpu=cortex-m0plus")')
+    parser.add_argument('--core', choices=CORES, action='append',
+                        help='core whose timings to use (repeatable; default: all of them)')
+    parser.add_argument('--check', metavar='FUNCTION', action='append', default=[],
+                        help='function whose bounds to check or update (repeatable)')
+    parser.add_argument('--bounds', metavar='FILE', help='stored bounds to check against')
+    parser.add_argument('--update', action='store_true', help='rewrite the stored bounds instead of checking')
+    args = parser.parse_args()
+
+    results = collect(args.mcu_dir, args.lib, shlex.split(args.objdump), args.prefix,
+                      args.core or CORES)
+    if not results:
+        print('No builds in {}. Run `make test-mcu-builds` first.'.format(args.mcu_dir), file=sys.stderr)
+        return 1
+
+    print(report(results))
+    if args.bounds and not args.check:
+        print('--bounds needs at least one --check function.', file=sys.stderr)
+        return 1
+    results, missing = checked(results, args.check, args.core or CORES)
+    if args.bounds and args.update:
+        # Nothing is written unless every checked function can be bounded
+        unbounded = missing or update(results, args.bounds)
+        for u in unbounded:
+            print('WCET update failed: ' + u, file=sys.stderr)
+        if unbounded:
+            print('Only functions of the library that can be bounded can be checked.', file=sys.stderr)
+            return 1
+    elif args.bounds:
+        regressions = missing + check(results, args.bounds)
+        for r in regressions:
+            print('WCET check failed: ' + r, file=sys.stderr)
+        if regressions:
+            print('If this is expected, (re-)record the bounds with `make wcet-update`. '
+                  'An unbounded function has to be made boundable first.', file=sys.stderr)
+            return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
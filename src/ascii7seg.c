@@ -7,35 +7,260 @@
  * @copyright MIT License
  */
 
+/**
+ * Built with ASCII_7SEG_KERNEL=<name> (see ASCII_7SEG_RUNTIME_DISPATCH), this
+ * file is one kernel of ascii7seg_encoder.h: the same API, for the range and
+ * strategy the build gave it, under Ascii7Seg_Kernel<name>_...() names so that
+ * all of the kernels can be linked into one library.
+ */
+#ifdef ASCII_7SEG_KERNEL
+#define ASCII_7SEG_KERNEL_SYMBOL(kernel, suffix)   ASCII_7SEG_KERNEL_SYMBOL_(kernel, suffix)
+#define ASCII_7SEG_KERNEL_SYMBOL_(kernel, suffix)  Ascii7Seg_Kernel ## kernel ## suffix
+#define Ascii7Seg_ConvertChar       ASCII_7SEG_KERNEL_SYMBOL(ASCII_7SEG_KERNEL, _ConvertChar)
+#define Ascii7Seg_ConvertWord       ASCII_7SEG_KERNEL_SYMBOL(ASCII_7SEG_KERNEL, _ConvertWord)
+#define Ascii7Seg_ConvertBytes      ASCII_7SEG_KERNEL_SYMBOL(ASCII_7SEG_KERNEL, _ConvertBytes)
+#define Ascii7Seg_IsSupportedChar   ASCII_7SEG_KERNEL_SYMBOL(ASCII_7SEG_KERNEL, _IsSupportedChar)
+#define Ascii7Seg_ConvertWordEx     ASCII_7SEG_KERNEL_SYMBOL(ASCII_7SEG_KERNEL, _ConvertWordEx)
+#define Ascii7Seg_TestForceBulkKernel  ASCII_7SEG_KERNEL_SYMBOL(ASCII_7SEG_KERNEL, _TestForceBulkKernel)
+#endif // ASCII_7SEG_KERNEL
+
 /* File Inclusions */
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <assert.h>
-#include <ctype.h>
 #include <limits.h>
+#include <string.h>
 #include "ascii7seg.h"
 #include "ascii7seg_config.h"
+#include "ascii7seg_pack.h"
+#ifdef TEST
+#include "ascii7seg_test.h"
+#endif
+#ifdef ASCII_7SEG_KERNEL
+#include "ascii7seg_encoder.h"
+#endif
 
 /* Local Macro Definitions */
 
+/**
+ * The vectorized bulk conversion path is only compiled in for the full range,
+ * lookup table variant of the library, because that is the variant where the
+ * entire encoding table, bit-packed, is a flat 128-byte array that fits in a
+ * few vector registers. Without bit-packing, the kernels look up the packed
+ * encodings and expand each one into 8 bools, which is only a whole number of
+ * vector stores with ASCII_7SEG_PAD_TO_8_BYTES. It also requires an x86 host and
+ * a compiler that supports per-function target attributes (GCC or clang), so
+ * that the SSSE3/AVX2/AVX-512 kernels can live alongside the baseline code
+ * without special build flags.
+ */
+#if ( defined(ASCII_7SEG_BIT_PACK) || defined(ASCII_7SEG_PAD_TO_8_BYTES) ) && \
+    !defined(ASCII_7SEG_NO_SIMD) && \
+    !defined(ASCII_7SEG_NUMS_ONLY) && !defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY) && \
+    !defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE) && \
+    !defined(ASCII_7SEG_USE_PERFECT_HASH) && \
+    (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define ASCII_7SEG_SIMD_X86
+#include <immintrin.h>
+#endif
+
+/**
+ * The numeric variants of the library convert words using SIMD-within-a-register
+ * (SWAR): a machine word's worth of characters is range checked at once and, in
+ * the bit-packed layout, the encodings are written back with a single word store.
+ * This is plain C, so it benefits MCU targets without a vector unit just as well.
+ */
+#if defined(ASCII_7SEG_NUMS_ONLY) || defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+#define ASCII_7SEG_SWAR
+
+#if (UINTPTR_MAX > UINT32_MAX)
+typedef uint64_t SwarWord_T;
+#define SWAR_ONES    UINT64_C(0x0101010101010101)
+#else
+typedef uint32_t SwarWord_T;
+#define SWAR_ONES    UINT32_C(0x01010101)
+#endif
+
+#define SWAR_LANES   sizeof(SwarWord_T)
+#define SWAR_HIGHS   ( SWAR_ONES * 0x80u )
+#define SWAR_LOWS    ( SWAR_ONES * 0x7Fu )
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define SWAR_LANE_SHIFT(lane)  ( 8u * (SWAR_LANES - 1u - (lane)) )
+#else
+#define SWAR_LANE_SHIFT(lane)  ( 8u * (lane) )
+#endif
+
+#endif // ASCII_7SEG_NUMS_ONLY || ASCII_7SEG_NUMS_AND_ERROR_ONLY
+
 // Constant-like macros
 
 // Function-like macros
 
+#ifdef ASCII_7SEG_SWAR
+/**
+ * Sets the top bit of every byte lane of x that is strictly between m and n,
+ * and clears it in every other lane, with no carries between lanes.
+ * Requires 0 <= m <= 127 and 0 <= n <= 128. See "Determine if a word has a byte
+ * between m and n" in Sean Eron Anderson's Bit Twiddling Hacks.
+ */
+#define SWAR_BETWEEN(x, m, n) \
+   ( ( (SWAR_ONES * (127u + (n))) - ((x) & SWAR_LOWS) ) & \
+     ~(x) & \
+     ( ((x) & SWAR_LOWS) + (SWAR_ONES * (127u - (m))) ) & \
+     SWAR_HIGHS )
+
+//! All lanes of x hold a digit character
+#define SWAR_ALL_DIGITS(x) ( SWAR_BETWEEN( (x), ('0' - 1u), ('9' + 1u) ) == SWAR_HIGHS )
+#endif // ASCII_7SEG_SWAR
+
 /* Local Datatypes */
 
 /* Local Data */
 
+#ifdef ASCII_7SEG_KERNEL
+extern const struct Ascii7Seg_Kernel_S ASCII_7SEG_KERNEL_SYMBOL(ASCII_7SEG_KERNEL, );
+const struct Ascii7Seg_Kernel_S ASCII_7SEG_KERNEL_SYMBOL(ASCII_7SEG_KERNEL, ) =
+{
+   .convert_char = Ascii7Seg_ConvertChar,
+   .convert_word = Ascii7Seg_ConvertWord,
+   .convert_bytes = Ascii7Seg_ConvertBytes,
+   .is_supported_char = Ascii7Seg_IsSupportedChar,
+#ifdef ASCII_7SEG_HAS_DP
+   .convert_word_ex = Ascii7Seg_ConvertWordEx,
+#endif
+};
+#endif // ASCII_7SEG_KERNEL
+
 #if !defined(ASCII_7SEG_NUMS_ONLY) && !defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
 
+/**
+ * SupportedCharSet has one bit per ASCII character, set for the supported ones.
+ * It is how the full range variants validate characters: one load and a shift,
+ * rather than a chain of comparisons.
+ *
+ * PerfectHashLUT holds the encodings of the supported characters and nothing
+ * else, at the slot given by PERFECT_HASH(). The hash is collision-free over the
+ * supported characters but says nothing about any other character, so it must
+ * only be applied to characters that pass SUPPORTED_CHAR_SET_HAS().
+ *
+ * The hash and the tables are found by scripts/find_perfect_hash.py from
+ * scripts/ascii7seg_encodings.csv, so edit the CSV and re-run the script with
+ * `--write src/ascii7seg.c` rather than editing them by hand.
+ */
+// BEGIN GENERATED CODE: scripts/find_perfect_hash.py (do not edit by hand)
+#define SUPPORTED_CHAR_SET_HAS(c)  ( ((unsigned)SupportedCharSet[(c) >> 3u] >> ((c) & 7u)) & 1u )
+
+static const uint8_t SupportedCharSet[16] =
+{
+   0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xFF, 0x73,
+   0xFE, 0xFF, 0xFF, 0xAF, 0xFE, 0xFF, 0xFF, 0x17
+};
+
+#if !defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE) && defined(ASCII_7SEG_USE_PERFECT_HASH)
+
+// displacement hash, 72 slots for 72 characters: h = (c & 0x3) + D[(c >> 2) - 10]
+#define PERFECT_HASH(c)  ( ((uint32_t)(c) & 0x3u) + PerfectHashDisplacement[(((uint32_t)(c) >> 2u) - 10u)] )
+
+static const uint8_t PerfectHashDisplacement[22] =
+{
+   64, 68,  0,  4, 66, 52, 54,  8, 12, 16, 20, 24,
+   28, 67, 57, 32, 36, 40, 44, 48, 61, 71
+};
+
+static const union Ascii7Seg_Encoding_U PerfectHashLUT[72] =
+{
+   { /*  0: '0' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /*  1: '1' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 0, .e = 0, .f = 0, .g = 0 } },
+   { /*  2: '2' */ .segments = { .a = 1, .b = 1, .c = 0, .d = 1, .e = 1, .f = 0, .g = 1 } },
+   { /*  3: '3' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 0, .f = 0, .g = 1 } },
+   { /*  4: '4' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 0, .e = 0, .f = 1, .g = 1 } },
+   { /*  5: '5' */ .segments = { .a = 1, .b = 0, .c = 1, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /*  6: '6' */ .segments = { .a = 1, .b = 0, .c = 1, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /*  7: '7' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 0, .e = 0, .f = 0, .g = 0 } },
+   { /*  8: 'D' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /*  9: 'E' */ .segments = { .a = 1, .b = 0, .c = 0, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /* 10: 'F' */ .segments = { .a = 1, .b = 0, .c = 0, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 11: 'G' */ .segments = { .a = 1, .b = 0, .c = 1, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /* 12: 'H' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 13: 'I' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 0, .e = 0, .f = 0, .g = 0 } },
+   { /* 14: 'J' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 1, .e = 0, .f = 0, .g = 0 } },
+   { /* 15: 'K' */ .segments = { .a = 1, .b = 0, .c = 1, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 16: 'L' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /* 17: 'M' */ .segments = { .a = 1, .b = 0, .c = 1, .d = 0, .e = 1, .f = 0, .g = 0 } },
+   { /* 18: 'N' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 0, .e = 1, .f = 1, .g = 0 } },
+   { /* 19: 'O' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /* 20: 'P' */ .segments = { .a = 1, .b = 1, .c = 0, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 21: 'Q' */ .segments = { .a = 1, .b = 1, .c = 0, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /* 22: 'R' */ .segments = { .a = 1, .b = 1, .c = 0, .d = 0, .e = 1, .f = 1, .g = 0 } },
+   { /* 23: 'S' */ .segments = { .a = 1, .b = 0, .c = 1, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /* 24: 'T' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /* 25: 'U' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /* 26: 'V' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /* 27: 'W' */ .segments = { .a = 0, .b = 1, .c = 0, .d = 1, .e = 0, .f = 1, .g = 0 } },
+   { /* 28: 'X' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 29: 'Y' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /* 30: 'Z' */ .segments = { .a = 1, .b = 1, .c = 0, .d = 1, .e = 1, .f = 0, .g = 1 } },
+   { /* 31: '[' */ .segments = { .a = 1, .b = 0, .c = 0, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /* 32: 'd' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 1, .e = 1, .f = 0, .g = 1 } },
+   { /* 33: 'e' */ .segments = { .a = 1, .b = 1, .c = 0, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /* 34: 'f' */ .segments = { .a = 1, .b = 0, .c = 0, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 35: 'g' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /* 36: 'h' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 37: 'i' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 0, .e = 1, .f = 0, .g = 0 } },
+   { /* 38: 'j' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 1, .e = 0, .f = 0, .g = 0 } },
+   { /* 39: 'k' */ .segments = { .a = 1, .b = 0, .c = 1, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 40: 'l' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 0, .e = 1, .f = 1, .g = 0 } },
+   { /* 41: 'm' */ .segments = { .a = 0, .b = 0, .c = 1, .d = 0, .e = 1, .f = 0, .g = 0 } },
+   { /* 42: 'n' */ .segments = { .a = 0, .b = 0, .c = 1, .d = 0, .e = 1, .f = 0, .g = 1 } },
+   { /* 43: 'o' */ .segments = { .a = 0, .b = 0, .c = 1, .d = 1, .e = 1, .f = 0, .g = 1 } },
+   { /* 44: 'p' */ .segments = { .a = 1, .b = 1, .c = 0, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 45: 'q' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /* 46: 'r' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 0, .e = 1, .f = 0, .g = 1 } },
+   { /* 47: 's' */ .segments = { .a = 1, .b = 0, .c = 1, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /* 48: 't' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /* 49: 'u' */ .segments = { .a = 0, .b = 0, .c = 1, .d = 1, .e = 1, .f = 0, .g = 0 } },
+   { /* 50: 'v' */ .segments = { .a = 0, .b = 0, .c = 1, .d = 1, .e = 1, .f = 0, .g = 0 } },
+   { /* 51: 'w' */ .segments = { .a = 0, .b = 0, .c = 1, .d = 0, .e = 1, .f = 0, .g = 0 } },
+   { /* 52: '<' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 1, .e = 1, .f = 0, .g = 1 } },
+   { /* 53: '=' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 1, .e = 0, .f = 0, .g = 1 } },
+   { /* 54: '>' */ .segments = { .a = 0, .b = 0, .c = 1, .d = 1, .e = 0, .f = 0, .g = 1 } },
+   { /* 55: 'A' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 56: 'B' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /* 57: 'C' */ .segments = { .a = 1, .b = 0, .c = 0, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /* 58: 'a' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 1, .f = 0, .g = 1 } },
+   { /* 59: 'b' */ .segments = { .a = 0, .b = 0, .c = 1, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /* 60: 'c' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 1, .e = 1, .f = 0, .g = 1 } },
+   { /* 61: 'x' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 0, .e = 1, .f = 1, .g = 1 } },
+   { /* 62: 'y' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /* 63: 'z' */ .segments = { .a = 1, .b = 1, .c = 0, .d = 1, .e = 1, .f = 0, .g = 1 } },
+   { /* 64: '(' */ .segments = { .a = 1, .b = 0, .c = 0, .d = 1, .e = 1, .f = 1, .g = 0 } },
+   { /* 65: ')' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 0, .f = 0, .g = 0 } },
+   { /* 66: '8' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 1, .f = 1, .g = 1 } },
+   { /* 67: '9' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 0, .f = 1, .g = 1 } },
+   { /* 68: ']' */ .segments = { .a = 1, .b = 1, .c = 1, .d = 1, .e = 0, .f = 0, .g = 0 } },
+   { /* 69: '-' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 0, .e = 0, .f = 0, .g = 1 } },
+   { /* 70: '_' */ .segments = { .a = 0, .b = 0, .c = 0, .d = 1, .e = 0, .f = 0, .g = 0 } },
+   { /* 71: '|' */ .segments = { .a = 0, .b = 1, .c = 1, .d = 0, .e = 0, .f = 0, .g = 0 } }
+};
+
+#endif // ASCII_7SEG_USE_PERFECT_HASH
+// END GENERATED CODE (110 bytes bit-packed, 542 bytes otherwise)
+
+#endif // !ASCII_7SEG_NUMS_ONLY && !ASCII_7SEG_NUMS_AND_ERROR_ONLY
+
+#if !defined(ASCII_7SEG_NUMS_ONLY) && !defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY) && \
+    !defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE) && !defined(ASCII_7SEG_USE_PERFECT_HASH)
+
 /**
  * MasterLUT is a lookup table (LUT) containing the 7-segment display encodings
  * for all supported ASCII characters.
  *
  * The table is indexed by the ASCII value of the character, allowing for fast
  * retrieval of the segment encoding for any character in the supported range,
- * and removing the need for a hash. Hypothetically, a clever-er hash function
- * can condense down this table, but I'm yet to come up with one.
+ * and removing the need for a hash. See ASCII_7SEG_USE_PERFECT_HASH for a
+ * hashed table that only holds the supported characters.
  */
 static const union Ascii7Seg_Encoding_U MasterLUT[ CHAR_MAX + 1 ] =
 {
@@ -113,7 +338,8 @@ static const union Ascii7Seg_Encoding_U MasterLUT[ CHAR_MAX + 1 ] =
    [(uint8_t)'Z'] = { .segments = { .a = 1, .b = 1, .c = 0, .d = 1, .e = 1, .f = 0, .g = 1 }, }
 };
 
-#elif !defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE)
+#elif ( defined(ASCII_7SEG_NUMS_ONLY) || defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY) ) && \
+      !defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE)
 
 /**
  * NumLUT is a lookup table (LUT) containing the 7-segment display encodings
@@ -137,19 +363,368 @@ static const union Ascii7Seg_Encoding_U NumLUT[] =
 
 #endif
 
+#ifdef ASCII_7SEG_SIMD_X86
+
+#ifdef ASCII_7SEG_BIT_PACK
+
+//! The bit-packed MasterLUT already is the table of packed encodings
+#define PACKED_LUT   ( (const uint8_t *)MasterLUT )
+
+#define ENCODING_IS_BLANK(enc)   ( 0u == (enc).encoding_as_val )
+
+#else // ASCII_7SEG_PAD_TO_8_BYTES
+
+/**
+ * MasterLUT packed down to one byte per encoding (bit s = segment s), for the
+ * vector kernels to look up from. It is filled in by SelectBulkKernel() before
+ * any of those kernels is selected.
+ */
+static uint8_t PackedLUT[ CHAR_MAX + 1 ];
+#define PACKED_LUT   PackedLUT
+
+#define ENCODING_IS_BLANK(enc)   ( 0u == (enc).encoding_as_word )
+
+#endif // ASCII_7SEG_BIT_PACK
+
+/**
+ * Signature shared by all of the bulk conversion kernels. Each kernel converts
+ * characters from str into buf until it reaches an unsupported character (which
+ * includes the null terminator) or str_len characters, and returns the number
+ * of characters converted. Past that count, a kernel may only write to buf
+ * below buf_cap, which lets it finish with a full vector store instead of a
+ * partial one. Pass a buf_cap of 0 to have nothing written past that count.
+ */
+typedef size_t (*BulkKernel_T)( const char * str,
+                                size_t str_len,
+                                union Ascii7Seg_Encoding_U * buf,
+                                size_t buf_cap );
+
+#endif // ASCII_7SEG_SIMD_X86
+
 /* Private Function Prototypes */
 
+static inline bool IsSupported( char ascii_char );
+static inline void EncodeChar( char ascii_char, union Ascii7Seg_Encoding_U * buf );
+
+#ifdef ASCII_7SEG_SIMD_X86
+
+static size_t ConvertBulk_ScalarRange( const char * str,
+                                       size_t start,
+                                       size_t end,
+                                       union Ascii7Seg_Encoding_U * buf );
+static size_t ConvertBulk_Scalar( const char * str,
+                                  size_t str_len,
+                                  union Ascii7Seg_Encoding_U * buf,
+                                  size_t buf_cap );
+static size_t ConvertBulk_SSSE3( const char * str,
+                                 size_t str_len,
+                                 union Ascii7Seg_Encoding_U * buf,
+                                 size_t buf_cap );
+static size_t ConvertBulk_AVX2( const char * str,
+                                size_t str_len,
+                                union Ascii7Seg_Encoding_U * buf,
+                                size_t buf_cap );
+static size_t ConvertBulk_AVX512VBMI( const char * str,
+                                      size_t str_len,
+                                      union Ascii7Seg_Encoding_U * buf,
+                                      size_t buf_cap );
+static inline void StoreEncodings_SSSE3( union Ascii7Seg_Encoding_U * dst, __m128i enc );
+static inline void StoreEncodings_AVX2( union Ascii7Seg_Encoding_U * dst, __m256i enc );
+static inline void StoreEncodings_AVX512VBMI( union Ascii7Seg_Encoding_U * dst,
+                                              __m512i enc,
+                                              size_t num_encodings );
+static void SelectBulkKernel(void);
+
+/**
+ * Kernel used by Ascii7Seg_ConvertWord(). This starts out as the scalar kernel
+ * so that the library behaves correctly even if it is called before the
+ * load-time selection in SelectBulkKernel() has run (e.g., from another
+ * constructor), and is then upgraded to the best kernel the CPU supports.
+ */
+static BulkKernel_T BulkKernel = ConvertBulk_Scalar;
+
+#endif // ASCII_7SEG_SIMD_X86
+
+#ifdef ASCII_7SEG_SWAR
+
+static size_t ConvertBulk_Swar( const char * str,
+                                size_t str_len,
+                                union Ascii7Seg_Encoding_U * buf );
+
+#endif // ASCII_7SEG_SWAR
+
 /* Public API Implementations */
 
 /******************************************************************************/
 bool Ascii7Seg_ConvertChar( char ascii_char, union Ascii7Seg_Encoding_U * buf )
 {
-   if ( (NULL == buf) || (ascii_char <= 0) ||
-        !Ascii7Seg_IsSupportedChar(ascii_char) )
+   if ( (NULL == buf) || (ascii_char <= 0) || !IsSupported(ascii_char) )
+   {
+      return false;
+   }
+
+   EncodeChar( ascii_char, buf );
+
+   // If we've reached here, we've successfully encoded the character.
+   return true;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertWord( const char * str,
+                              size_t str_len,
+                              union Ascii7Seg_Encoding_U * buf )
+{
+   if ( (NULL == str) || (NULL == buf) )
+   {
+      return false;
+   }
+
+#ifdef ASCII_7SEG_SIMD_X86
+
+   return BulkKernel( str, str_len, buf, 0 );
+
+#elif defined(ASCII_7SEG_SWAR)
+
+   return ConvertBulk_Swar( str, str_len, buf );
+
+#else
+
+   bool word_converted = false;
+   size_t chars_converted = 0;
+   while ( (str[chars_converted] != '\0') && (chars_converted < str_len) )
+   {
+      word_converted = Ascii7Seg_ConvertChar( str[chars_converted],
+                                              &buf[chars_converted] );
+      if ( !word_converted )
+      {
+         // Character failed to convert
+         break;
+      }
+
+      chars_converted++;
+   }
+
+   return chars_converted;
+
+#endif // ASCII_7SEG_SIMD_X86 / ASCII_7SEG_SWAR
+}
+
+/******************************************************************************/
+struct Ascii7Seg_Result_S Ascii7Seg_ConvertBytes( const char * src,
+                                                  size_t src_len,
+                                                  union Ascii7Seg_Encoding_U * buf,
+                                                  size_t buf_cap )
+{
+   struct Ascii7Seg_Result_S result =
+   {
+      .converted = 0,
+      .invalid_idx = ASCII_7SEG_NO_INVALID_IDX,
+      .invalid_char = '\0'
+   };
+
+   if ( (NULL == src) || (NULL == buf) )
+   {
+      return result;
+   }
+
+   const size_t len = (src_len < buf_cap) ? src_len : buf_cap;
+
+#ifdef ASCII_7SEG_SIMD_X86
+
+   // The kernels validate and encode in the same pass
+   result.converted = BulkKernel( src, len, buf, buf_cap );
+
+#elif defined(ASCII_7SEG_SWAR)
+
+   result.converted = ConvertBulk_Swar( src, len, buf );
+
+#else
+
+   size_t i = 0;
+   while ( (i < len) && IsSupported(src[i]) )
+   {
+      EncodeChar( src[i], &buf[i] );
+      i++;
+   }
+
+   result.converted = i;
+
+#endif // ASCII_7SEG_SIMD_X86 / ASCII_7SEG_SWAR
+
+   if ( result.converted < len )
+   {
+      result.invalid_idx = result.converted;
+      result.invalid_char = src[result.converted];
+   }
+
+   return result;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_IsSupportedChar( char ascii_char )
+{
+   return IsSupported( ascii_char );
+}
+
+#ifdef ASCII_7SEG_HAS_DP
+
+/******************************************************************************/
+struct Ascii7Seg_WordResult_S Ascii7Seg_ConvertWordEx( const char * str,
+                                                       size_t str_len,
+                                                       union Ascii7Seg_Encoding_U * buf,
+                                                       size_t buf_cap,
+                                                       unsigned int options )
+{
+   struct Ascii7Seg_WordResult_S result = { .consumed = 0, .produced = 0 };
+
+   if ( (NULL == str) || (NULL == buf) )
+   {
+      return result;
+   }
+
+   // Whether buf[result.produced - 1] is a character's encoding with its DP still off
+   bool can_fold = false;
+
+   while ( true )
+   {
+      // Everything up to the next dot (or the end) in one go
+      const struct Ascii7Seg_Result_S run =
+         Ascii7Seg_ConvertBytes( &str[result.consumed],
+                                 str_len - result.consumed,
+                                 &buf[result.produced],
+                                 buf_cap - result.produced );
+      result.consumed += run.converted;
+      result.produced += run.converted;
+      can_fold = can_fold || (run.converted > 0);
+
+      if ( (result.consumed == str_len) || ('.' != str[result.consumed]) ||
+           (0u == (options & ASCII_7SEG_WORD_FOLD_DP)) )
+      {
+         break;
+      }
+
+      if ( can_fold )
+      {
+         buf[result.produced - 1].segments.dp = 1;
+         can_fold = false;
+      }
+      else if ( result.produced < buf_cap )
+      {
+         (void)memset( &buf[result.produced], 0, sizeof(buf[result.produced]) );
+         buf[result.produced].segments.dp = 1;
+         result.produced++;
+      }
+      else
+      {
+         break;
+      }
+
+      result.consumed++;
+   }
+
+   return result;
+}
+
+#endif // ASCII_7SEG_HAS_DP
+
+#ifdef TEST
+
+/******************************************************************************/
+bool Ascii7Seg_TestForceBulkKernel( size_t kernel )
+{
+#ifdef ASCII_7SEG_SIMD_X86
+   BulkKernel_T forced = NULL;
+
+   switch ( kernel )
+   {
+      case 0:
+         forced = ConvertBulk_Scalar;
+         break;
+
+      case 1:
+         forced = __builtin_cpu_supports("ssse3") ? ConvertBulk_SSSE3 : NULL;
+         break;
+
+      case 2:
+         forced = __builtin_cpu_supports("avx2") ? ConvertBulk_AVX2 : NULL;
+         break;
+
+      case 3:
+         forced = ( __builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw") ) ?
+                  ConvertBulk_AVX512VBMI : NULL;
+         break;
+
+      case SIZE_MAX:
+         SelectBulkKernel();
+         return true;
+
+      default:
+         break;
+   }
+
+   if ( NULL == forced )
    {
       return false;
    }
 
+   BulkKernel = forced;
+   return true;
+#else
+   // Without the SIMD path, there is only the one kernel
+   return ( (0u == kernel) || (SIZE_MAX == kernel) );
+#endif // ASCII_7SEG_SIMD_X86
+}
+
+#endif // TEST
+
+/* Private Function Implementations */
+
+/**
+ * Body of Ascii7Seg_IsSupportedChar(), kept inline-able so that the bulk
+ * conversion loops don't pay for a function call per character.
+ */
+/******************************************************************************/
+static inline bool IsSupported( char ascii_char )
+{
+
+#ifdef ASCII_7SEG_NUMS_ONLY
+   if ( (ascii_char < '0') || (ascii_char > '9') )
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+   if ( (ascii_char < '0')  ||
+        (
+            (ascii_char > '9') &&   // letters start after the nums in ASCII
+            !(
+               (ascii_char == 'E') || (ascii_char == 'e') ||
+               (ascii_char == 'R') || (ascii_char == 'r') ||
+               (ascii_char == 'O') || (ascii_char == 'o')
+            )
+        )
+      )
+#else
+   if ( (ascii_char <= 0) || ((uint8_t)ascii_char > (uint8_t)INT8_MAX) ||
+        !SUPPORTED_CHAR_SET_HAS((uint8_t)ascii_char) )
+#endif // ASCII_7SEG_NUMS_ONLY
+
+   {
+      return false;
+   }
+
+   return true;
+}
+
+/**
+ * Writes the encoding of ascii_char into buf without any validation. The
+ * caller is responsible for having checked that buf is not NULL and that
+ * ascii_char is supported (see Ascii7Seg_IsSupportedChar()).
+ */
+/******************************************************************************/
+static inline void EncodeChar( char ascii_char, union Ascii7Seg_Encoding_U * buf )
+{
+#if defined(ASCII_7SEG_HAS_DP) && defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE)
+   // The computed encodings below only set segments a-g themselves
+   buf->segments.dp = 0;
+#endif
+
 #ifdef ASCII_7SEG_NUMS_ONLY
 
    assert( (ascii_char >= '0') && (ascii_char <= '9') );
@@ -241,14 +816,53 @@ bool Ascii7Seg_ConvertChar( char ascii_char, union Ascii7Seg_Encoding_U * buf )
 
 #ifdef ASCII_7SEG_DONT_USE_LOOKUP_TABLE
 
-   // FIXME: Add a non-lookup table approach to the full character range support.
-   //        There isn't an obvious answer to this one for me, other than a really
-   //        long and ugly logical expression chain like that of the other
-   //        sections, but much worse. One can take a look at the scatter plots
-   //        at the root of the repository that visualize the encoding mapping
-   //        and clearly, this is not a simple closed-form function.
-   //        So, for now, I'll go for this lookup table approach...
-   *buf = MasterLUT[(uint8_t)ascii_char];
+   /**
+    * Each segment is a minimized sum-of-products over the 7 bits of the
+    * character, where every unsupported character is a don't-care (they are
+    * rejected before we get here). The expressions are generated from
+    * scripts/ascii7seg_encodings.csv by scripts/gen_segment_logic.py, so edit
+    * the CSV and re-run the script with `--write src/ascii7seg.c` rather than
+    * editing them by hand. Product terms are combined with the bitwise | so
+    * that evaluating them does not branch.
+    */
+   // BEGIN GENERATED CODE: scripts/gen_segment_logic.py (do not edit by hand)
+   const uint8_t x = (uint8_t)ascii_char;
+
+   buf->segments.a = !( ((x & 0x4Fu) == 0x01u) | ((x & 0x3Eu) == 0x22u) | ((x & 0x2Cu) == 0x2Cu) |
+                        ((x & 0x4Eu) == 0x48u) | ((x & 0x7Bu) == 0x72u) | ((x & 0x5Cu) == 0x54u) |
+                        ((x & 0x27u) == 0x24u) | ((x & 0x5Du) == 0x48u) | ((x & 0x4Bu) == 0x48u) |
+                        ((x & 0x56u) == 0x56u) );
+   buf->segments.b = !( ((x & 0x51u) == 0x00u) | ((x & 0x4Cu) == 0x0Cu) | ((x & 0x79u) == 0x69u) |
+                        ((x & 0x47u) == 0x05u) | ((x & 0x27u) == 0x26u) | ((x & 0x37u) == 0x05u) |
+                        ((x & 0x3Eu) == 0x06u) | ((x & 0x1Eu) == 0x0Cu) | ((x & 0x47u) == 0x43u) |
+                        ((x & 0x7Cu) == 0x74u) | ((x & 0x37u) == 0x14u) | ((x & 0x1Eu) == 0x1Eu) |
+                        ((x & 0x6Bu) == 0x62u) );
+   buf->segments.c = !( ((x & 0x1Fu) == 0x03u) | ((x & 0x51u) == 0x00u) | ((x & 0x4Eu) == 0x0Cu) |
+                        ((x & 0x1Fu) == 0x05u) | ((x & 0x1Fu) == 0x06u) | ((x & 0x7Fu) == 0x69u) |
+                        ((x & 0x1Fu) == 0x0Cu) | ((x & 0x3Eu) == 0x10u) | ((x & 0x5Bu) == 0x50u) |
+                        ((x & 0x37u) == 0x17u) | ((x & 0x17u) == 0x12u) | ((x & 0x5Au) == 0x5Au) );
+   buf->segments.d = !( ((x & 0x36u) == 0x00u) | ((x & 0x4Fu) == 0x01u) | ((x & 0x4Fu) == 0x04u) |
+                        ((x & 0x17u) == 0x06u) | ((x & 0x5Du) == 0x50u) | ((x & 0x37u) == 0x37u) |
+                        ((x & 0x5Du) == 0x49u) | ((x & 0x1Fu) == 0x0Du) | ((x & 0x47u) == 0x40u) |
+                        ((x & 0x6Bu) == 0x68u) );
+   buf->segments.e = ( ((x & 0x0Bu) == 0x02u) | ((x & 0x4Bu) == 0x08u) | ((x & 0x4Eu) == 0x44u) |
+                       ((x & 0x1Eu) == 0x1Au) | ((x & 0x07u) == 0x00u) | ((x & 0x38u) == 0x00u) |
+                       ((x & 0x17u) == 0x03u) | ((x & 0x72u) == 0x60u) | ((x & 0x5Cu) == 0x4Cu) |
+                       ((x & 0x7Cu) == 0x74u) );
+   buf->segments.f = ( ((x & 0x4Eu) == 0x04u) | ((x & 0x4Du) == 0x04u) | ((x & 0x28u) == 0x00u) |
+                       ((x & 0x1Du) == 0x05u) | ((x & 0x0Fu) == 0x0Bu) | ((x & 0x1Bu) == 0x08u) |
+                       ((x & 0x55u) == 0x51u) | ((x & 0x1Bu) == 0x10u) | ((x & 0x1Bu) == 0x02u) |
+                       ((x & 0x36u) == 0x06u) | ((x & 0x1Eu) == 0x18u) );
+   buf->segments.g = !( ((x & 0x3Fu) == 0x03u) | ((x & 0x4Eu) == 0x00u) | ((x & 0x2Cu) == 0x0Cu) |
+                        ((x & 0x3Bu) == 0x12u) | ((x & 0x1Fu) == 0x0Au) | ((x & 0x55u) == 0x55u) |
+                        ((x & 0x56u) == 0x56u) | ((x & 0x1Bu) == 0x1Bu) | ((x & 0x37u) == 0x04u) |
+                        ((x & 0x54u) == 0x00u) | ((x & 0x5Bu) == 0x49u) | ((x & 0x4Eu) == 0x4Cu) |
+                        ((x & 0x17u) == 0x17u) );
+   // END GENERATED CODE (79 product terms)
+
+#elif defined(ASCII_7SEG_USE_PERFECT_HASH)
+
+   *buf = PerfectHashLUT[ PERFECT_HASH((uint8_t)ascii_char) ];
 
 #else
 
@@ -257,68 +871,474 @@ bool Ascii7Seg_ConvertChar( char ascii_char, union Ascii7Seg_Encoding_U * buf )
 #endif // ASCII_7SEG_DONT_USE_LOOKUP_TABLE
 
 #endif // endif for macros that limit range of representable values
+}
 
-   // If we've reached here, we've successfully encoded the character.
-   return true;
+#ifdef ASCII_7SEG_SIMD_X86
+
+/**
+ * In the full range variant, every supported character has at least one segment
+ * on and every unsupported character in MasterLUT is all zeros, so a zero
+ * encoding doubles as the "not supported" marker for the bulk kernels.
+ * That includes the null terminator, which is how the kernels stop at the end
+ * of the string.
+ */
+
+/******************************************************************************/
+static size_t ConvertBulk_ScalarRange( const char * str,
+                                       size_t start,
+                                       size_t end,
+                                       union Ascii7Seg_Encoding_U * buf )
+{
+   size_t i;
+   for ( i = start; i < end; i++ )
+   {
+      const uint8_t c = (uint8_t)str[i];
+      if ( (c > (uint8_t)INT8_MAX) || ENCODING_IS_BLANK(MasterLUT[c]) )
+      {
+         break;
+      }
+      buf[i] = MasterLUT[c];
+   }
+
+   return i;
 }
 
 /******************************************************************************/
-size_t Ascii7Seg_ConvertWord( const char * str,
-                              size_t str_len,
-                              union Ascii7Seg_Encoding_U * buf )
+static size_t ConvertBulk_Scalar( const char * str,
+                                  size_t str_len,
+                                  union Ascii7Seg_Encoding_U * buf,
+                                  size_t buf_cap )
 {
-   if ( (NULL == str) || (NULL == buf) )
+   (void)buf_cap;
+   return ConvertBulk_ScalarRange( str, 0, str_len, buf );
+}
+
+/**
+ * The vector kernels below share the same shape:
+ *    1. Convert one character at a time until str is aligned to the vector
+ *       width. Aligned vector loads never straddle a page boundary, so reading
+ *       a full vector that extends past the null terminator or past str_len is
+ *       safe, even though those lanes are thrown away.
+ *    2. Look up a full vector of packed encodings and, in the same pass, build
+ *       a bitmask of lanes that must stop the conversion (unsupported
+ *       character, null terminator, or beyond str_len).
+ *    3. If no lane stops the conversion, store the whole vector. Otherwise,
+ *       store only the lanes before the first stopping lane (or the whole
+ *       vector, if buf_cap leaves room for it) and return.
+ * Storing goes through StoreEncodings_x(), which expands each packed encoding
+ * into 8 bools in the ASCII_7SEG_PAD_TO_8_BYTES layout.
+ */
+
+/******************************************************************************/
+__attribute__((target("ssse3")))
+static size_t ConvertBulk_SSSE3( const char * str,
+                                 size_t str_len,
+                                 union Ascii7Seg_Encoding_U * buf,
+                                 size_t buf_cap )
+{
+   enum { VEC_WIDTH = 16 };
+
+   size_t head = (size_t)( (VEC_WIDTH - ((uintptr_t)str % VEC_WIDTH)) % VEC_WIDTH );
+   if ( head > str_len )
    {
-      return false;
+      head = str_len;
+   }
+   size_t i = ConvertBulk_ScalarRange( str, 0, head, buf );
+   if ( i < head )
+   {
+      return i;
    }
 
-   bool word_converted = false;
-   size_t chars_converted = 0;
-   while ( (str[chars_converted] != '\0') && (chars_converted < str_len) )
+   // Rows 0 and 1 of the table (0x00-0x1F) hold no supported characters.
+   const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+   const __m128i zero = _mm_setzero_si128();
+   __m128i rows[6];
+   for ( int row = 0; row < 6; row++ )
    {
-      word_converted = Ascii7Seg_ConvertChar( str[chars_converted],
-                                              &buf[chars_converted] );
-      if ( !word_converted )
+      rows[row] = _mm_loadu_si128( (const void *)&PACKED_LUT[16 * (row + 2)] );
+   }
+
+   while ( i < str_len )
+   {
+      const __m128i chars = _mm_load_si128( (const void *)&str[i] );
+      const __m128i lo = _mm_and_si128( chars, nibble_mask );
+      const __m128i hi = _mm_and_si128( _mm_srli_epi16(chars, 4), nibble_mask );
+
+      __m128i enc = zero;
+      for ( int row = 0; row < 6; row++ )
       {
-         // Character failed to convert
-         break;
+         const __m128i in_row = _mm_cmpeq_epi8( hi, _mm_set1_epi8((char)(row + 2)) );
+         enc = _mm_or_si128( enc, _mm_and_si128(in_row, _mm_shuffle_epi8(rows[row], lo)) );
       }
 
-      chars_converted++;
+      uint32_t stop = (uint32_t)_mm_movemask_epi8( _mm_cmpeq_epi8(enc, zero) );
+      if ( (str_len - i) < VEC_WIDTH )
+      {
+         stop |= UINT32_MAX << (str_len - i);
+      }
+
+      if ( 0 == (stop & 0xFFFFu) )
+      {
+         StoreEncodings_SSSE3( &buf[i], enc );
+         i += VEC_WIDTH;
+      }
+      else if ( (i + VEC_WIDTH) <= buf_cap )
+      {
+         // The lanes from the first stopping lane on are scratch
+         StoreEncodings_SSSE3( &buf[i], enc );
+         return i + (size_t)__builtin_ctz(stop);
+      }
+      else
+      {
+         union Ascii7Seg_Encoding_U lanes[VEC_WIDTH];
+         const size_t n = (size_t)__builtin_ctz(stop);
+         StoreEncodings_SSSE3( lanes, enc );
+         memcpy( &buf[i], lanes, n * sizeof(lanes[0]) );
+         return i + n;
+      }
    }
 
-   return chars_converted;
+   return i;
 }
 
 /******************************************************************************/
-bool Ascii7Seg_IsSupportedChar( char ascii_char )
+__attribute__((target("avx2")))
+static size_t ConvertBulk_AVX2( const char * str,
+                                size_t str_len,
+                                union Ascii7Seg_Encoding_U * buf,
+                                size_t buf_cap )
 {
+   enum { VEC_WIDTH = 32 };
+
+   size_t head = (size_t)( (VEC_WIDTH - ((uintptr_t)str % VEC_WIDTH)) % VEC_WIDTH );
+   if ( head > str_len )
+   {
+      head = str_len;
+   }
+   size_t i = ConvertBulk_ScalarRange( str, 0, head, buf );
+   if ( i < head )
+   {
+      return i;
+   }
+
+   // vpshufb only shuffles within 128-bit lanes, so each row of the table is
+   // broadcast to both lanes. Rows 0 and 1 (0x00-0x1F) are all zeros.
+   const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+   const __m256i zero = _mm256_setzero_si256();
+   __m256i rows[6];
+   for ( int row = 0; row < 6; row++ )
+   {
+      rows[row] = _mm256_broadcastsi128_si256(
+                     _mm_loadu_si128( (const void *)&PACKED_LUT[16 * (row + 2)] ) );
+   }
+
+   while ( i < str_len )
+   {
+      const __m256i chars = _mm256_load_si256( (const void *)&str[i] );
+      const __m256i lo = _mm256_and_si256( chars, nibble_mask );
+      const __m256i hi = _mm256_and_si256( _mm256_srli_epi16(chars, 4), nibble_mask );
+
+      __m256i enc = zero;
+      for ( int row = 0; row < 6; row++ )
+      {
+         const __m256i in_row = _mm256_cmpeq_epi8( hi, _mm256_set1_epi8((char)(row + 2)) );
+         enc = _mm256_or_si256( enc, _mm256_and_si256(in_row, _mm256_shuffle_epi8(rows[row], lo)) );
+      }
+
+      uint64_t stop = (uint32_t)_mm256_movemask_epi8( _mm256_cmpeq_epi8(enc, zero) );
+      if ( (str_len - i) < VEC_WIDTH )
+      {
+         stop |= UINT64_MAX << (str_len - i);
+      }
+
+      if ( 0 == (stop & 0xFFFFFFFFu) )
+      {
+         StoreEncodings_AVX2( &buf[i], enc );
+         i += VEC_WIDTH;
+      }
+      else if ( (i + VEC_WIDTH) <= buf_cap )
+      {
+         // The lanes from the first stopping lane on are scratch
+         StoreEncodings_AVX2( &buf[i], enc );
+         return i + (size_t)__builtin_ctzll(stop);
+      }
+      else
+      {
+         union Ascii7Seg_Encoding_U lanes[VEC_WIDTH];
+         const size_t n = (size_t)__builtin_ctzll(stop);
+         StoreEncodings_AVX2( lanes, enc );
+         memcpy( &buf[i], lanes, n * sizeof(lanes[0]) );
+         return i + n;
+      }
+   }
+
+   return i;
+}
+
+/******************************************************************************/
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static size_t ConvertBulk_AVX512VBMI( const char * str,
+                                      size_t str_len,
+                                      union Ascii7Seg_Encoding_U * buf,
+                                      size_t buf_cap )
+{
+   enum { VEC_WIDTH = 64 };
+
+   size_t head = (size_t)( (VEC_WIDTH - ((uintptr_t)str % VEC_WIDTH)) % VEC_WIDTH );
+   if ( head > str_len )
+   {
+      head = str_len;
+   }
+   size_t i = ConvertBulk_ScalarRange( str, 0, head, buf );
+   if ( i < head )
+   {
+      return i;
+   }
+
+   // The tail is a single masked store already, so there's no use for buf_cap
+   (void)buf_cap;
+
+   // The two-source byte permute indexes all 128 table entries with the low 7
+   // bits of each character, so characters with the top bit set must be
+   // rejected separately.
+   const __m512i table_lo = _mm512_loadu_si512( (const void *)&PACKED_LUT[0] );
+   const __m512i table_hi = _mm512_loadu_si512( (const void *)&PACKED_LUT[64] );
+
+   while ( i < str_len )
+   {
+      const __m512i chars = _mm512_load_si512( (const void *)&str[i] );
+      const __m512i enc = _mm512_permutex2var_epi8( table_lo, chars, table_hi );
+
+      uint64_t stop = (uint64_t)( _mm512_movepi8_mask(chars) |
+                                  _mm512_testn_epi8_mask(enc, enc) );
+      if ( (str_len - i) < VEC_WIDTH )
+      {
+         stop |= UINT64_MAX << (str_len - i);
+      }
+
+      if ( 0 == stop )
+      {
+         StoreEncodings_AVX512VBMI( &buf[i], enc, VEC_WIDTH );
+         i += VEC_WIDTH;
+      }
+      else
+      {
+         const size_t n = (size_t)__builtin_ctzll(stop);
+         StoreEncodings_AVX512VBMI( &buf[i], enc, n );
+         return i + n;
+      }
+   }
+
+   return i;
+}
+
+/**
+ * The StoreEncodings_x() functions store a vector of packed encodings (one per
+ * byte lane, bit s = segment s) to dst. Bit-packed, that is a plain store. In
+ * the ASCII_7SEG_PAD_TO_8_BYTES layout, each packed byte is expanded into the
+ * 8 bools of its encoding (the vector equivalent of a PDEP of the byte into
+ * the low bit of each byte of a 64-bit word), so each output vector holds whole
+ * encodings and no store straddles one.
+ */
+
+/******************************************************************************/
+__attribute__((target("ssse3")))
+static inline void StoreEncodings_SSSE3( union Ascii7Seg_Encoding_U * dst, __m128i enc )
+{
+#ifdef ASCII_7SEG_BIT_PACK
+
+   _mm_storeu_si128( (void *)dst, enc );
 
-#ifdef ASCII_7SEG_NUMS_ONLY
-   if ( (ascii_char < '0') || (ascii_char > '9') )
-#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
-   if ( (ascii_char < '0')  ||
-        (
-            (ascii_char > '9') &&   // letters start after the nums in ASCII
-            !(
-               (ascii_char == 'E') || (ascii_char == 'e') ||
-               (ascii_char == 'R') || (ascii_char == 'r') ||
-               (ascii_char == 'O') || (ascii_char == 'o')
-            )
-        )
-      )
 #else
-   if ( !isalnum(ascii_char) &&
-        (ascii_char != '[') && (ascii_char != ']') &&
-        (ascii_char != '(') && (ascii_char != ')') &&
-        (ascii_char != '_') && (ascii_char != '-') && 
-        (ascii_char != '|') && (ascii_char != '=') &&
-        (ascii_char != '>') && (ascii_char != '<') )
-#endif // ASCII_7SEG_NUMS_ONLY
 
+   // Spread encodings 2k and 2k + 1 across the two halves of a vector, pick
+   // segment s out of byte s of each half, and squash the result to 0/1.
+   const __m128i segment_bits = _mm_set1_epi64x( (long long)UINT64_C(0x8040201008040201) );
+   const __m128i one = _mm_set1_epi8(1);
+   const __m128i halves = _mm_set_epi64x( 0x0101010101010101LL, 0 );
+   for ( int k = 0; k < 8; k++ )
    {
-      return false;
+      const __m128i idx = _mm_add_epi8( halves, _mm_set1_epi8((char)(2 * k)) );
+      const __m128i spread = _mm_shuffle_epi8( enc, idx );
+      _mm_storeu_si128( (void *)&dst[2 * k],
+                        _mm_min_epu8( _mm_and_si128(spread, segment_bits), one ) );
    }
 
-   return true;
+#endif // ASCII_7SEG_BIT_PACK
 }
+
+/******************************************************************************/
+__attribute__((target("avx2")))
+static inline void StoreEncodings_AVX2( union Ascii7Seg_Encoding_U * dst, __m256i enc )
+{
+#ifdef ASCII_7SEG_BIT_PACK
+
+   _mm256_storeu_si256( (void *)dst, enc );
+
+#else
+
+   // vpshufb can't cross 128-bit lanes, so each half of enc is broadcast to both
+   // lanes first, and then 4 encodings are spread across the quarters.
+   const __m256i segment_bits = _mm256_set1_epi64x( (long long)UINT64_C(0x8040201008040201) );
+   const __m256i one = _mm256_set1_epi8(1);
+   const __m256i quarters = _mm256_set_epi64x( 0x0303030303030303LL, 0x0202020202020202LL,
+                                               0x0101010101010101LL, 0 );
+   for ( int half = 0; half < 2; half++ )
+   {
+      const __m256i src = _mm256_broadcastsi128_si256( (0 == half) ?
+                                                       _mm256_castsi256_si128(enc) :
+                                                       _mm256_extracti128_si256(enc, 1) );
+      for ( int k = 0; k < 4; k++ )
+      {
+         const __m256i idx = _mm256_add_epi8( quarters, _mm256_set1_epi8((char)(4 * k)) );
+         const __m256i spread = _mm256_shuffle_epi8( src, idx );
+         _mm256_storeu_si256( (void *)&dst[(16 * half) + (4 * k)],
+                              _mm256_min_epu8( _mm256_and_si256(spread, segment_bits), one ) );
+      }
+   }
+
+#endif // ASCII_7SEG_BIT_PACK
+}
+
+/**
+ * Unlike the other two, this only stores the first num_encodings lanes of enc,
+ * since AVX-512 has byte-masked stores.
+ */
+/******************************************************************************/
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+static inline void StoreEncodings_AVX512VBMI( union Ascii7Seg_Encoding_U * dst,
+                                              __m512i enc,
+                                              size_t num_encodings )
+{
+   assert( num_encodings <= 64 );
+
+#ifdef ASCII_7SEG_BIT_PACK
+
+   const __mmask64 lanes = (num_encodings < 64) ?
+                           (__mmask64)( (UINT64_C(1) << num_encodings) - 1u ) :
+                           (__mmask64)UINT64_MAX;
+   _mm512_mask_storeu_epi8( (void *)dst, lanes, enc );
+
+#else
+
+   // 8 packed encodings side by side are exactly a byte mask of their 64 bools
+   uint64_t groups[8];
+   const __m512i one = _mm512_set1_epi8(1);
+   _mm512_storeu_si512( (void *)groups, enc );
+   for ( size_t k = 0; (8 * k) < num_encodings; k++ )
+   {
+      const size_t remaining = num_encodings - (8 * k);
+      const __mmask64 lanes = (remaining < 8) ?
+                              (__mmask64)( (UINT64_C(1) << (8 * remaining)) - 1u ) :
+                              (__mmask64)UINT64_MAX;
+      _mm512_mask_storeu_epi8( (void *)&dst[8 * k], lanes,
+                               _mm512_maskz_mov_epi8( (__mmask64)groups[k], one ) );
+   }
+
+#endif // ASCII_7SEG_BIT_PACK
+}
+
+/******************************************************************************/
+__attribute__((constructor))
+static void SelectBulkKernel(void)
+{
+   __builtin_cpu_init();
+
+#ifndef ASCII_7SEG_BIT_PACK
+   for ( size_t c = 0; c < sizeof(PackedLUT); c++ )
+   {
+      PackedLUT[c] = (uint8_t)( Ascii7Seg_PackEncoding(&MasterLUT[c]) & ASCII_7SEG_PACKED_SEGMENTS_MASK );
+   }
+#endif
+
+   if ( __builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw") )
+   {
+      BulkKernel = ConvertBulk_AVX512VBMI;
+   }
+   else if ( __builtin_cpu_supports("avx2") )
+   {
+      BulkKernel = ConvertBulk_AVX2;
+   }
+   else if ( __builtin_cpu_supports("ssse3") )
+   {
+      BulkKernel = ConvertBulk_SSSE3;
+   }
+   else
+   {
+      BulkKernel = ConvertBulk_Scalar;
+   }
+}
+
+#endif // ASCII_7SEG_SIMD_X86
+
+#ifdef ASCII_7SEG_SWAR
+
+/**
+ * SWAR bulk kernel for the numeric variants of the library.
+ *
+ * Characters are converted one at a time until str is word aligned. From there,
+ * a word of characters is loaded at a time and range checked with
+ * SWAR_ALL_DIGITS(). A word of nothing but digits is encoded with no further
+ * checks. Any other word (e.g., the end of the string, or the "Error"
+ * characters in the ASCII_7SEG_NUMS_AND_ERROR_ONLY variant) is handled one
+ * character at a time.
+ *
+ * A word is only loaded if all of it is within str_len, so the tail shorter
+ * than a word is always converted one character at a time. Within str_len
+ * though, a word can hold lanes past the null terminator. Those are read (the
+ * load is aligned, so they never cross into another page) but never encoded.
+ * This over-read is documented on Ascii7Seg_ConvertWord().
+ */
+/******************************************************************************/
+static size_t ConvertBulk_Swar( const char * str,
+                                size_t str_len,
+                                union Ascii7Seg_Encoding_U * buf )
+{
+   size_t i = 0;
+
+   while ( i < str_len )
+   {
+      if ( ( ((uintptr_t)&str[i] % SWAR_LANES) == 0 ) &&
+           ( (str_len - i) >= SWAR_LANES ) )
+      {
+         SwarWord_T word;
+         memcpy( &word, &str[i], sizeof(word) );
+
+         if ( SWAR_ALL_DIGITS(word) )
+         {
+            // Every lane is >= '0', so this cannot borrow across lanes
+            word -= SWAR_ONES * (uint8_t)'0';
+
+#if defined(ASCII_7SEG_BIT_PACK) && !defined(ASCII_7SEG_DONT_USE_LOOKUP_TABLE)
+            SwarWord_T encodings = 0;
+            for ( size_t lane = 0; lane < SWAR_LANES; lane++ )
+            {
+               const uint8_t digit = (uint8_t)( word >> SWAR_LANE_SHIFT(lane) );
+               encodings |= (SwarWord_T)NumLUT[digit].encoding_as_val << SWAR_LANE_SHIFT(lane);
+            }
+            memcpy( &buf[i], &encodings, sizeof(encodings) );
+#else
+            for ( size_t lane = 0; lane < SWAR_LANES; lane++ )
+            {
+               const uint8_t digit = (uint8_t)( word >> SWAR_LANE_SHIFT(lane) );
+               EncodeChar( (char)('0' + digit), &buf[i + lane] );
+            }
+#endif
+            i += SWAR_LANES;
+            continue;
+         }
+      }
+
+      // Unaligned head, short tail, or a word that isn't all digits
+      if ( (str[i] <= 0) || !IsSupported(str[i]) )
+      {
+         break;
+      }
+      EncodeChar( str[i], &buf[i] );
+      i++;
+   }
+
+   return i;
+}
+
+#endif // ASCII_7SEG_SWAR
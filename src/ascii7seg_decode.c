@@ -0,0 +1,211 @@
+/**
+ * @file ascii7seg_decode.c
+ * @brief Implementation of the decoder from 7-segment encodings back to ASCII.
+ *
+ * Each encoding is packed into 7 bits and looked up in the generated tables,
+ * so decoding is a pack and a load per encoding, with no search through the
+ * encoder's tables.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+#include "ascii7seg_decode.h"
+#include "ascii7seg_pack.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Local Data */
+
+/**
+ * The inverse tables, indexed by the packed segments (bit s = segment s). They
+ * are generated by scripts/gen_decode_table.py from
+ * scripts/ascii7seg_encodings.csv, so edit the CSV and re-run the script with
+ * `--write src/ascii7seg_decode.c` rather than editing them by hand.
+ */
+// BEGIN GENERATED CODE: scripts/gen_decode_table.py (do not edit by hand)
+static const char DecodeCanonical[ASCII_7SEG_DECODE_NUM_GLYPHS] =
+{
+   '\0', '\0', '\0', '\0', '\0', '\0', '1', '7',  // 0x00 - 0x07
+   '_', '\0', '\0', '\0', '\0', '\0', 'J', ')',  // 0x08 - 0x0F
+   'i', '\0', '\0', '\0', 'm', 'M', '\0', '\0',  // 0x10 - 0x17
+   '\0', '\0', '\0', '\0', 'u', '\0', '\0', '\0',  // 0x18 - 0x1F
+   '\0', '\0', '\0', '\0', '\0', '\0', '\0', '\0',  // 0x20 - 0x27
+   '\0', '\0', 'W', '\0', '\0', '\0', '\0', '\0',  // 0x28 - 0x2F
+   'l', '\0', '\0', 'R', '\0', '\0', '\0', 'N',  // 0x30 - 0x37
+   'L', 'C', '\0', '\0', '\0', '\0', 'U', '0',  // 0x38 - 0x3F
+   '-', '\0', '\0', '\0', '\0', '\0', '\0', '\0',  // 0x40 - 0x47
+   '=', '\0', '\0', '\0', '>', '\0', '\0', '3',  // 0x48 - 0x4F
+   'r', '\0', '\0', '\0', 'n', '\0', '\0', '\0',  // 0x50 - 0x57
+   'c', '\0', '\0', '2', 'o', '\0', 'd', 'a',  // 0x58 - 0x5F
+   '\0', '\0', '\0', '\0', '\0', '\0', '4', '\0',  // 0x60 - 0x67
+   '\0', '\0', '\0', 'Q', '\0', '5', 'Y', '9',  // 0x68 - 0x6F
+   '\0', 'F', '\0', 'P', '\0', 'K', 'H', 'A',  // 0x70 - 0x77
+   'T', 'E', '\0', 'e', 'b', '6', '\0', '8'   // 0x78 - 0x7F
+};
+
+static const uint8_t DecodeCandidateOffsets[ASCII_7SEG_DECODE_NUM_GLYPHS] =
+{
+     0,   0,   0,   0,   0,   0,   1,   5,  // 0x00 - 0x07
+     7,   0,   0,   0,   0,   0,   9,  12,  // 0x08 - 0x0F
+    15,   0,   0,   0,  17,  20,   0,   0,  // 0x10 - 0x17
+     0,   0,   0,   0,  22,   0,   0,   0,  // 0x18 - 0x1F
+     0,   0,   0,   0,   0,   0,   0,   0,  // 0x20 - 0x27
+     0,   0,  25,   0,   0,   0,   0,   0,  // 0x28 - 0x2F
+    27,   0,   0,  29,   0,   0,   0,  31,  // 0x30 - 0x37
+    33,  35,   0,   0,   0,   0,  39,  42,  // 0x38 - 0x3F
+    46,   0,   0,   0,   0,   0,   0,   0,  // 0x40 - 0x47
+    48,   0,   0,   0,  50,   0,   0,  52,  // 0x48 - 0x4F
+    54,   0,   0,   0,  56,   0,   0,   0,  // 0x50 - 0x57
+    58,   0,   0,  61,  65,   0,  67,  69,  // 0x58 - 0x5F
+     0,   0,   0,   0,   0,   0,  71,   0,  // 0x60 - 0x67
+     0,   0,   0,  73,   0,  75,  79,  82,  // 0x68 - 0x6F
+     0,  86,   0,  89,   0,  92,  95, 100,  // 0x70 - 0x77
+   102, 105,   0, 107, 109, 111,   0, 114   // 0x78 - 0x7F
+};
+
+static const char DecodeCandidatePool[] =
+   "\0"
+   "1I|\0"
+   "7\0"
+   "_\0"
+   "Jj\0"
+   ")]\0"
+   "i\0"
+   "mw\0"
+   "M\0"
+   "uv\0"
+   "W\0"
+   "l\0"
+   "R\0"
+   "N\0"
+   "L\0"
+   "C([\0"
+   "UV\0"
+   "0DO\0"
+   "-\0"
+   "=\0"
+   ">\0"
+   "3\0"
+   "r\0"
+   "n\0"
+   "c<\0"
+   "2Zz\0"
+   "o\0"
+   "d\0"
+   "a\0"
+   "4\0"
+   "Q\0"
+   "5Ss\0"
+   "Yy\0"
+   "9gq\0"
+   "Ff\0"
+   "Pp\0"
+   "Kk\0"
+   "HXhx\0"
+   "A\0"
+   "Tt\0"
+   "E\0"
+   "e\0"
+   "b\0"
+   "6G\0"
+   "8B\0";
+// END GENERATED CODE (44 glyphs, 20 of them ambiguous)
+
+/* Private Function Prototypes */
+
+
+/* Public API Implementations */
+
+/******************************************************************************/
+struct Ascii7Seg_Decoded_S Ascii7Seg_DecodeSegments( const union Ascii7Seg_Encoding_U * encoding )
+{
+   struct Ascii7Seg_Decoded_S decoded =
+   {
+      .canonical = '\0',
+      .candidates = DecodeCandidatePool   // The empty string
+   };
+
+   if ( NULL == encoding )
+   {
+      return decoded;
+   }
+
+   const uint8_t packed = (uint8_t)( Ascii7Seg_PackEncoding(encoding) & ASCII_7SEG_PACKED_SEGMENTS_MASK );
+   decoded.canonical = DecodeCanonical[packed];
+   decoded.candidates = &DecodeCandidatePool[ DecodeCandidateOffsets[packed] ];
+
+   return decoded;
+}
+
+/******************************************************************************/
+struct Ascii7Seg_DecodeResult_S Ascii7Seg_DecodeSegmentsBulk( const union Ascii7Seg_Encoding_U * encodings,
+                                                              size_t num_encodings,
+                                                              char * buf )
+{
+   struct Ascii7Seg_DecodeResult_S result =
+   {
+      .decoded = 0,
+      .first_undecodable = ASCII_7SEG_NO_INVALID_IDX
+   };
+
+   if ( (NULL == encodings) || (NULL == buf) )
+   {
+      return result;
+   }
+
+   // Count instead of branching per encoding, and only look for the first
+   // undecodable one if there is one
+   for ( size_t i = 0; i < num_encodings; i++ )
+   {
+      const char c = DecodeCanonical[ Ascii7Seg_PackEncoding(&encodings[i]) & ASCII_7SEG_PACKED_SEGMENTS_MASK ];
+      buf[i] = c;
+      result.decoded += ( '\0' != c ) ? 1u : 0u;
+   }
+
+   if ( result.decoded < num_encodings )
+   {
+      size_t i = 0;
+      while ( '\0' != buf[i] )
+      {
+         i++;
+      }
+      result.first_undecodable = i;
+   }
+
+   return result;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_DecodeMatches( const union Ascii7Seg_Encoding_U * encoding, char expected )
+{
+   if ( (NULL == encoding) || ('\0' == expected) )
+   {
+      return false;
+   }
+
+   const uint8_t packed = (uint8_t)( Ascii7Seg_PackEncoding(encoding) & ASCII_7SEG_PACKED_SEGMENTS_MASK );
+   const char * candidate = &DecodeCandidatePool[ DecodeCandidateOffsets[packed] ];
+   while ( '\0' != *candidate )
+   {
+      if ( expected == *candidate )
+      {
+         return true;
+      }
+      candidate++;
+   }
+
+   return false;
+}
+
+/* Private Function Implementations */
+
@@ -0,0 +1,334 @@
+/**
+ * @file ascii7seg_driver.c
+ * @brief Implementation of the driver IC backends and the mock transport.
+ *
+ * Every backend packs each encoding into a byte (bit s = segment s, DP in bit
+ * 7), which already is the bit order of the TM1637 and HT16K33. The MAX7219
+ * has the segments the other way around (A in bit 6 down to G in bit 0), so
+ * its bytes are the low 7 bits reversed, from a 16-entry nibble table.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "ascii7seg.h"
+#include "ascii7seg_driver.h"
+#include "ascii7seg_pack.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+// Constant-like macros
+
+//! Bit of a packed encoding with the decimal point
+#define PACKED_DP_BIT            0x80u
+
+// MAX7219 registers
+#define MAX7219_REG_DIGIT0       0x01u
+#define MAX7219_REG_DECODE_MODE  0x09u
+#define MAX7219_REG_INTENSITY    0x0Au
+#define MAX7219_REG_SCAN_LIMIT   0x0Bu
+#define MAX7219_REG_SHUTDOWN     0x0Cu
+#define MAX7219_REG_DISPLAY_TEST 0x0Fu
+#define MAX7219_NO_DECODE        0x00u
+#define MAX7219_NORMAL_OPERATION 0x01u
+#define MAX7219_TEST_OFF         0x00u
+
+// TM1637 commands
+#define TM1637_CMD_WRITE_AUTO_INC   0x40u
+#define TM1637_CMD_ADDRESS          0xC0u
+#define TM1637_CMD_DISPLAY_ON       0x88u  //!< OR'd with the brightness
+
+// HT16K33 commands
+#define HT16K33_CMD_RAM_ADDRESS     0x00u
+#define HT16K33_CMD_OSCILLATOR_ON   0x21u
+#define HT16K33_CMD_DISPLAY_ON      0x81u  //!< No blinking
+#define HT16K33_CMD_DIMMING         0xE0u  //!< OR'd with the brightness
+#define HT16K33_RAM_LEN             16u
+
+/* Local Datatypes */
+
+/* Local Data */
+
+/* Private Function Prototypes */
+
+static inline uint8_t ToMax7219Order( uint8_t packed );
+static bool SendPackets( const struct Ascii7Seg_Transport_S * transport,
+                         const uint8_t * buf,
+                         size_t len,
+                         size_t packet_len );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+size_t Ascii7Seg_Max7219BuildFrame( const union Ascii7Seg_Encoding_U * digits,
+                                    size_t num_digits,
+                                    uint8_t * buf,
+                                    size_t buf_cap )
+{
+   if ( (NULL == digits) || (NULL == buf) ||
+        (0 == num_digits) || (num_digits > ASCII_7SEG_MAX7219_MAX_DIGITS) ||
+        (buf_cap < ASCII_7SEG_MAX7219_FRAME_LEN(num_digits)) )
+   {
+      return 0;
+   }
+
+   for ( size_t i = 0; i < num_digits; i++ )
+   {
+      buf[ASCII_7SEG_MAX7219_PACKET_LEN * i] = (uint8_t)(MAX7219_REG_DIGIT0 + i);
+      buf[(ASCII_7SEG_MAX7219_PACKET_LEN * i) + 1u] = ToMax7219Order( Ascii7Seg_PackEncoding(&digits[i]) );
+   }
+
+   return ASCII_7SEG_MAX7219_FRAME_LEN(num_digits);
+}
+
+/******************************************************************************/
+bool Ascii7Seg_Max7219Init( const struct Ascii7Seg_Transport_S * transport,
+                            size_t num_digits,
+                            unsigned int brightness )
+{
+   if ( (NULL == transport) || (NULL == transport->write) ||
+        (0 == num_digits) || (num_digits > ASCII_7SEG_MAX7219_MAX_DIGITS) ||
+        (brightness > ASCII_7SEG_MAX7219_MAX_BRIGHTNESS) )
+   {
+      return false;
+   }
+
+   // Leave shutdown last, so that nothing half set up is ever shown
+   const uint8_t cmds[] =
+   {
+      MAX7219_REG_DISPLAY_TEST, MAX7219_TEST_OFF,
+      MAX7219_REG_DECODE_MODE,  MAX7219_NO_DECODE,
+      MAX7219_REG_SCAN_LIMIT,   (uint8_t)(num_digits - 1u),
+      MAX7219_REG_INTENSITY,    (uint8_t)brightness,
+      MAX7219_REG_SHUTDOWN,     MAX7219_NORMAL_OPERATION
+   };
+
+   return SendPackets( transport, cmds, sizeof(cmds), ASCII_7SEG_MAX7219_PACKET_LEN );
+}
+
+/******************************************************************************/
+bool Ascii7Seg_Max7219WriteFrame( const struct Ascii7Seg_Transport_S * transport,
+                                  const union Ascii7Seg_Encoding_U * digits,
+                                  size_t num_digits )
+{
+   uint8_t frame[ASCII_7SEG_MAX7219_FRAME_LEN(ASCII_7SEG_MAX7219_MAX_DIGITS)];
+
+   if ( (NULL == transport) || (NULL == transport->write) )
+   {
+      return false;
+   }
+
+   const size_t len = Ascii7Seg_Max7219BuildFrame( digits, num_digits, frame, sizeof(frame) );
+
+   return (len > 0) && SendPackets( transport, frame, len, ASCII_7SEG_MAX7219_PACKET_LEN );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_Tm1637BuildFrame( const union Ascii7Seg_Encoding_U * digits,
+                                   size_t num_digits,
+                                   unsigned int brightness,
+                                   uint8_t * buf,
+                                   size_t buf_cap )
+{
+   if ( (NULL == digits) || (NULL == buf) ||
+        (0 == num_digits) || (num_digits > ASCII_7SEG_TM1637_MAX_DIGITS) ||
+        (brightness > ASCII_7SEG_TM1637_MAX_BRIGHTNESS) ||
+        (buf_cap < ASCII_7SEG_TM1637_FRAME_LEN(num_digits)) )
+   {
+      return 0;
+   }
+
+   buf[0] = TM1637_CMD_WRITE_AUTO_INC;
+   buf[1] = TM1637_CMD_ADDRESS;
+   for ( size_t i = 0; i < num_digits; i++ )
+   {
+      buf[2u + i] = Ascii7Seg_PackEncoding( &digits[i] );
+   }
+   buf[2u + num_digits] = (uint8_t)(TM1637_CMD_DISPLAY_ON | brightness);
+
+   return ASCII_7SEG_TM1637_FRAME_LEN(num_digits);
+}
+
+/******************************************************************************/
+bool Ascii7Seg_Tm1637WriteFrame( const struct Ascii7Seg_Transport_S * transport,
+                                 const union Ascii7Seg_Encoding_U * digits,
+                                 size_t num_digits,
+                                 unsigned int brightness )
+{
+   uint8_t frame[ASCII_7SEG_TM1637_FRAME_LEN(ASCII_7SEG_TM1637_MAX_DIGITS)];
+
+   if ( (NULL == transport) || (NULL == transport->write) )
+   {
+      return false;
+   }
+
+   const size_t len = Ascii7Seg_Tm1637BuildFrame( digits, num_digits, brightness, frame, sizeof(frame) );
+   if ( 0 == len )
+   {
+      return false;
+   }
+
+   // Data command, address command and digits, display control command
+   return transport->write( transport->ctx, &frame[0], 1 ) &&
+          transport->write( transport->ctx, &frame[1], 1u + num_digits ) &&
+          transport->write( transport->ctx, &frame[len - 1u], 1 );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_Ht16k33BuildFrame( const union Ascii7Seg_Encoding_U * digits,
+                                    size_t num_digits,
+                                    uint8_t * buf,
+                                    size_t buf_cap )
+{
+   if ( (NULL == digits) || (NULL == buf) ||
+        (0 == num_digits) || (num_digits > ASCII_7SEG_HT16K33_MAX_DIGITS) ||
+        (buf_cap < ASCII_7SEG_HT16K33_FRAME_LEN) )
+   {
+      return 0;
+   }
+
+   buf[0] = HT16K33_CMD_RAM_ADDRESS;
+   (void)memset( &buf[1], 0, HT16K33_RAM_LEN );
+   for ( size_t i = 0; i < num_digits; i++ )
+   {
+      buf[1u + (2u * i)] = Ascii7Seg_PackEncoding( &digits[i] );
+   }
+
+   return ASCII_7SEG_HT16K33_FRAME_LEN;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_Ht16k33Init( const struct Ascii7Seg_Transport_S * transport,
+                            unsigned int brightness )
+{
+   if ( (NULL == transport) || (NULL == transport->write) ||
+        (brightness > ASCII_7SEG_HT16K33_MAX_BRIGHTNESS) )
+   {
+      return false;
+   }
+
+   const uint8_t cmds[] =
+   {
+      HT16K33_CMD_OSCILLATOR_ON,
+      (uint8_t)(HT16K33_CMD_DIMMING | brightness),
+      HT16K33_CMD_DISPLAY_ON
+   };
+
+   return SendPackets( transport, cmds, sizeof(cmds), 1 );
+}
+
+/******************************************************************************/
+bool Ascii7Seg_Ht16k33WriteFrame( const struct Ascii7Seg_Transport_S * transport,
+                                  const union Ascii7Seg_Encoding_U * digits,
+                                  size_t num_digits )
+{
+   uint8_t frame[ASCII_7SEG_HT16K33_FRAME_LEN];
+
+   if ( (NULL == transport) || (NULL == transport->write) )
+   {
+      return false;
+   }
+
+   const size_t len = Ascii7Seg_Ht16k33BuildFrame( digits, num_digits, frame, sizeof(frame) );
+
+   return (len > 0) && transport->write( transport->ctx, frame, len );
+}
+
+/******************************************************************************/
+bool Ascii7Seg_MockTransportInit( struct Ascii7Seg_MockTransport_S * mock,
+                                  uint8_t * log,
+                                  size_t log_cap,
+                                  size_t * txn_lens,
+                                  size_t txn_cap,
+                                  struct Ascii7Seg_Transport_S * transport )
+{
+   if ( (NULL == mock) || (NULL == log) || (NULL == txn_lens) || (NULL == transport) )
+   {
+      return false;
+   }
+
+   mock->log = log;
+   mock->log_cap = log_cap;
+   mock->log_len = 0;
+   mock->txn_lens = txn_lens;
+   mock->txn_cap = txn_cap;
+   mock->num_txns = 0;
+   mock->fail = false;
+
+   transport->write = Ascii7Seg_MockTransportWrite;
+   transport->ctx = mock;
+
+   return true;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_MockTransportWrite( void * ctx, const uint8_t * data, size_t len )
+{
+   struct Ascii7Seg_MockTransport_S * mock = (struct Ascii7Seg_MockTransport_S *)ctx;
+
+   if ( (NULL == mock) || (NULL == data) || mock->fail ||
+        (mock->num_txns == mock->txn_cap) ||
+        (len > (mock->log_cap - mock->log_len)) )
+   {
+      return false;
+   }
+
+   (void)memcpy( &mock->log[mock->log_len], data, len );
+   mock->log_len += len;
+   mock->txn_lens[mock->num_txns] = len;
+   mock->num_txns++;
+
+   return true;
+}
+
+/* Private Function Implementations */
+
+/**
+ * Moves segment s from bit s to bit 6 - s, leaving the DP in bit 7. Reversing
+ * all 8 bits puts the segments in bits 7 to 1, so one more shift right lines
+ * them up.
+ */
+/******************************************************************************/
+static inline uint8_t ToMax7219Order( uint8_t packed )
+{
+   static const uint8_t ReversedNibbles[16] =
+   {
+      0x0u, 0x8u, 0x4u, 0xCu, 0x2u, 0xAu, 0x6u, 0xEu,
+      0x1u, 0x9u, 0x5u, 0xDu, 0x3u, 0xBu, 0x7u, 0xFu
+   };
+
+   const unsigned int reversed = ( (unsigned int)ReversedNibbles[packed & 0x0Fu] << 4 ) |
+                                 ReversedNibbles[packed >> 4];
+
+   return (uint8_t)( (packed & PACKED_DP_BIT) | (reversed >> 1) );
+}
+
+/**
+ * Sends len bytes of buf as transactions of packet_len bytes each.
+ */
+/******************************************************************************/
+static bool SendPackets( const struct Ascii7Seg_Transport_S * transport,
+                         const uint8_t * buf,
+                         size_t len,
+                         size_t packet_len )
+{
+   assert( 0 == (len % packet_len) );
+
+   for ( size_t i = 0; i < len; i += packet_len )
+   {
+      if ( !transport->write(transport->ctx, &buf[i], packet_len) )
+      {
+         return false;
+      }
+   }
+
+   return true;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file ascii7seg_encoder.c
+ * @brief Implementation of the runtime-selectable encoders.
+ *
+ * Ascii7Seg_EncoderInit() does the only lookup. Every conversion after that is
+ * a NULL check and one call through the kernel it found, with nothing of the
+ * range or strategy left to branch on.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+#include "ascii7seg_encoder.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Local Data */
+
+#ifdef ASCII_7SEG_RUNTIME_DISPATCH
+
+// Each one is src/ascii7seg.c, built with ASCII_7SEG_KERNEL=<name>
+extern const struct Ascii7Seg_Kernel_S Ascii7Seg_KernelNums;
+extern const struct Ascii7Seg_Kernel_S Ascii7Seg_KernelNumsErr;
+extern const struct Ascii7Seg_Kernel_S Ascii7Seg_KernelFull;
+extern const struct Ascii7Seg_Kernel_S Ascii7Seg_KernelNumsComputed;
+extern const struct Ascii7Seg_Kernel_S Ascii7Seg_KernelNumsErrComputed;
+extern const struct Ascii7Seg_Kernel_S Ascii7Seg_KernelFullComputed;
+
+static const struct Ascii7Seg_Kernel_S * const Kernels[ASCII_7SEG_NUM_OF_RANGES][ASCII_7SEG_NUM_OF_STRATEGIES] =
+{
+   [ASCII_7SEG_RANGE_NUMS_ONLY] =
+   {
+      [ASCII_7SEG_STRATEGY_LOOKUP_TABLE] = &Ascii7Seg_KernelNums,
+      [ASCII_7SEG_STRATEGY_COMPUTED]     = &Ascii7Seg_KernelNumsComputed,
+   },
+   [ASCII_7SEG_RANGE_NUMS_AND_ERROR_ONLY] =
+   {
+      [ASCII_7SEG_STRATEGY_LOOKUP_TABLE] = &Ascii7Seg_KernelNumsErr,
+      [ASCII_7SEG_STRATEGY_COMPUTED]     = &Ascii7Seg_KernelNumsErrComputed,
+   },
+   [ASCII_7SEG_RANGE_FULL] =
+   {
+      [ASCII_7SEG_STRATEGY_LOOKUP_TABLE] = &Ascii7Seg_KernelFull,
+      [ASCII_7SEG_STRATEGY_COMPUTED]     = &Ascii7Seg_KernelFullComputed,
+   },
+};
+
+#else
+
+//! The core API, as the one kernel of this build
+static const struct Ascii7Seg_Kernel_S ConfiguredKernel =
+{
+   .convert_char = Ascii7Seg_ConvertChar,
+   .convert_word = Ascii7Seg_ConvertWord,
+   .convert_bytes = Ascii7Seg_ConvertBytes,
+   .is_supported_char = Ascii7Seg_IsSupportedChar,
+#ifdef ASCII_7SEG_HAS_DP
+   .convert_word_ex = Ascii7Seg_ConvertWordEx,
+#endif
+};
+
+#endif // ASCII_7SEG_RUNTIME_DISPATCH
+
+/* Private Function Prototypes */
+
+static inline bool IsSetUp( const struct Ascii7Seg_Encoder_S * encoder );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+bool Ascii7Seg_EncoderInit( struct Ascii7Seg_Encoder_S * encoder,
+                            enum Ascii7Seg_Range_E range,
+                            enum Ascii7Seg_Strategy_E strategy )
+{
+   if ( (NULL == encoder) ||
+        ((unsigned int)range >= (unsigned int)ASCII_7SEG_NUM_OF_RANGES) ||
+        ((unsigned int)strategy >= (unsigned int)ASCII_7SEG_NUM_OF_STRATEGIES) )
+   {
+      return false;
+   }
+
+#ifdef ASCII_7SEG_RUNTIME_DISPATCH
+   encoder->kernel = Kernels[range][strategy];
+#else
+   if ( (ASCII_7SEG_CONFIGURED_RANGE != range) || (ASCII_7SEG_CONFIGURED_STRATEGY != strategy) )
+   {
+      return false;
+   }
+   encoder->kernel = &ConfiguredKernel;
+#endif
+
+   encoder->range = range;
+   encoder->strategy = strategy;
+
+   return true;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_EncoderConvertChar( const struct Ascii7Seg_Encoder_S * encoder,
+                                   char ascii_char,
+                                   union Ascii7Seg_Encoding_U * buf )
+{
+   if ( !IsSetUp(encoder) )
+   {
+      return false;
+   }
+
+   return encoder->kernel->convert_char( ascii_char, buf );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_EncoderConvertWord( const struct Ascii7Seg_Encoder_S * encoder,
+                                     const char * str,
+                                     size_t str_len,
+                                     union Ascii7Seg_Encoding_U * buf )
+{
+   if ( !IsSetUp(encoder) )
+   {
+      return 0;
+   }
+
+   return encoder->kernel->convert_word( str, str_len, buf );
+}
+
+/******************************************************************************/
+struct Ascii7Seg_Result_S Ascii7Seg_EncoderConvertBytes( const struct Ascii7Seg_Encoder_S * encoder,
+                                                         const char * src,
+                                                         size_t src_len,
+                                                         union Ascii7Seg_Encoding_U * buf,
+                                                         size_t buf_cap )
+{
+   if ( !IsSetUp(encoder) )
+   {
+      const struct Ascii7Seg_Result_S result =
+      {
+         .converted = 0,
+         .invalid_idx = ASCII_7SEG_NO_INVALID_IDX,
+         .invalid_char = '\0'
+      };
+      return result;
+   }
+
+   return encoder->kernel->convert_bytes( src, src_len, buf, buf_cap );
+}
+
+/******************************************************************************/
+bool Ascii7Seg_EncoderIsSupportedChar( const struct Ascii7Seg_Encoder_S * encoder,
+                                       char ascii_char )
+{
+   if ( !IsSetUp(encoder) )
+   {
+      return false;
+   }
+
+   return encoder->kernel->is_supported_char( ascii_char );
+}
+
+#ifdef ASCII_7SEG_HAS_DP
+
+/******************************************************************************/
+struct Ascii7Seg_WordResult_S Ascii7Seg_EncoderConvertWordEx( const struct Ascii7Seg_Encoder_S * encoder,
+                                                              const char * str,
+                                                              size_t str_len,
+                                                              union Ascii7Seg_Encoding_U * buf,
+                                                              size_t buf_cap,
+                                                              unsigned int options )
+{
+   if ( !IsSetUp(encoder) )
+   {
+      const struct Ascii7Seg_WordResult_S result = { .consumed = 0, .produced = 0 };
+      return result;
+   }
+
+   return encoder->kernel->convert_word_ex( str, str_len, buf, buf_cap, options );
+}
+
+#endif // ASCII_7SEG_HAS_DP
+
+/* Private Function Implementations */
+
+/**
+ * An encoder that was zeroed but never set up has no kernel, and is treated
+ * like a NULL one.
+ */
+/******************************************************************************/
+static inline bool IsSetUp( const struct Ascii7Seg_Encoder_S * encoder )
+{
+   return (NULL != encoder) && (NULL != encoder->kernel);
+}
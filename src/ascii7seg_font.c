@@ -0,0 +1,271 @@
+/**
+ * @file ascii7seg_font.c
+ * @brief Implementation of the width-generic segment engine and its fonts.
+ *
+ * Every unsupported character has a glyph of 0 and every supported one has at
+ * least one segment on, so a single load from the font both validates and
+ * encodes a character, whatever the width.
+ *
+ * Ascii7Seg_Font7Seg has no table: it goes through the 7-segment core, so it
+ * gets its encodings, range variant and bulk kernels, and widens the packed
+ * encodings to uint16_t cells a chunk at a time.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+#include "ascii7seg_font.h"
+#include "ascii7seg_pack.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+//! Encodings converted by the 7-segment core per chunk, before being widened
+#define CORE_CHUNK_LEN   64u
+
+/* Local Datatypes */
+
+/* Local Data */
+
+/**
+ * The glyphs of the 14- and 16-segment fonts. They are generated by
+ * scripts/gen_font_tables.py from scripts/ascii14seg_encodings.csv, so edit
+ * the CSV and re-run the script with `--write src/ascii7seg_font.c` rather
+ * than editing them by hand.
+ */
+// BEGIN GENERATED CODE: scripts/gen_font_tables.py (do not edit by hand)
+static const uint16_t Font14Glyphs[ASCII_7SEG_FONT_NUM_CHARS] =
+{
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x00 - 0x07
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x08 - 0x0F
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x10 - 0x17
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x18 - 0x1F
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x20 - 0x27
+   0x0C00, 0x2100, 0x3FC0, 0x12C0, 0x0000, 0x00C0, 0x0000, 0x2400,  // '(' - '/'
+   0x243F, 0x0406, 0x00DB, 0x008F, 0x00E6, 0x00ED, 0x00FD, 0x0007,  // '0' - '7'
+   0x00FF, 0x00EF, 0x0000, 0x0000, 0x0C00, 0x00C8, 0x2100, 0x0000,  // '8' - '?'
+   0x0000, 0x00F7, 0x128F, 0x0039, 0x120F, 0x0079, 0x0071, 0x00BD,  // '@' - 'G'
+   0x00F6, 0x1209, 0x001E, 0x0C70, 0x0038, 0x0536, 0x0936, 0x003F,  // 'H' - 'O'
+   0x00F3, 0x083F, 0x08F3, 0x00ED, 0x1201, 0x003E, 0x2430, 0x2836,  // 'P' - 'W'
+   0x2D00, 0x1500, 0x2409, 0x0039, 0x0900, 0x000F, 0x0000, 0x0008,  // 'X' - '_'
+   0x0000, 0x00F7, 0x128F, 0x0039, 0x120F, 0x0079, 0x0071, 0x00BD,  // '`' - 'g'
+   0x00F6, 0x1209, 0x001E, 0x0C70, 0x0038, 0x0536, 0x0936, 0x003F,  // 'h' - 'o'
+   0x00F3, 0x083F, 0x08F3, 0x00ED, 0x1201, 0x003E, 0x2430, 0x2836,  // 'p' - 'w'
+   0x2D00, 0x1500, 0x2409, 0x0000, 0x1200, 0x0000, 0x0000, 0x0000   // 'x' - 0x7F
+};
+
+static const uint16_t Font16Glyphs[ASCII_7SEG_FONT_NUM_CHARS] =
+{
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x00 - 0x07
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x08 - 0x0F
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x10 - 0x17
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x18 - 0x1F
+   0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,  // 0x20 - 0x27
+   0x3000, 0x8400, 0xFF00, 0x4B00, 0x0000, 0x0300, 0x0000, 0x9000,  // '(' - '/'
+   0x90FF, 0x100C, 0x0377, 0x023F, 0x038C, 0x03BB, 0x03FB, 0x000F,  // '0' - '7'
+   0x03FF, 0x03BF, 0x0000, 0x0000, 0x3000, 0x0330, 0x8400, 0x0000,  // '8' - '?'
+   0x0000, 0x03CF, 0x4A3F, 0x00F3, 0x483F, 0x01F3, 0x01C3, 0x02FB,  // '@' - 'G'
+   0x03CC, 0x4833, 0x007C, 0x31C0, 0x00F0, 0x14CC, 0x24CC, 0x00FF,  // 'H' - 'O'
+   0x03C7, 0x20FF, 0x23C7, 0x03BB, 0x4803, 0x00FC, 0x90C0, 0xA0CC,  // 'P' - 'W'
+   0xB400, 0x5400, 0x9033, 0x00F3, 0x2400, 0x003F, 0x0000, 0x0030,  // 'X' - '_'
+   0x0000, 0x03CF, 0x4A3F, 0x00F3, 0x483F, 0x01F3, 0x01C3, 0x02FB,  // '`' - 'g'
+   0x03CC, 0x4833, 0x007C, 0x31C0, 0x00F0, 0x14CC, 0x24CC, 0x00FF,  // 'h' - 'o'
+   0x03C7, 0x20FF, 0x23C7, 0x03BB, 0x4803, 0x00FC, 0x90C0, 0xA0CC,  // 'p' - 'w'
+   0xB400, 0x5400, 0x9033, 0x0000, 0x4800, 0x0000, 0x0000, 0x0000   // 'x' - 0x7F
+};
+// END GENERATED CODE (76 / 76 supported characters)
+
+/* Public Data */
+
+const struct Ascii7Seg_Font_S Ascii7Seg_Font7Seg =
+{
+   .glyphs = NULL,   // Backed by the 7-segment core
+   .dp_mask = (uint16_t)( 1u << 7 ),
+   .num_segments = 7u
+};
+
+const struct Ascii7Seg_Font_S Ascii7Seg_Font14Seg =
+{
+   .glyphs = Font14Glyphs,
+   .dp_mask = (uint16_t)( 1u << 14 ),
+   .num_segments = 14u
+};
+
+const struct Ascii7Seg_Font_S Ascii7Seg_Font16Seg =
+{
+   .glyphs = Font16Glyphs,
+   .dp_mask = 0u,
+   .num_segments = 16u
+};
+
+/* Private Function Prototypes */
+
+static inline uint16_t LookUp( const struct Ascii7Seg_Font_S * font, char ascii_char );
+static size_t ConvertTable( const struct Ascii7Seg_Font_S * font,
+                            const char * src,
+                            size_t len,
+                            uint16_t * buf );
+static size_t ConvertCore( const char * src, size_t len, uint16_t * buf );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+bool Ascii7Seg_FontConvertChar( const struct Ascii7Seg_Font_S * font,
+                                char ascii_char,
+                                uint16_t * buf )
+{
+   if ( (NULL == font) || (NULL == buf) )
+   {
+      return false;
+   }
+
+   *buf = LookUp( font, ascii_char );
+
+   return ( 0u != *buf );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_FontConvertWord( const struct Ascii7Seg_Font_S * font,
+                                  const char * str,
+                                  size_t str_len,
+                                  uint16_t * buf )
+{
+   if ( (NULL == font) || (NULL == str) || (NULL == buf) )
+   {
+      return 0;
+   }
+
+   // The null terminator is unsupported, so either path stops there too
+   return ( NULL == font->glyphs ) ? ConvertCore( str, str_len, buf )
+                                   : ConvertTable( font, str, str_len, buf );
+}
+
+/******************************************************************************/
+struct Ascii7Seg_Result_S Ascii7Seg_FontConvertBytes( const struct Ascii7Seg_Font_S * font,
+                                                      const char * src,
+                                                      size_t src_len,
+                                                      uint16_t * buf,
+                                                      size_t buf_cap )
+{
+   struct Ascii7Seg_Result_S result =
+   {
+      .converted = 0,
+      .invalid_idx = ASCII_7SEG_NO_INVALID_IDX,
+      .invalid_char = '\0'
+   };
+
+   if ( (NULL == font) || (NULL == src) || (NULL == buf) )
+   {
+      return result;
+   }
+
+   const size_t len = (src_len < buf_cap) ? src_len : buf_cap;
+
+   result.converted = ( NULL == font->glyphs ) ? ConvertCore( src, len, buf )
+                                               : ConvertTable( font, src, len, buf );
+
+   if ( result.converted < len )
+   {
+      result.invalid_idx = result.converted;
+      result.invalid_char = src[result.converted];
+   }
+
+   return result;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_FontIsSupportedChar( const struct Ascii7Seg_Font_S * font,
+                                    char ascii_char )
+{
+   return ( NULL != font ) && ( 0u != LookUp(font, ascii_char) );
+}
+
+/* Private Function Implementations */
+
+/**
+ * The glyph of ascii_char in font, or 0 if it isn't supported (which includes
+ * every character outside of ASCII).
+ */
+/******************************************************************************/
+static inline uint16_t LookUp( const struct Ascii7Seg_Font_S * font, char ascii_char )
+{
+   const uint8_t c = (uint8_t)ascii_char;
+
+   if ( NULL == font->glyphs )
+   {
+      union Ascii7Seg_Encoding_U encoding;
+      return Ascii7Seg_ConvertChar( ascii_char, &encoding )
+             ? (uint16_t)( Ascii7Seg_PackEncoding(&encoding) & ASCII_7SEG_PACKED_SEGMENTS_MASK )
+             : 0u;
+   }
+
+   return ( c < ASCII_7SEG_FONT_NUM_CHARS ) ? font->glyphs[c] : 0u;
+}
+
+/**
+ * Converts up to len characters of src with the glyph table of font, stopping
+ * at the first unsupported one. Returns the number converted.
+ */
+/******************************************************************************/
+static size_t ConvertTable( const struct Ascii7Seg_Font_S * font,
+                            const char * src,
+                            size_t len,
+                            uint16_t * buf )
+{
+   size_t i = 0;
+   while ( i < len )
+   {
+      const uint16_t glyph = LookUp( font, src[i] );
+      if ( 0u == glyph )
+      {
+         break;
+      }
+
+      buf[i] = glyph;
+      i++;
+   }
+
+   return i;
+}
+
+/**
+ * Same as ConvertTable() for Ascii7Seg_Font7Seg: Ascii7Seg_ConvertBytes()
+ * validates and encodes each chunk into a scratch buffer, whose packed
+ * encodings are then widened into buf. buf is never written past the number
+ * of characters converted.
+ */
+/******************************************************************************/
+static size_t ConvertCore( const char * src, size_t len, uint16_t * buf )
+{
+   union Ascii7Seg_Encoding_U chunk[CORE_CHUNK_LEN];
+
+   size_t num_converted = 0;
+   while ( num_converted < len )
+   {
+      const size_t remaining = len - num_converted;
+      const size_t chunk_len = ( remaining < CORE_CHUNK_LEN ) ? remaining : CORE_CHUNK_LEN;
+
+      const size_t converted =
+         Ascii7Seg_ConvertBytes( &src[num_converted], chunk_len, chunk, CORE_CHUNK_LEN ).converted;
+      for ( size_t i = 0; i < converted; i++ )
+      {
+         buf[num_converted + i] =
+            (uint16_t)( Ascii7Seg_PackEncoding(&chunk[i]) & ASCII_7SEG_PACKED_SEGMENTS_MASK );
+      }
+      num_converted += converted;
+
+      if ( converted < chunk_len )
+      {
+         // Stopped on an unsupported character
+         break;
+      }
+   }
+
+   return num_converted;
+}
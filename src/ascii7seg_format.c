@@ -0,0 +1,775 @@
+/**
+ * @file ascii7seg_format.c
+ * @brief Implementation of the number formatting API.
+ *
+ * Digits are produced from the right, two at a time: the value is split into
+ * its quotient and remainder by 100, and the remainder indexes a 100-entry
+ * table with the encodings of both its digits. The split is a multiply by the
+ * reciprocal of 100 and a shift (see "Integer Division by Constants" in Hacker's
+ * Delight, 2nd ed.), so there are no divides, hardware or library.
+ *
+ * Ascii7Seg_ConvertFloat() doesn't use the FPU either. It scales the float by
+ * 10^frac_digits exactly in integer arithmetic, from the bits of the float, and
+ * rounds half to even, so its digits are the same as printf's "%.*f" (and an
+ * MCU without an FPU never calls into a soft-float library).
+ *
+ * Ascii7Seg_ConvertHex() maps each nibble through a 16-entry table of packed
+ * encodings. Bit-packed, on an x86 host with GCC or clang, that table fits in
+ * one vector register and PSHUFB looks up 16 or 32 nibbles at a time, with the
+ * kernel (SSSE3 or AVX2) picked once at load time like the bulk kernels of
+ * Ascii7Seg_ConvertWord().
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+#include <assert.h>
+#include "ascii7seg.h"
+#include "ascii7seg_format.h"
+#include "ascii7seg_pack.h"
+#include "ascii7seg_config.h"
+#ifdef TEST
+#include "ascii7seg_test.h"
+#endif
+
+/**
+ * The vector hex kernels store the looked-up bytes straight to buf, so they
+ * need the bit-packed layout. Unlike the bulk kernels of Ascii7Seg_ConvertWord(),
+ * they don't depend on the range variant, since the hex digits have a table of
+ * their own.
+ */
+#if defined(ASCII_7SEG_BIT_PACK) && \
+    !defined(ASCII_7SEG_NO_SIMD) && \
+    (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define ASCII_7SEG_HEX_SIMD_X86
+#include <immintrin.h>
+#endif
+
+/* Local Macro Definitions */
+
+// Constant-like macros
+
+//! Most digits in a uint64_t
+#define MAX_DIGITS_U64     20u
+
+#ifdef ASCII_7SEG_HAS_DP
+
+// Fields of an IEEE-754 binary32 float
+#define FLOAT_SIGN_SHIFT   31u
+#define FLOAT_EXP_SHIFT    23u
+#define FLOAT_EXP_MASK     0xFFu
+#define FLOAT_FRAC_MASK    UINT32_C(0x7FFFFF)
+#define FLOAT_IMPLICIT_BIT UINT32_C(0x800000)
+#define FLOAT_EXP_BIAS     150  //!< Exponent bias plus the 23 fraction bits, i.e. value = mantissa * 2^(exp - 150)
+
+#if (FLT_RADIX != 2) || (FLT_MANT_DIG != 24) || (FLT_MAX_EXP != 128)
+#error "Ascii7Seg_ConvertFloat() expects float to be IEEE-754 binary32"
+#endif
+
+#endif // ASCII_7SEG_HAS_DP
+
+// Packed encodings (bit s = segment s, a = 0 ... g = 6) of the symbols that
+// aren't digits
+#define SEGS_BLANK         0x00u
+#define SEGS_MINUS         0x40u
+
+//! Nibbles in a byte, i.e. hex digits
+#define HEX_DIGITS_PER_BYTE   2u
+
+// Function-like macros
+
+#define MIN(a, b) ( ((a) < (b)) ? (a) : (b) )
+
+/* Local Datatypes */
+
+//! Rows of HexGlyphs, one per set of hex letters
+enum HexCase_E
+{
+   HEX_CASE_MIXED,
+   HEX_CASE_UPPER,
+   HEX_CASE_LOWER,
+   HEX_CASE_NUM_OF_CASES
+};
+
+/**
+ * Signature shared by the hex kernels. Each one dumps all num_bytes bytes (in
+ * reverse if reverse is set) into buf, looking nibbles up in the 16 glyphs.
+ */
+typedef void (*HexKernel_T)( const uint8_t * bytes,
+                             size_t num_bytes,
+                             bool reverse,
+                             const uint8_t * glyphs,
+                             union Ascii7Seg_Encoding_U * buf );
+
+/* Local Data */
+
+/**
+ * HexGlyphs[hex_case][n] holds the packed encoding of hex digit n. Every
+ * variant keeps this table, since it is only 48 bytes and letters can't be
+ * computed in the numeric variants.
+ *
+ * DigitPairLUT[n] holds the packed encodings of the two digits of n (00 to 99),
+ * tens digit first. 200 bytes, where a table of one digit at a time would take
+ * twice as many multiplies to use.
+ *
+ * Both are generated by scripts/gen_format_tables.py from
+ * scripts/ascii7seg_encodings.csv, so edit the CSV and re-run the script with
+ * `--write src/ascii7seg_format.c` rather than editing them by hand.
+ */
+// BEGIN GENERATED CODE: scripts/gen_format_tables.py (do not edit by hand)
+static const uint8_t HexGlyphs[HEX_CASE_NUM_OF_CASES][16] =
+{
+   // 0-9 AbCdEF
+   [HEX_CASE_MIXED] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F, 0x77, 0x7C, 0x39, 0x5E, 0x79, 0x71 },
+   // 0-9 ABCDEF (B and D look like 8 and 0)
+   [HEX_CASE_UPPER] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F, 0x77, 0x7F, 0x39, 0x3F, 0x79, 0x71 },
+   // 0-9 abcdef
+   [HEX_CASE_LOWER] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F, 0x5F, 0x7C, 0x58, 0x5E, 0x7B, 0x71 }
+};
+
+#ifndef ASCII_7SEG_DONT_USE_LOOKUP_TABLE
+
+static const uint8_t DigitPairLUT[100][2] =
+{
+   { 0x3F, 0x3F }, { 0x3F, 0x06 }, { 0x3F, 0x5B }, { 0x3F, 0x4F }, { 0x3F, 0x66 },  // 00 - 04
+   { 0x3F, 0x6D }, { 0x3F, 0x7D }, { 0x3F, 0x07 }, { 0x3F, 0x7F }, { 0x3F, 0x6F },  // 05 - 09
+   { 0x06, 0x3F }, { 0x06, 0x06 }, { 0x06, 0x5B }, { 0x06, 0x4F }, { 0x06, 0x66 },  // 10 - 14
+   { 0x06, 0x6D }, { 0x06, 0x7D }, { 0x06, 0x07 }, { 0x06, 0x7F }, { 0x06, 0x6F },  // 15 - 19
+   { 0x5B, 0x3F }, { 0x5B, 0x06 }, { 0x5B, 0x5B }, { 0x5B, 0x4F }, { 0x5B, 0x66 },  // 20 - 24
+   { 0x5B, 0x6D }, { 0x5B, 0x7D }, { 0x5B, 0x07 }, { 0x5B, 0x7F }, { 0x5B, 0x6F },  // 25 - 29
+   { 0x4F, 0x3F }, { 0x4F, 0x06 }, { 0x4F, 0x5B }, { 0x4F, 0x4F }, { 0x4F, 0x66 },  // 30 - 34
+   { 0x4F, 0x6D }, { 0x4F, 0x7D }, { 0x4F, 0x07 }, { 0x4F, 0x7F }, { 0x4F, 0x6F },  // 35 - 39
+   { 0x66, 0x3F }, { 0x66, 0x06 }, { 0x66, 0x5B }, { 0x66, 0x4F }, { 0x66, 0x66 },  // 40 - 44
+   { 0x66, 0x6D }, { 0x66, 0x7D }, { 0x66, 0x07 }, { 0x66, 0x7F }, { 0x66, 0x6F },  // 45 - 49
+   { 0x6D, 0x3F }, { 0x6D, 0x06 }, { 0x6D, 0x5B }, { 0x6D, 0x4F }, { 0x6D, 0x66 },  // 50 - 54
+   { 0x6D, 0x6D }, { 0x6D, 0x7D }, { 0x6D, 0x07 }, { 0x6D, 0x7F }, { 0x6D, 0x6F },  // 55 - 59
+   { 0x7D, 0x3F }, { 0x7D, 0x06 }, { 0x7D, 0x5B }, { 0x7D, 0x4F }, { 0x7D, 0x66 },  // 60 - 64
+   { 0x7D, 0x6D }, { 0x7D, 0x7D }, { 0x7D, 0x07 }, { 0x7D, 0x7F }, { 0x7D, 0x6F },  // 65 - 69
+   { 0x07, 0x3F }, { 0x07, 0x06 }, { 0x07, 0x5B }, { 0x07, 0x4F }, { 0x07, 0x66 },  // 70 - 74
+   { 0x07, 0x6D }, { 0x07, 0x7D }, { 0x07, 0x07 }, { 0x07, 0x7F }, { 0x07, 0x6F },  // 75 - 79
+   { 0x7F, 0x3F }, { 0x7F, 0x06 }, { 0x7F, 0x5B }, { 0x7F, 0x4F }, { 0x7F, 0x66 },  // 80 - 84
+   { 0x7F, 0x6D }, { 0x7F, 0x7D }, { 0x7F, 0x07 }, { 0x7F, 0x7F }, { 0x7F, 0x6F },  // 85 - 89
+   { 0x6F, 0x3F }, { 0x6F, 0x06 }, { 0x6F, 0x5B }, { 0x6F, 0x4F }, { 0x6F, 0x66 },  // 90 - 94
+   { 0x6F, 0x6D }, { 0x6F, 0x7D }, { 0x6F, 0x07 }, { 0x6F, 0x7F }, { 0x6F, 0x6F }   // 95 - 99
+};
+
+#endif // ASCII_7SEG_DONT_USE_LOOKUP_TABLE
+// END GENERATED CODE
+
+/* Private Function Prototypes */
+
+static size_t Format( uint64_t magnitude,
+                      bool negative,
+                      unsigned int frac_digits,
+                      union Ascii7Seg_Encoding_U * buf,
+                      size_t width,
+                      unsigned int flags );
+#ifdef ASCII_7SEG_HAS_DP
+static bool ScaleFloat( float value, unsigned int frac_digits, uint64_t * magnitude, bool * negative );
+#endif
+static inline size_t NumDigits( uint64_t value );
+static inline uint32_t Div100_U32( uint32_t value );
+static inline uint64_t Div100_U64( uint64_t value );
+static inline uint64_t MulHi_U64( uint64_t x, uint64_t y );
+static inline void WritePair( uint32_t pair, union Ascii7Seg_Encoding_U * buf );
+static inline void WriteDigit( uint32_t digit, union Ascii7Seg_Encoding_U * buf );
+static void Hex_ScalarRange( const uint8_t * bytes,
+                             size_t num_bytes,
+                             size_t start,
+                             bool reverse,
+                             const uint8_t * glyphs,
+                             union Ascii7Seg_Encoding_U * buf );
+static void Hex_Scalar( const uint8_t * bytes,
+                        size_t num_bytes,
+                        bool reverse,
+                        const uint8_t * glyphs,
+                        union Ascii7Seg_Encoding_U * buf );
+
+#ifdef ASCII_7SEG_HEX_SIMD_X86
+
+static void Hex_SSSE3( const uint8_t * bytes,
+                       size_t num_bytes,
+                       bool reverse,
+                       const uint8_t * glyphs,
+                       union Ascii7Seg_Encoding_U * buf );
+static void Hex_AVX2( const uint8_t * bytes,
+                      size_t num_bytes,
+                      bool reverse,
+                      const uint8_t * glyphs,
+                      union Ascii7Seg_Encoding_U * buf );
+static void SelectHexKernel(void);
+
+#endif // ASCII_7SEG_HEX_SIMD_X86
+
+/**
+ * Kernel used by Ascii7Seg_ConvertHex(). Where there are vector kernels, this
+ * starts out scalar and is upgraded by SelectHexKernel() at load time.
+ */
+static HexKernel_T HexKernel = Hex_Scalar;
+
+/* Public API Implementations */
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertU32( uint32_t value,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t width,
+                             unsigned int flags )
+{
+   return Format( value, false, 0, buf, width, flags );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertI32( int32_t value,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t width,
+                             unsigned int flags )
+{
+   // Negate in unsigned arithmetic, which is fine for INT32_MIN too
+   uint32_t magnitude = (value < 0) ? ( 0u - (uint32_t)value ) : (uint32_t)value;
+   return Format( magnitude, (value < 0), 0, buf, width, flags );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertU64( uint64_t value,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t width,
+                             unsigned int flags )
+{
+   return Format( value, false, 0, buf, width, flags );
+}
+
+#ifdef ASCII_7SEG_HAS_DP
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertFixed( int32_t value,
+                               unsigned int frac_digits,
+                               union Ascii7Seg_Encoding_U * buf,
+                               size_t width,
+                               unsigned int flags )
+{
+   if ( frac_digits > ASCII_7SEG_FMT_MAX_FRAC_DIGITS )
+   {
+      return 0;
+   }
+
+   uint32_t magnitude = (value < 0) ? ( 0u - (uint32_t)value ) : (uint32_t)value;
+   return Format( magnitude, (value < 0), frac_digits, buf, width, flags );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertFloat( float value,
+                               unsigned int frac_digits,
+                               union Ascii7Seg_Encoding_U * buf,
+                               size_t width,
+                               unsigned int flags )
+{
+   uint64_t magnitude;
+   bool negative;
+
+   if ( (frac_digits > ASCII_7SEG_FMT_MAX_FRAC_DIGITS) ||
+        !ScaleFloat(value, frac_digits, &magnitude, &negative) )
+   {
+      return 0;
+   }
+
+   return Format( magnitude, negative, frac_digits, buf, width, flags );
+}
+
+#endif // ASCII_7SEG_HAS_DP
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertHex( const void * bytes,
+                             size_t num_bytes,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t buf_cap,
+                             unsigned int flags )
+{
+   const bool upper = ( 0u != (flags & ASCII_7SEG_FMT_HEX_UPPER) );
+   const bool lower = ( 0u != (flags & ASCII_7SEG_FMT_HEX_LOWER) );
+
+   if ( (NULL == bytes) || (NULL == buf) || (upper && lower) )
+   {
+      return 0;
+   }
+
+   const enum HexCase_E hex_case = upper ? HEX_CASE_UPPER :
+                                   lower ? HEX_CASE_LOWER :
+                                           HEX_CASE_MIXED;
+
+   num_bytes = MIN( num_bytes, buf_cap / HEX_DIGITS_PER_BYTE );
+   HexKernel( (const uint8_t *)bytes,
+              num_bytes,
+              ( 0u != (flags & ASCII_7SEG_FMT_HEX_REVERSE) ),
+              HexGlyphs[hex_case],
+              buf );
+
+   return num_bytes * HEX_DIGITS_PER_BYTE;
+}
+
+#ifdef TEST
+
+/******************************************************************************/
+bool Ascii7Seg_TestForceHexKernel( size_t kernel )
+{
+#ifdef ASCII_7SEG_HEX_SIMD_X86
+   HexKernel_T forced = NULL;
+
+   switch ( kernel )
+   {
+      case 0:
+         forced = Hex_Scalar;
+         break;
+
+      case 1:
+         forced = __builtin_cpu_supports("ssse3") ? Hex_SSSE3 : NULL;
+         break;
+
+      case 2:
+         forced = __builtin_cpu_supports("avx2") ? Hex_AVX2 : NULL;
+         break;
+
+      case SIZE_MAX:
+         SelectHexKernel();
+         return true;
+
+      default:
+         break;
+   }
+
+   if ( NULL == forced )
+   {
+      return false;
+   }
+
+   HexKernel = forced;
+   return true;
+#else
+   // Without the vector kernels, there is only the scalar one
+   return ( (0u == kernel) || (SIZE_MAX == kernel) );
+#endif // ASCII_7SEG_HEX_SIMD_X86
+}
+
+#endif // TEST
+
+/* Private Function Implementations */
+
+/**
+ * Body of every public formatter: writes magnitude / 10^frac_digits (with a
+ * minus sign if negative) right-aligned into buf[0] to buf[width - 1], or
+ * nothing at all if it doesn't fit. The decimal point, if any, goes on the ones
+ * digit, and there is always at least one digit before it.
+ */
+/******************************************************************************/
+static size_t Format( uint64_t magnitude,
+                      bool negative,
+                      unsigned int frac_digits,
+                      union Ascii7Seg_Encoding_U * buf,
+                      size_t width,
+                      unsigned int flags )
+{
+#ifndef ASCII_7SEG_HAS_DP
+   assert( 0 == frac_digits );
+#endif
+
+   size_t num_digits = NumDigits( magnitude );
+   if ( num_digits <= frac_digits )
+   {
+      num_digits = (size_t)frac_digits + 1u;
+   }
+
+   if ( (NULL == buf) || (width < num_digits + (negative ? 1u : 0u)) )
+   {
+      return 0;
+   }
+
+   size_t pos = width;
+
+   // Only values past 32 bits pay for the 64-bit reciprocal multiply
+   while ( magnitude > UINT32_MAX )
+   {
+      uint64_t quotient = Div100_U64( magnitude );
+      pos -= 2;
+      WritePair( (uint32_t)(magnitude - (quotient * 100u)), &buf[pos] );
+      magnitude = quotient;
+   }
+
+   uint32_t value = (uint32_t)magnitude;
+   while ( value >= 100u )
+   {
+      uint32_t quotient = Div100_U32( value );
+      pos -= 2;
+      WritePair( value - (quotient * 100u), &buf[pos] );
+      value = quotient;
+   }
+
+   if ( value >= 10u )
+   {
+      pos -= 2;
+      WritePair( value, &buf[pos] );
+   }
+   else
+   {
+      pos--;
+      WriteDigit( value, &buf[pos] );
+   }
+
+   // Zeros between the value and the decimal point, e.g. the first two of 0.05
+   while ( (width - pos) < num_digits )
+   {
+      pos--;
+      WriteDigit( 0, &buf[pos] );
+   }
+
+   assert( width - pos == num_digits );
+
+#ifdef ASCII_7SEG_HAS_DP
+   if ( frac_digits > 0 )
+   {
+      buf[width - 1u - frac_digits].segments.dp = 1;
+   }
+#endif
+
+   // Everything left of the digits
+   const bool zero_pad = ( 0u != (flags & ASCII_7SEG_FMT_ZERO_PAD) );
+   if ( negative && !zero_pad )
+   {
+      pos--;
+      Ascii7Seg_UnpackEncoding( SEGS_MINUS, &buf[pos] );
+   }
+
+   for ( size_t i = 0; i < pos; i++ )
+   {
+      if ( zero_pad )
+      {
+         WriteDigit( 0, &buf[i] );
+      }
+      else
+      {
+         Ascii7Seg_UnpackEncoding( SEGS_BLANK, &buf[i] );
+      }
+   }
+
+   if ( negative && zero_pad )
+   {
+      Ascii7Seg_UnpackEncoding( SEGS_MINUS, &buf[0] );
+   }
+
+   return width;
+}
+
+#ifdef ASCII_7SEG_HAS_DP
+
+/**
+ * Rounds value * 10^frac_digits to the nearest integer (ties to even), exactly.
+ *
+ * A finite float is mantissa * 2^exp, so value * 10^frac_digits is
+ * mantissa * 5^frac_digits * 2^(exp + frac_digits). The first product is at
+ * most 24 + 21 bits, so it's exact in a uint64_t, and what's left is a shift,
+ * where the bits shifted out decide the rounding.
+ *
+ * @return false if value is infinite, NaN, or too big for a uint64_t once scaled
+ */
+/******************************************************************************/
+static bool ScaleFloat( float value, unsigned int frac_digits, uint64_t * magnitude, bool * negative )
+{
+   static const uint32_t PowersOf5[ASCII_7SEG_FMT_MAX_FRAC_DIGITS + 1] =
+   {
+      1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u, 390625u, 1953125u
+   };
+
+   uint32_t bits;
+   (void)memcpy( &bits, &value, sizeof(bits) );
+
+   const uint32_t biased_exp = (bits >> FLOAT_EXP_SHIFT) & FLOAT_EXP_MASK;
+   if ( FLOAT_EXP_MASK == biased_exp )
+   {
+      return false; // Infinity or NaN
+   }
+
+   // Subnormals have no implicit bit and the exponent of the smallest normal
+   const uint32_t mantissa = (0u == biased_exp) ? (bits & FLOAT_FRAC_MASK) :
+                                                  ((bits & FLOAT_FRAC_MASK) | FLOAT_IMPLICIT_BIT);
+   const int32_t exp = ( (0u == biased_exp) ? 1 : (int32_t)biased_exp ) - FLOAT_EXP_BIAS;
+
+   const uint64_t product = (uint64_t)mantissa * PowersOf5[frac_digits];
+   const int32_t shift = exp + (int32_t)frac_digits;
+
+   uint64_t scaled;
+   if ( shift >= 0 )
+   {
+      if ( (shift >= 64) || (product > (UINT64_MAX >> shift)) )
+      {
+         return false;
+      }
+      scaled = product << shift;
+   }
+   else if ( shift > -64 )
+   {
+      const uint32_t right = (uint32_t)(-shift);
+      const uint64_t dropped = product & ( (UINT64_C(1) << right) - 1u );
+      const uint64_t half = UINT64_C(1) << (right - 1u);
+
+      scaled = product >> right;
+      if ( (dropped > half) || ((dropped == half) && (0u != (scaled & 1u))) )
+      {
+         scaled++;
+      }
+   }
+   else
+   {
+      scaled = 0; // product < 2^45, so this is far below a half
+   }
+
+   *magnitude = scaled;
+   // Like printf, except that there is no "-0"
+   *negative = ( 0u != (bits >> FLOAT_SIGN_SHIFT) ) && ( scaled > 0u );
+
+   return true;
+}
+
+#endif // ASCII_7SEG_HAS_DP
+
+/******************************************************************************/
+static inline size_t NumDigits( uint64_t value )
+{
+   static const uint64_t PowersOf10[MAX_DIGITS_U64] =
+   {
+      UINT64_C(1),                UINT64_C(10),                UINT64_C(100),
+      UINT64_C(1000),             UINT64_C(10000),             UINT64_C(100000),
+      UINT64_C(1000000),          UINT64_C(10000000),          UINT64_C(100000000),
+      UINT64_C(1000000000),       UINT64_C(10000000000),       UINT64_C(100000000000),
+      UINT64_C(1000000000000),    UINT64_C(10000000000000),    UINT64_C(100000000000000),
+      UINT64_C(1000000000000000), UINT64_C(10000000000000000), UINT64_C(100000000000000000),
+      UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
+   };
+
+   size_t num_digits = 1;
+   while ( (num_digits < MAX_DIGITS_U64) && (value >= PowersOf10[num_digits]) )
+   {
+      num_digits++;
+   }
+
+   return num_digits;
+}
+
+/**
+ * value / 100, as value * ceil(2^37 / 100) >> 37, which is exact for every
+ * 32-bit value. Needs only a 32x32->64 multiply (e.g., UMULL on Cortex-M3+).
+ */
+/******************************************************************************/
+static inline uint32_t Div100_U32( uint32_t value )
+{
+   return (uint32_t)( ( (uint64_t)value * UINT64_C(0x51EB851F) ) >> 37 );
+}
+
+/**
+ * value / 100, as (value >> 2) * ceil(2^68 / 100) >> 68, which is exact for
+ * every 64-bit value (the pre-shift by 2 takes out the factor of 4 in 100, so
+ * that the magic number fits in 64 bits).
+ */
+/******************************************************************************/
+static inline uint64_t Div100_U64( uint64_t value )
+{
+   return MulHi_U64( value >> 2, UINT64_C(0x28F5C28F5C28F5C3) ) >> 2;
+}
+
+/**
+ * High 64 bits of the 128-bit product of x and y, from four 32x32->64
+ * multiplies, since C99 has no 128-bit type.
+ */
+/******************************************************************************/
+static inline uint64_t MulHi_U64( uint64_t x, uint64_t y )
+{
+   const uint64_t x_lo = x & UINT32_MAX;
+   const uint64_t x_hi = x >> 32;
+   const uint64_t y_lo = y & UINT32_MAX;
+   const uint64_t y_hi = y >> 32;
+
+   const uint64_t lo_lo = x_lo * y_lo;
+   const uint64_t hi_lo = x_hi * y_lo;
+   const uint64_t lo_hi = x_lo * y_hi;
+   const uint64_t hi_hi = x_hi * y_hi;
+
+   const uint64_t middle = (lo_lo >> 32) + (hi_lo & UINT32_MAX) + lo_hi;
+
+   return hi_hi + (hi_lo >> 32) + (middle >> 32);
+}
+
+/**
+ * Writes the two digits of pair (0 to 99) to buf[0] (tens) and buf[1] (ones).
+ */
+/******************************************************************************/
+static inline void WritePair( uint32_t pair, union Ascii7Seg_Encoding_U * buf )
+{
+   assert( pair < 100u );
+
+#ifdef ASCII_7SEG_DONT_USE_LOOKUP_TABLE
+   // (pair * 103) >> 10 is pair / 10 for every pair below 100
+   const uint32_t tens = (pair * 103u) >> 10;
+   WriteDigit( tens, &buf[0] );
+   WriteDigit( pair - (tens * 10u), &buf[1] );
+#else
+   Ascii7Seg_UnpackEncoding( DigitPairLUT[pair][0], &buf[0] );
+   Ascii7Seg_UnpackEncoding( DigitPairLUT[pair][1], &buf[1] );
+#endif
+}
+
+/******************************************************************************/
+static inline void WriteDigit( uint32_t digit, union Ascii7Seg_Encoding_U * buf )
+{
+   assert( digit < 10u );
+
+#ifdef ASCII_7SEG_DONT_USE_LOOKUP_TABLE
+   // Computed, like every other encoding in this variant
+   bool is_digit = Ascii7Seg_ConvertChar( (char)('0' + digit), buf );
+   assert( is_digit );
+   (void)is_digit;
+#else
+   Ascii7Seg_UnpackEncoding( DigitPairLUT[digit][1], buf );
+#endif
+}
+
+/**
+ * Dumps bytes from the start-th one shown (counting from the last byte in
+ * reverse) to the end, i.e. buf[2 * start] onwards.
+ */
+/******************************************************************************/
+static void Hex_ScalarRange( const uint8_t * bytes,
+                             size_t num_bytes,
+                             size_t start,
+                             bool reverse,
+                             const uint8_t * glyphs,
+                             union Ascii7Seg_Encoding_U * buf )
+{
+   for ( size_t k = start; k < num_bytes; k++ )
+   {
+      const uint8_t byte = reverse ? bytes[num_bytes - 1u - k] : bytes[k];
+      Ascii7Seg_UnpackEncoding( glyphs[byte >> 4], &buf[HEX_DIGITS_PER_BYTE * k] );
+      Ascii7Seg_UnpackEncoding( glyphs[byte & 0x0Fu], &buf[(HEX_DIGITS_PER_BYTE * k) + 1u] );
+   }
+}
+
+/******************************************************************************/
+static void Hex_Scalar( const uint8_t * bytes,
+                        size_t num_bytes,
+                        bool reverse,
+                        const uint8_t * glyphs,
+                        union Ascii7Seg_Encoding_U * buf )
+{
+   Hex_ScalarRange( bytes, num_bytes, 0, reverse, glyphs, buf );
+}
+
+#ifdef ASCII_7SEG_HEX_SIMD_X86
+
+/**
+ * The vector hex kernels split a vector of bytes into its high and low
+ * nibbles, look both up in the glyph table with PSHUFB, and interleave the two
+ * results (high nibble first) into two vectors of encodings. In reverse, the
+ * bytes are loaded from the end and their order flipped before the lookup.
+ * Loads are unaligned and never go past the bytes, and whatever is left over
+ * after the last whole vector is done by Hex_ScalarRange().
+ */
+
+/******************************************************************************/
+__attribute__((target("ssse3")))
+static void Hex_SSSE3( const uint8_t * bytes,
+                       size_t num_bytes,
+                       bool reverse,
+                       const uint8_t * glyphs,
+                       union Ascii7Seg_Encoding_U * buf )
+{
+   enum { VEC_WIDTH = 16 };
+
+   const __m128i table = _mm_loadu_si128( (const void *)glyphs );
+   const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+   const __m128i flip = _mm_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+
+   size_t k = 0;
+   for ( ; (num_bytes - k) >= VEC_WIDTH; k += VEC_WIDTH )
+   {
+      const __m128i in = reverse ?
+         _mm_shuffle_epi8( _mm_loadu_si128((const void *)&bytes[num_bytes - k - VEC_WIDTH]), flip ) :
+         _mm_loadu_si128( (const void *)&bytes[k] );
+
+      const __m128i hi = _mm_shuffle_epi8( table, _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask) );
+      const __m128i lo = _mm_shuffle_epi8( table, _mm_and_si128(in, nibble_mask) );
+
+      _mm_storeu_si128( (void *)&buf[HEX_DIGITS_PER_BYTE * k], _mm_unpacklo_epi8(hi, lo) );
+      _mm_storeu_si128( (void *)&buf[(HEX_DIGITS_PER_BYTE * k) + VEC_WIDTH], _mm_unpackhi_epi8(hi, lo) );
+   }
+
+   Hex_ScalarRange( bytes, num_bytes, k, reverse, glyphs, buf );
+}
+
+/******************************************************************************/
+__attribute__((target("avx2")))
+static void Hex_AVX2( const uint8_t * bytes,
+                      size_t num_bytes,
+                      bool reverse,
+                      const uint8_t * glyphs,
+                      union Ascii7Seg_Encoding_U * buf )
+{
+   enum { VEC_WIDTH = 32 };
+
+   // vpshufb looks up within each 128-bit lane, so both lanes get the table
+   const __m256i table = _mm256_broadcastsi128_si256( _mm_loadu_si128((const void *)glyphs) );
+   const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+   const __m256i flip = _mm256_set_epi8( 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                         0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 );
+
+   size_t k = 0;
+   for ( ; (num_bytes - k) >= VEC_WIDTH; k += VEC_WIDTH )
+   {
+      // Reversing is a flip within each lane, then a swap of the lanes
+      const __m256i in = reverse ?
+         _mm256_permute4x64_epi64( _mm256_shuffle_epi8(_mm256_loadu_si256((const void *)&bytes[num_bytes - k - VEC_WIDTH]),
+                                                       flip),
+                                   0x4E ) :
+         _mm256_loadu_si256( (const void *)&bytes[k] );
+
+      const __m256i hi = _mm256_shuffle_epi8( table, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask) );
+      const __m256i lo = _mm256_shuffle_epi8( table, _mm256_and_si256(in, nibble_mask) );
+
+      // Interleaving also works per lane, giving bytes 0-7 and 16-23 in one
+      // vector and 8-15 and 24-31 in the other, so the lanes are put back in order.
+      const __m256i lanes_lo = _mm256_unpacklo_epi8( hi, lo );
+      const __m256i lanes_hi = _mm256_unpackhi_epi8( hi, lo );
+
+      _mm256_storeu_si256( (void *)&buf[HEX_DIGITS_PER_BYTE * k],
+                           _mm256_permute2x128_si256(lanes_lo, lanes_hi, 0x20) );
+      _mm256_storeu_si256( (void *)&buf[(HEX_DIGITS_PER_BYTE * k) + VEC_WIDTH],
+                           _mm256_permute2x128_si256(lanes_lo, lanes_hi, 0x31) );
+   }
+
+   Hex_ScalarRange( bytes, num_bytes, k, reverse, glyphs, buf );
+}
+
+/******************************************************************************/
+__attribute__((constructor))
+static void SelectHexKernel(void)
+{
+   __builtin_cpu_init();
+
+   if ( __builtin_cpu_supports("avx2") )
+   {
+      HexKernel = Hex_AVX2;
+   }
+   else if ( __builtin_cpu_supports("ssse3") )
+   {
+      HexKernel = Hex_SSSE3;
+   }
+   else
+   {
+      HexKernel = Hex_Scalar;
+   }
+}
+
+#endif // ASCII_7SEG_HEX_SIMD_X86
@@ -0,0 +1,364 @@
+/**
+ * @file ascii7seg_framebuffer.c
+ * @brief Implementation of the dirty-tracking framebuffer.
+ *
+ * An update alternates between skipping clean digits and skipping dirty ones,
+ * so each digit is compared once. Bit-packed, a whole machine word of digits is
+ * compared at a time while skipping clean ones, which is where most of the time
+ * goes when little changes. In the padded layout, each digit is one 64-bit
+ * compare through encoding_as_word. The cell framebuffer does the same with 4
+ * uint16_t cells to a word.
+ *
+ * Both framebuffers share FindRanges(), which is given the skip functions of
+ * its cell type. It is inline, so in each update those are constants and the
+ * calls through them can be made direct.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "ascii7seg.h"
+#include "ascii7seg_framebuffer.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+// Constant-like macros
+
+#ifdef ASCII_7SEG_BIT_PACK
+//! Bit-packed digits compared at once while skipping clean ones
+#define DIGITS_PER_WORD    ( sizeof(uint64_t) / sizeof(union Ascii7Seg_Encoding_U) )
+#endif
+
+//! Cells compared at once while skipping clean ones
+#define CELLS_PER_WORD     ( sizeof(uint64_t) / sizeof(uint16_t) )
+
+/* Local Datatypes */
+
+/**
+ * Index of the first cell from idx on (up to num_cells) that is dirty, for a
+ * skip-clean function, or clean, for a skip-dirty one.
+ */
+typedef size_t (*SkipFn_T)( const void * shadow,
+                            const void * frame,
+                            size_t idx,
+                            size_t num_cells );
+
+/* Local Data */
+
+/* Private Function Prototypes */
+
+static inline size_t FindRanges( void * shadow,
+                                 const void * frame,
+                                 size_t cell_size,
+                                 size_t num_cells,
+                                 size_t merge_gap,
+                                 bool all_dirty,
+                                 SkipFn_T skip_clean,
+                                 SkipFn_T skip_dirty,
+                                 struct Ascii7Seg_DirtyRange_S * ranges,
+                                 size_t max_ranges );
+static size_t SkipClean( const void * shadow,
+                         const void * frame,
+                         size_t idx,
+                         size_t num_digits );
+static size_t SkipDirty( const void * shadow,
+                         const void * frame,
+                         size_t idx,
+                         size_t num_digits );
+static size_t SkipCleanCells( const void * shadow,
+                              const void * frame,
+                              size_t idx,
+                              size_t num_cells );
+static size_t SkipDirtyCells( const void * shadow,
+                              const void * frame,
+                              size_t idx,
+                              size_t num_cells );
+static inline bool DigitsEqual( const union Ascii7Seg_Encoding_U * a,
+                                const union Ascii7Seg_Encoding_U * b );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+bool Ascii7Seg_FramebufferInit( struct Ascii7Seg_Framebuffer_S * fb,
+                                union Ascii7Seg_Encoding_U * shadow,
+                                size_t num_digits,
+                                size_t merge_gap )
+{
+   if ( (NULL == fb) || (NULL == shadow) || (0 == num_digits) )
+   {
+      return false;
+   }
+
+   fb->shadow = shadow;
+   fb->num_digits = num_digits;
+   fb->merge_gap = merge_gap;
+   fb->all_dirty = true;
+
+   return true;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_FramebufferUpdate( struct Ascii7Seg_Framebuffer_S * fb,
+                                    const union Ascii7Seg_Encoding_U * frame,
+                                    struct Ascii7Seg_DirtyRange_S * ranges,
+                                    size_t max_ranges )
+{
+   if ( (NULL == fb) || (NULL == frame) || (NULL == ranges) || (0 == max_ranges) )
+   {
+      return 0;
+   }
+
+   const size_t num_ranges = FindRanges( fb->shadow, frame, sizeof(fb->shadow[0]),
+                                         fb->num_digits, fb->merge_gap, fb->all_dirty,
+                                         SkipClean, SkipDirty,
+                                         ranges, max_ranges );
+   fb->all_dirty = false;
+
+   return num_ranges;
+}
+
+/******************************************************************************/
+void Ascii7Seg_FramebufferInvalidate( struct Ascii7Seg_Framebuffer_S * fb )
+{
+   if ( NULL != fb )
+   {
+      fb->all_dirty = true;
+   }
+}
+
+/******************************************************************************/
+bool Ascii7Seg_CellFramebufferInit( struct Ascii7Seg_CellFramebuffer_S * fb,
+                                    uint16_t * shadow,
+                                    size_t num_cells,
+                                    size_t merge_gap )
+{
+   if ( (NULL == fb) || (NULL == shadow) || (0 == num_cells) )
+   {
+      return false;
+   }
+
+   fb->shadow = shadow;
+   fb->num_cells = num_cells;
+   fb->merge_gap = merge_gap;
+   fb->all_dirty = true;
+
+   return true;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_CellFramebufferUpdate( struct Ascii7Seg_CellFramebuffer_S * fb,
+                                        const uint16_t * frame,
+                                        struct Ascii7Seg_DirtyRange_S * ranges,
+                                        size_t max_ranges )
+{
+   if ( (NULL == fb) || (NULL == frame) || (NULL == ranges) || (0 == max_ranges) )
+   {
+      return 0;
+   }
+
+   const size_t num_ranges = FindRanges( fb->shadow, frame, sizeof(fb->shadow[0]),
+                                         fb->num_cells, fb->merge_gap, fb->all_dirty,
+                                         SkipCleanCells, SkipDirtyCells,
+                                         ranges, max_ranges );
+   fb->all_dirty = false;
+
+   return num_ranges;
+}
+
+/******************************************************************************/
+void Ascii7Seg_CellFramebufferInvalidate( struct Ascii7Seg_CellFramebuffer_S * fb )
+{
+   if ( NULL != fb )
+   {
+      fb->all_dirty = true;
+   }
+}
+
+/* Private Function Implementations */
+
+/**
+ * Lists the dirty ranges of frame against shadow, and copies them into shadow.
+ * See Ascii7Seg_FramebufferUpdate().
+ */
+/******************************************************************************/
+static inline size_t FindRanges( void * shadow,
+                                 const void * frame,
+                                 size_t cell_size,
+                                 size_t num_cells,
+                                 size_t merge_gap,
+                                 bool all_dirty,
+                                 SkipFn_T skip_clean,
+                                 SkipFn_T skip_dirty,
+                                 struct Ascii7Seg_DirtyRange_S * ranges,
+                                 size_t max_ranges )
+{
+   size_t num_ranges = 0;
+
+   size_t first = all_dirty ? 0 : skip_clean( shadow, frame, 0, num_cells );
+   while ( first < num_cells )
+   {
+      size_t end = all_dirty ? num_cells : skip_dirty( shadow, frame, first, num_cells );
+      size_t next = skip_clean( shadow, frame, end, num_cells );
+
+      // Absorb the following runs while the clean gap before them is short
+      while ( (next < num_cells) && ((next - end) <= merge_gap) )
+      {
+         end = skip_dirty( shadow, frame, next, num_cells );
+         next = skip_clean( shadow, frame, end, num_cells );
+      }
+
+      if ( num_ranges < max_ranges )
+      {
+         ranges[num_ranges].first = first;
+         ranges[num_ranges].len = end - first;
+         num_ranges++;
+      }
+      else
+      {
+         // Out of ranges, so the last one grows to cover this run as well
+         ranges[num_ranges - 1].len = end - ranges[num_ranges - 1].first;
+      }
+
+      (void)memcpy( (uint8_t *)shadow + (first * cell_size),
+                    (const uint8_t *)frame + (first * cell_size),
+                    (end - first) * cell_size );
+      first = next;
+   }
+
+   return num_ranges;
+}
+
+/**
+ * Index of the first digit from idx on that differs between shadow and frame,
+ * or num_digits if there is none.
+ */
+/******************************************************************************/
+static size_t SkipClean( const void * shadow_digits,
+                         const void * frame_digits,
+                         size_t idx,
+                         size_t num_digits )
+{
+   const union Ascii7Seg_Encoding_U * shadow = shadow_digits;
+   const union Ascii7Seg_Encoding_U * frame = frame_digits;
+
+#ifdef ASCII_7SEG_BIT_PACK
+   while ( (num_digits - idx) >= DIGITS_PER_WORD )
+   {
+      uint64_t shadow_word;
+      uint64_t frame_word;
+      (void)memcpy( &shadow_word, &shadow[idx], sizeof(shadow_word) );
+      (void)memcpy( &frame_word, &frame[idx], sizeof(frame_word) );
+      if ( shadow_word != frame_word )
+      {
+         break; // The digit-by-digit loop below finds which one
+      }
+      idx += DIGITS_PER_WORD;
+   }
+#endif
+
+   while ( (idx < num_digits) && DigitsEqual(&shadow[idx], &frame[idx]) )
+   {
+      idx++;
+   }
+
+   return idx;
+}
+
+/**
+ * Index of the first digit from idx on that is the same in shadow and frame,
+ * or num_digits if there is none.
+ */
+/******************************************************************************/
+static size_t SkipDirty( const void * shadow_digits,
+                         const void * frame_digits,
+                         size_t idx,
+                         size_t num_digits )
+{
+   const union Ascii7Seg_Encoding_U * shadow = shadow_digits;
+   const union Ascii7Seg_Encoding_U * frame = frame_digits;
+
+   while ( (idx < num_digits) && !DigitsEqual(&shadow[idx], &frame[idx]) )
+   {
+      idx++;
+   }
+
+   return idx;
+}
+
+/**
+ * Same as SkipClean(), for uint16_t cells.
+ */
+/******************************************************************************/
+static size_t SkipCleanCells( const void * shadow_cells,
+                              const void * frame_cells,
+                              size_t idx,
+                              size_t num_cells )
+{
+   const uint16_t * shadow = shadow_cells;
+   const uint16_t * frame = frame_cells;
+
+   while ( (num_cells - idx) >= CELLS_PER_WORD )
+   {
+      uint64_t shadow_word;
+      uint64_t frame_word;
+      (void)memcpy( &shadow_word, &shadow[idx], sizeof(shadow_word) );
+      (void)memcpy( &frame_word, &frame[idx], sizeof(frame_word) );
+      if ( shadow_word != frame_word )
+      {
+         break; // The cell-by-cell loop below finds which one
+      }
+      idx += CELLS_PER_WORD;
+   }
+
+   while ( (idx < num_cells) && (shadow[idx] == frame[idx]) )
+   {
+      idx++;
+   }
+
+   return idx;
+}
+
+/**
+ * Same as SkipDirty(), for uint16_t cells.
+ */
+/******************************************************************************/
+static size_t SkipDirtyCells( const void * shadow_cells,
+                              const void * frame_cells,
+                              size_t idx,
+                              size_t num_cells )
+{
+   const uint16_t * shadow = shadow_cells;
+   const uint16_t * frame = frame_cells;
+
+   while ( (idx < num_cells) && (shadow[idx] != frame[idx]) )
+   {
+      idx++;
+   }
+
+   return idx;
+}
+
+/**
+ * Whether two encodings light the same segments (the decimal point included,
+ * where there is one).
+ */
+/******************************************************************************/
+static inline bool DigitsEqual( const union Ascii7Seg_Encoding_U * a,
+                                const union Ascii7Seg_Encoding_U * b )
+{
+#if defined(ASCII_7SEG_BIT_PACK)
+   return ( a->encoding_as_val == b->encoding_as_val );
+#elif defined(ASCII_7SEG_PAD_TO_8_BYTES)
+   return ( a->encoding_as_word == b->encoding_as_word );
+#else
+   return ( 0 == memcmp(a, b, sizeof(*a)) );
+#endif
+}
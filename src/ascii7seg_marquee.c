@@ -0,0 +1,220 @@
+/**
+ * @file ascii7seg_marquee.c
+ * @brief Implementation of the scrolling marquee.
+ *
+ * The message is encoded into the ring once by Ascii7Seg_MarqueeInit(), with
+ * the same Ascii7Seg_ConvertBytes() as everything else (SIMD included), and
+ * the ring is never written again. From then on, a marquee is only a position
+ * in the ring and a little pause/direction state, so both Frame() and
+ * Advance() are a handful of compares and adds.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "ascii7seg.h"
+#include "ascii7seg_marquee.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+// Function-like macros
+
+#define MAX(a, b) ( ((a) > (b)) ? (a) : (b) )
+
+/* Local Datatypes */
+
+/* Local Data */
+
+/* Private Function Prototypes */
+
+static void EncodeText( const char * text, size_t text_len, union Ascii7Seg_Encoding_U * ring );
+static inline size_t MaxPos( const struct Ascii7Seg_Marquee_S * marquee );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+bool Ascii7Seg_MarqueeInit( struct Ascii7Seg_Marquee_S * marquee,
+                            const struct Ascii7Seg_MarqueeConfig_S * cfg,
+                            union Ascii7Seg_Encoding_U * ring,
+                            size_t ring_cap,
+                            const char * text,
+                            size_t text_len )
+{
+   if ( (NULL == marquee) || (NULL == cfg) || (NULL == ring) ||
+        ((NULL == text) && (text_len > 0)) ||
+        (0 == cfg->width) || (0 == cfg->step) ||
+        ((unsigned)cfg->mode >= (unsigned)ASCII_7SEG_MARQUEE_NUM_OF_MODES) )
+   {
+      return false;
+   }
+
+   // Looping, the message is followed by a display's worth of blanks. Bouncing,
+   // it is only padded out to the width of the display.
+   size_t ring_len;
+   if ( ASCII_7SEG_MARQUEE_LOOP == cfg->mode )
+   {
+      if ( text_len > (SIZE_MAX - cfg->width) )
+      {
+         return false;
+      }
+      ring_len = text_len + cfg->width;
+   }
+   else
+   {
+      ring_len = MAX( text_len, cfg->width );
+   }
+
+   if ( ring_len > ring_cap )
+   {
+      return false;
+   }
+
+   EncodeText( text, text_len, ring );
+   (void)memset( &ring[text_len], 0, (ring_len - text_len) * sizeof(ring[0]) );
+
+   marquee->ring = ring;
+   marquee->ring_len = ring_len;
+   marquee->cfg = *cfg;
+   Ascii7Seg_MarqueeRestart( marquee );
+
+   return true;
+}
+
+/******************************************************************************/
+struct Ascii7Seg_MarqueeFrame_S Ascii7Seg_MarqueeFrame( const struct Ascii7Seg_Marquee_S * marquee )
+{
+   struct Ascii7Seg_MarqueeFrame_S frame = { NULL, 0, NULL, 0 };
+
+   if ( NULL == marquee )
+   {
+      return frame;
+   }
+
+   assert( marquee->pos < marquee->ring_len );
+
+   const size_t to_end = marquee->ring_len - marquee->pos;
+   frame.head = &marquee->ring[marquee->pos];
+   if ( to_end >= marquee->cfg.width )
+   {
+      frame.head_len = marquee->cfg.width;
+   }
+   else
+   {
+      frame.head_len = to_end;
+      frame.wrap = marquee->ring;
+      frame.wrap_len = marquee->cfg.width - to_end;
+   }
+
+   return frame;
+}
+
+/******************************************************************************/
+void Ascii7Seg_MarqueeAdvance( struct Ascii7Seg_Marquee_S * marquee )
+{
+   if ( NULL == marquee )
+   {
+      return;
+   }
+
+   if ( marquee->pause_left > 0 )
+   {
+      marquee->pause_left--;
+      return;
+   }
+
+   const size_t step = marquee->cfg.step;
+   bool at_end;
+
+   if ( ASCII_7SEG_MARQUEE_LOOP == marquee->cfg.mode )
+   {
+      // Landing on the start of the ring, rather than wherever the step goes
+      // past it, is what lets every lap pause with the message flush left.
+      marquee->pos = ( step < (marquee->ring_len - marquee->pos) ) ? (marquee->pos + step) : 0;
+      at_end = ( 0 == marquee->pos );
+   }
+   else
+   {
+      const size_t max_pos = MaxPos( marquee );
+      if ( 0 == max_pos )
+      {
+         return; // The message fits the display, so there is nowhere to go
+      }
+
+      if ( marquee->backwards )
+      {
+         marquee->pos = ( step < marquee->pos ) ? (marquee->pos - step) : 0;
+         at_end = ( 0 == marquee->pos );
+      }
+      else
+      {
+         marquee->pos = ( step < (max_pos - marquee->pos) ) ? (marquee->pos + step) : max_pos;
+         at_end = ( max_pos == marquee->pos );
+      }
+
+      if ( at_end )
+      {
+         marquee->backwards = !marquee->backwards;
+      }
+   }
+
+   if ( at_end )
+   {
+      marquee->pause_left = marquee->cfg.pause_frames;
+   }
+}
+
+/******************************************************************************/
+void Ascii7Seg_MarqueeRestart( struct Ascii7Seg_Marquee_S * marquee )
+{
+   if ( NULL == marquee )
+   {
+      return;
+   }
+
+   marquee->pos = 0;
+   marquee->pause_left = marquee->cfg.pause_frames;
+   marquee->backwards = false;
+}
+
+/* Private Function Implementations */
+
+/**
+ * Encodes text into ring[0] to ring[text_len - 1], with blanks for the
+ * characters this variant can't encode.
+ */
+/******************************************************************************/
+static void EncodeText( const char * text, size_t text_len, union Ascii7Seg_Encoding_U * ring )
+{
+   size_t done = 0;
+   while ( done < text_len )
+   {
+      struct Ascii7Seg_Result_S result =
+         Ascii7Seg_ConvertBytes( &text[done], text_len - done, &ring[done], text_len - done );
+      done += result.converted;
+
+      if ( ASCII_7SEG_NO_INVALID_IDX != result.invalid_idx )
+      {
+         (void)memset( &ring[done], 0, sizeof(ring[0]) );
+         done++;
+      }
+   }
+}
+
+/**
+ * Furthest position of the window under ASCII_7SEG_MARQUEE_BOUNCE, i.e. the
+ * message flush right.
+ */
+/******************************************************************************/
+static inline size_t MaxPos( const struct Ascii7Seg_Marquee_S * marquee )
+{
+   assert( marquee->ring_len >= marquee->cfg.width );
+   return marquee->ring_len - marquee->cfg.width;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file ascii7seg_pack.h
+ * @brief Conversions between Ascii7Seg_Encoding_U and its packed byte, shared by
+ *        the modules of the library. Internal, so not part of the API.
+ *
+ * The packed byte has segment s in bit s (a = 0 ... g = 6), and the decimal
+ * point in bit 7 where Ascii7Seg_Encoding_U has one (ASCII_7SEG_HAS_DP). In the
+ * bit-packed layout, that is the encoding itself, so both directions are a
+ * plain copy.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_PACK_H_
+#define ASCII_7SEG_PACK_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stdint.h>
+#include "ascii7seg.h"
+
+/* Macro Definitions */
+
+//! Segments a to g of a packed encoding, i.e. without the decimal point
+#define ASCII_7SEG_PACKED_SEGMENTS_MASK   0x7Fu
+
+/* Inline Function Definitions */
+
+/**
+ * @brief The encoding as a packed byte.
+ */
+static inline uint8_t Ascii7Seg_PackEncoding( const union Ascii7Seg_Encoding_U * encoding )
+{
+#ifdef ASCII_7SEG_BIT_PACK
+   return encoding->encoding_as_val;
+#else
+   unsigned int packed = ( (unsigned int)encoding->segments.a << 0 ) |
+                         ( (unsigned int)encoding->segments.b << 1 ) |
+                         ( (unsigned int)encoding->segments.c << 2 ) |
+                         ( (unsigned int)encoding->segments.d << 3 ) |
+                         ( (unsigned int)encoding->segments.e << 4 ) |
+                         ( (unsigned int)encoding->segments.f << 5 ) |
+                         ( (unsigned int)encoding->segments.g << 6 );
+#ifdef ASCII_7SEG_HAS_DP
+   packed |= (unsigned int)encoding->segments.dp << 7;
+#endif
+   return (uint8_t)packed;
+#endif // ASCII_7SEG_BIT_PACK
+}
+
+/**
+ * @brief Writes a packed byte into whichever layout of Ascii7Seg_Encoding_U is
+ *        configured. Bit 7 is dropped where there is no decimal point.
+ */
+static inline void Ascii7Seg_UnpackEncoding( uint8_t packed, union Ascii7Seg_Encoding_U * encoding )
+{
+#ifdef ASCII_7SEG_BIT_PACK
+   encoding->encoding_as_val = packed;
+#else
+   encoding->segments.a = ( 0u != (packed & 0x01u) );
+   encoding->segments.b = ( 0u != (packed & 0x02u) );
+   encoding->segments.c = ( 0u != (packed & 0x04u) );
+   encoding->segments.d = ( 0u != (packed & 0x08u) );
+   encoding->segments.e = ( 0u != (packed & 0x10u) );
+   encoding->segments.f = ( 0u != (packed & 0x20u) );
+   encoding->segments.g = ( 0u != (packed & 0x40u) );
+#ifdef ASCII_7SEG_HAS_DP
+   encoding->segments.dp = ( 0u != (packed & 0x80u) );
+#endif
+#endif // ASCII_7SEG_BIT_PACK
+}
+
+#endif // ASCII_7SEG_PACK_H_
@@ -0,0 +1,393 @@
+/**
+ * @file ascii7seg_parallel.c
+ * @brief Implementation of the worker pool for very large conversions.
+ *
+ * The chunks of a job are numbered, and each worker owns a contiguous run of
+ * those numbers, [next, end). Claiming a chunk is an atomic fetch-and-add of
+ * next, by the owner or by a thief alike, and a number at or past end means
+ * that run is used up. That is all the stealing there is: no locks, and no
+ * chunk is ever converted twice.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+// For sysconf()
+#define _POSIX_C_SOURCE 200809L
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ascii7seg.h"
+#include "ascii7seg_parallel.h"
+#include "ascii7seg_config.h"
+
+#ifdef ASCII_7SEG_THREADS
+#include <unistd.h>
+#endif
+
+/* Local Macro Definitions */
+
+#if ( (ASCII_7SEG_POOL_CHUNK_LEN % ASCII_7SEG_CACHE_LINE) != 0 ) || (ASCII_7SEG_POOL_CHUNK_LEN == 0)
+#error "ASCII_7SEG_POOL_CHUNK_LEN must be a nonzero multiple of ASCII_7SEG_CACHE_LINE, to keep chunks on separate cache lines"
+#endif
+
+/* Local Datatypes */
+
+/* Local Data */
+
+/* Private Function Prototypes */
+
+#ifdef ASCII_7SEG_THREADS
+static size_t OnlineCpus( void );
+static void * WorkerMain( void * arg );
+static struct Ascii7Seg_Result_S ConvertParallel( struct Ascii7Seg_Pool_S * pool,
+                                                  const char * src,
+                                                  size_t len,
+                                                  union Ascii7Seg_Encoding_U * buf );
+static void RunChunks( struct Ascii7Seg_Pool_S * pool, size_t self );
+static void ConvertChunk( struct Ascii7Seg_PoolJob_S * job, size_t chunk );
+static inline size_t ChunkStart( const struct Ascii7Seg_PoolJob_S * job, size_t chunk );
+static size_t AlignedHead( const union Ascii7Seg_Encoding_U * buf );
+#endif
+
+/* Public API Implementations */
+
+/******************************************************************************/
+bool Ascii7Seg_PoolInit( struct Ascii7Seg_Pool_S * pool, size_t num_workers )
+{
+   if ( NULL == pool )
+   {
+      return false;
+   }
+
+#ifdef ASCII_7SEG_THREADS
+
+   if ( 0u == num_workers )
+   {
+      num_workers = OnlineCpus();
+   }
+   if ( num_workers > ASCII_7SEG_POOL_MAX_WORKERS )
+   {
+      num_workers = ASCII_7SEG_POOL_MAX_WORKERS;
+   }
+
+   pool->num_workers = 0;
+   pool->generation = 0;
+   pool->busy = 0;
+   pool->stop = false;
+
+   if ( 0 != pthread_mutex_init(&pool->lock, NULL) )
+   {
+      return false;
+   }
+   if ( 0 != pthread_cond_init(&pool->start, NULL) )
+   {
+      (void)pthread_mutex_destroy( &pool->lock );
+      return false;
+   }
+   if ( 0 != pthread_cond_init(&pool->finished, NULL) )
+   {
+      (void)pthread_cond_destroy( &pool->start );
+      (void)pthread_mutex_destroy( &pool->lock );
+      return false;
+   }
+
+   // Worker 0 is whichever thread calls Ascii7Seg_PoolConvertBytes()
+   for ( size_t w = 0; w < num_workers; w++ )
+   {
+      struct Ascii7Seg_PoolWorker_S * worker = &pool->workers[w];
+      worker->pool = pool;
+      worker->idx = w;
+      worker->next = 0;
+      worker->end = 0;
+
+      if ( (w > 0u) && (0 != pthread_create(&worker->thread, NULL, WorkerMain, worker)) )
+      {
+         Ascii7Seg_PoolDeinit( pool );
+         return false;
+      }
+      pool->num_workers++;
+   }
+
+#else
+
+   (void)num_workers;
+   pool->num_workers = 1;
+
+#endif // ASCII_7SEG_THREADS
+
+   return true;
+}
+
+/******************************************************************************/
+void Ascii7Seg_PoolDeinit( struct Ascii7Seg_Pool_S * pool )
+{
+   if ( (NULL == pool) || (0u == pool->num_workers) )
+   {
+      return;
+   }
+
+#ifdef ASCII_7SEG_THREADS
+
+   (void)pthread_mutex_lock( &pool->lock );
+   pool->stop = true;
+   (void)pthread_cond_broadcast( &pool->start );
+   (void)pthread_mutex_unlock( &pool->lock );
+
+   for ( size_t w = 1; w < pool->num_workers; w++ )
+   {
+      (void)pthread_join( pool->workers[w].thread, NULL );
+   }
+
+   (void)pthread_cond_destroy( &pool->finished );
+   (void)pthread_cond_destroy( &pool->start );
+   (void)pthread_mutex_destroy( &pool->lock );
+
+#endif // ASCII_7SEG_THREADS
+
+   pool->num_workers = 0;
+}
+
+/******************************************************************************/
+struct Ascii7Seg_Result_S Ascii7Seg_PoolConvertBytes( struct Ascii7Seg_Pool_S * pool,
+                                                      const char * src,
+                                                      size_t src_len,
+                                                      union Ascii7Seg_Encoding_U * buf,
+                                                      size_t buf_cap )
+{
+   if ( NULL == pool )
+   {
+      const struct Ascii7Seg_Result_S result =
+      {
+         .converted = 0,
+         .invalid_idx = ASCII_7SEG_NO_INVALID_IDX,
+         .invalid_char = '\0'
+      };
+      return result;
+   }
+
+#ifdef ASCII_7SEG_THREADS
+   const size_t len = (src_len < buf_cap) ? src_len : buf_cap;
+   if ( (NULL != src) && (NULL != buf) &&
+        (pool->num_workers > 1u) && (len >= (2u * ASCII_7SEG_POOL_CHUNK_LEN)) )
+   {
+      return ConvertParallel( pool, src, len, buf );
+   }
+#endif
+
+   // Too short to be worth waking the workers for
+   return Ascii7Seg_ConvertBytes( src, src_len, buf, buf_cap );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_PoolConvertWord( struct Ascii7Seg_Pool_S * pool,
+                                  const char * str,
+                                  size_t str_len,
+                                  union Ascii7Seg_Encoding_U * buf )
+{
+   if ( (NULL == pool) || (NULL == str) || (NULL == buf) )
+   {
+      return 0;
+   }
+
+   // The workers convert whole chunks, so bound the word by its null
+   // terminator first rather than let them read and write past it
+   const char * nul = memchr( str, '\0', str_len );
+   const size_t len = ( NULL == nul ) ? str_len : (size_t)( nul - str );
+
+   return Ascii7Seg_PoolConvertBytes( pool, str, len, buf, len ).converted;
+}
+
+/* Private Function Implementations */
+
+#ifdef ASCII_7SEG_THREADS
+
+/******************************************************************************/
+static size_t OnlineCpus( void )
+{
+   const long cpus = sysconf( _SC_NPROCESSORS_ONLN );
+   return (cpus > 0) ? (size_t)cpus : 1u;
+}
+
+/**
+ * Body of worker threads 1 and up: wait for a job, do what's left of it, and
+ * report back, until the pool is deinitialized.
+ */
+/******************************************************************************/
+static void * WorkerMain( void * arg )
+{
+   struct Ascii7Seg_PoolWorker_S * worker = (struct Ascii7Seg_PoolWorker_S *)arg;
+   struct Ascii7Seg_Pool_S * pool = worker->pool;
+   unsigned long done_generation = 0;
+
+   (void)pthread_mutex_lock( &pool->lock );
+   while ( true )
+   {
+      while ( !pool->stop && (pool->generation == done_generation) )
+      {
+         (void)pthread_cond_wait( &pool->start, &pool->lock );
+      }
+      if ( pool->stop )
+      {
+         break;
+      }
+      done_generation = pool->generation;
+      (void)pthread_mutex_unlock( &pool->lock );
+
+      RunChunks( pool, worker->idx );
+
+      (void)pthread_mutex_lock( &pool->lock );
+      pool->busy--;
+      if ( 0u == pool->busy )
+      {
+         (void)pthread_cond_signal( &pool->finished );
+      }
+   }
+   (void)pthread_mutex_unlock( &pool->lock );
+
+   return NULL;
+}
+
+/******************************************************************************/
+static struct Ascii7Seg_Result_S ConvertParallel( struct Ascii7Seg_Pool_S * pool,
+                                                  const char * src,
+                                                  size_t len,
+                                                  union Ascii7Seg_Encoding_U * buf )
+{
+   struct Ascii7Seg_PoolJob_S * job = &pool->job;
+   job->src = src;
+   job->buf = buf;
+   job->len = len;
+   job->head = AlignedHead( buf );
+   job->first_invalid = len;
+
+   // Chunk 0 is the head, then full chunks, and then whatever's left
+   const size_t num_chunks = 1u + ( (len - job->head) + (ASCII_7SEG_POOL_CHUNK_LEN - 1u) ) /
+                                  ASCII_7SEG_POOL_CHUNK_LEN;
+   for ( size_t w = 0; w < pool->num_workers; w++ )
+   {
+      pool->workers[w].next = (num_chunks * w) / pool->num_workers;
+      pool->workers[w].end = (num_chunks * (w + 1u)) / pool->num_workers;
+   }
+
+   // The mutex publishes the job to the workers, and their encodings back
+   (void)pthread_mutex_lock( &pool->lock );
+   pool->generation++;
+   pool->busy = pool->num_workers - 1u;
+   (void)pthread_cond_broadcast( &pool->start );
+   (void)pthread_mutex_unlock( &pool->lock );
+
+   RunChunks( pool, 0 );
+
+   (void)pthread_mutex_lock( &pool->lock );
+   while ( pool->busy > 0u )
+   {
+      (void)pthread_cond_wait( &pool->finished, &pool->lock );
+   }
+   (void)pthread_mutex_unlock( &pool->lock );
+
+   // Every chunk before the first unsupported character was converted in full
+   struct Ascii7Seg_Result_S result =
+   {
+      .converted = job->first_invalid,
+      .invalid_idx = ASCII_7SEG_NO_INVALID_IDX,
+      .invalid_char = '\0'
+   };
+   if ( job->first_invalid < len )
+   {
+      result.invalid_idx = job->first_invalid;
+      result.invalid_char = src[job->first_invalid];
+   }
+
+   return result;
+}
+
+/**
+ * Converts the chunks of worker self, then steals from the others, one after
+ * the other, until there are none left anywhere.
+ */
+/******************************************************************************/
+static void RunChunks( struct Ascii7Seg_Pool_S * pool, size_t self )
+{
+   for ( size_t v = 0; v < pool->num_workers; v++ )
+   {
+      struct Ascii7Seg_PoolWorker_S * victim = &pool->workers[(self + v) % pool->num_workers];
+      while ( true )
+      {
+         const size_t chunk = __atomic_fetch_add( &victim->next, 1u, __ATOMIC_RELAXED );
+         if ( chunk >= victim->end )
+         {
+            break;
+         }
+         ConvertChunk( &pool->job, chunk );
+      }
+   }
+}
+
+/******************************************************************************/
+static void ConvertChunk( struct Ascii7Seg_PoolJob_S * job, size_t chunk )
+{
+   const size_t start = ChunkStart( job, chunk );
+   const size_t end = ChunkStart( job, chunk + 1u );
+
+   // Nothing after an unsupported character already found can change the result
+   if ( start >= __atomic_load_n(&job->first_invalid, __ATOMIC_RELAXED) )
+   {
+      return;
+   }
+
+   const struct Ascii7Seg_Result_S run =
+      Ascii7Seg_ConvertBytes( &job->src[start], end - start, &job->buf[start], end - start );
+   if ( run.converted == (end - start) )
+   {
+      return;
+   }
+
+   // Keep the lowest index of them all
+   const size_t invalid = start + run.converted;
+   size_t lowest = __atomic_load_n( &job->first_invalid, __ATOMIC_RELAXED );
+   while ( (invalid < lowest) &&
+           !__atomic_compare_exchange_n( &job->first_invalid, &lowest, invalid, true,
+                                         __ATOMIC_RELAXED, __ATOMIC_RELAXED ) )
+   {
+      // lowest was reloaded, so try again
+   }
+}
+
+/******************************************************************************/
+static inline size_t ChunkStart( const struct Ascii7Seg_PoolJob_S * job, size_t chunk )
+{
+   if ( 0u == chunk )
+   {
+      return 0;
+   }
+
+   const size_t start = job->head + ( (chunk - 1u) * ASCII_7SEG_POOL_CHUNK_LEN );
+   return (start < job->len) ? start : job->len;
+}
+
+/**
+ * Number of encodings before the first one that starts a cache line. Every
+ * chunk after that is a multiple of ASCII_7SEG_CACHE_LINE encodings long, so
+ * it starts a line too, and no line is shared by two chunks.
+ */
+/******************************************************************************/
+static size_t AlignedHead( const union Ascii7Seg_Encoding_U * buf )
+{
+   const uintptr_t addr = (uintptr_t)buf;
+   for ( size_t i = 0; i < ASCII_7SEG_CACHE_LINE; i++ )
+   {
+      if ( 0u == ( (addr + (i * sizeof(*buf))) % ASCII_7SEG_CACHE_LINE ) )
+      {
+         return i;
+      }
+   }
+
+   return 0;
+}
+
+#endif // ASCII_7SEG_THREADS
@@ -0,0 +1,326 @@
+/**
+ * @file ascii7seg_planes.c
+ * @brief Implementation of the bit-sliced 7-segment plane API.
+ *
+ * Digits are handled 8 at a time: the 8 encodings are packed into a 64-bit
+ * word with one byte per digit (bit s of byte i is segment s of digit i), that
+ * word is transposed as an 8x8 bit matrix so that byte s holds segment s of
+ * all 8 digits, and each of those bytes is then dropped into its plane.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <assert.h>
+#include "ascii7seg.h"
+#include "ascii7seg_planes.h"
+#include "ascii7seg_pack.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+// Constant-like macros
+
+//! Digits per 8x8 transpose
+#define DIGITS_PER_BLOCK   8u
+
+// Function-like macros
+
+#define MIN(a, b) ( ((a) < (b)) ? (a) : (b) )
+
+/* Local Datatypes */
+
+/* Local Data */
+
+/* Private Function Prototypes */
+
+static inline uint64_t PackEncodings( const union Ascii7Seg_Encoding_U * encodings,
+                                      size_t num_encodings );
+static inline uint64_t Transpose8x8( uint64_t x );
+static size_t ConvertWordToPlanes( const char * str,
+                                   size_t str_len,
+                                   size_t max_digits,
+                                   uint64_t planes[ASCII_7SEG_NUM_PLANES] );
+static size_t EncodingsToPlanes( const union Ascii7Seg_Encoding_U * encodings,
+                                 size_t num_encodings,
+                                 size_t max_digits,
+                                 uint64_t planes[ASCII_7SEG_NUM_PLANES] );
+static inline void ScatterBlock( uint64_t block,
+                                 size_t block_idx,
+                                 uint64_t planes[ASCII_7SEG_NUM_PLANES] );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertWordToPlanes8( const char * str,
+                                       size_t str_len,
+                                       uint8_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   if ( (NULL == str) || (NULL == planes) )
+   {
+      return 0;
+   }
+
+   uint64_t wide[ASCII_7SEG_NUM_PLANES];
+   size_t num_digits = ConvertWordToPlanes( str, str_len, 8, wide );
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] = (uint8_t)wide[plane];
+   }
+
+   return num_digits;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertWordToPlanes16( const char * str,
+                                        size_t str_len,
+                                        uint16_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   if ( (NULL == str) || (NULL == planes) )
+   {
+      return 0;
+   }
+
+   uint64_t wide[ASCII_7SEG_NUM_PLANES];
+   size_t num_digits = ConvertWordToPlanes( str, str_len, 16, wide );
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] = (uint16_t)wide[plane];
+   }
+
+   return num_digits;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertWordToPlanes32( const char * str,
+                                        size_t str_len,
+                                        uint32_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   if ( (NULL == str) || (NULL == planes) )
+   {
+      return 0;
+   }
+
+   uint64_t wide[ASCII_7SEG_NUM_PLANES];
+   size_t num_digits = ConvertWordToPlanes( str, str_len, 32, wide );
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] = (uint32_t)wide[plane];
+   }
+
+   return num_digits;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_ConvertWordToPlanes64( const char * str,
+                                        size_t str_len,
+                                        uint64_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   if ( (NULL == str) || (NULL == planes) )
+   {
+      return 0;
+   }
+
+   return ConvertWordToPlanes( str, str_len, 64, planes );
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_EncodingsToPlanes8( const union Ascii7Seg_Encoding_U * encodings,
+                                     size_t num_encodings,
+                                     uint8_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   if ( (NULL == encodings) || (NULL == planes) )
+   {
+      return 0;
+   }
+
+   uint64_t wide[ASCII_7SEG_NUM_PLANES];
+   size_t num_digits = EncodingsToPlanes( encodings, num_encodings, 8, wide );
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] = (uint8_t)wide[plane];
+   }
+
+   return num_digits;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_EncodingsToPlanes16( const union Ascii7Seg_Encoding_U * encodings,
+                                      size_t num_encodings,
+                                      uint16_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   if ( (NULL == encodings) || (NULL == planes) )
+   {
+      return 0;
+   }
+
+   uint64_t wide[ASCII_7SEG_NUM_PLANES];
+   size_t num_digits = EncodingsToPlanes( encodings, num_encodings, 16, wide );
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] = (uint16_t)wide[plane];
+   }
+
+   return num_digits;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_EncodingsToPlanes32( const union Ascii7Seg_Encoding_U * encodings,
+                                      size_t num_encodings,
+                                      uint32_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   if ( (NULL == encodings) || (NULL == planes) )
+   {
+      return 0;
+   }
+
+   uint64_t wide[ASCII_7SEG_NUM_PLANES];
+   size_t num_digits = EncodingsToPlanes( encodings, num_encodings, 32, wide );
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] = (uint32_t)wide[plane];
+   }
+
+   return num_digits;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_EncodingsToPlanes64( const union Ascii7Seg_Encoding_U * encodings,
+                                      size_t num_encodings,
+                                      uint64_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   if ( (NULL == encodings) || (NULL == planes) )
+   {
+      return 0;
+   }
+
+   return EncodingsToPlanes( encodings, num_encodings, 64, planes );
+}
+
+/* Private Function Implementations */
+
+/**
+ * Packs up to 8 encodings into a 64-bit word, one byte per digit, where bit s
+ * of byte i is segment s (a = 0 ... g = 6, dp = 7) of encodings[i]. Bytes past
+ * num_encodings, and bit 7 of every byte if there is no decimal point (see
+ * ASCII_7SEG_HAS_DP), are 0.
+ */
+/******************************************************************************/
+static inline uint64_t PackEncodings( const union Ascii7Seg_Encoding_U * encodings,
+                                      size_t num_encodings )
+{
+   assert( num_encodings <= DIGITS_PER_BLOCK );
+
+   uint64_t packed = 0;
+   for ( size_t i = 0; i < num_encodings; i++ )
+   {
+      uint64_t digit = Ascii7Seg_PackEncoding( &encodings[i] );
+      packed |= digit << (8u * i);
+   }
+
+   return packed;
+}
+
+/**
+ * Transposes the 8x8 bit matrix held in x, where bit j of byte i (i.e., bit
+ * 8i + j) is row i, column j, so that it ends up at bit 8j + i. This is done in
+ * three rounds of delta swaps that exchange 1x1, 2x2, and then 4x4 blocks across
+ * the diagonal (see "Transposing a Bit Matrix" in Hacker's Delight, 2nd ed.).
+ */
+/******************************************************************************/
+static inline uint64_t Transpose8x8( uint64_t x )
+{
+   uint64_t t;
+
+   t = ( x ^ (x >> 7) )  & UINT64_C(0x00AA00AA00AA00AA);
+   x = x ^ t ^ (t << 7);
+   t = ( x ^ (x >> 14) ) & UINT64_C(0x0000CCCC0000CCCC);
+   x = x ^ t ^ (t << 14);
+   t = ( x ^ (x >> 28) ) & UINT64_C(0x00000000F0F0F0F0);
+   x = x ^ t ^ (t << 28);
+
+   return x;
+}
+
+/**
+ * Drops a transposed block (byte s = segment s of 8 digits) into the planes as
+ * digits [8 * block_idx, 8 * block_idx + 7].
+ */
+/******************************************************************************/
+static inline void ScatterBlock( uint64_t block,
+                                 size_t block_idx,
+                                 uint64_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] |= ( (block >> (8u * plane)) & 0xFFu ) << (DIGITS_PER_BLOCK * block_idx);
+   }
+}
+
+/******************************************************************************/
+static size_t ConvertWordToPlanes( const char * str,
+                                   size_t str_len,
+                                   size_t max_digits,
+                                   uint64_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   assert( (max_digits % DIGITS_PER_BLOCK == 0) && (max_digits <= 64) );
+
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] = 0;
+   }
+
+   // Only one block of encodings is ever held at a time, which keeps the stack
+   // usage small in the non-bit-packed layout.
+   union Ascii7Seg_Encoding_U block[DIGITS_PER_BLOCK];
+   size_t num_digits = 0;
+   size_t limit = MIN( str_len, max_digits );
+   while ( num_digits < limit )
+   {
+      size_t block_len = MIN( limit - num_digits, (size_t)DIGITS_PER_BLOCK );
+      size_t converted = Ascii7Seg_ConvertWord( &str[num_digits], block_len, block );
+
+      ScatterBlock( Transpose8x8( PackEncodings(block, converted) ),
+                    num_digits / DIGITS_PER_BLOCK,
+                    planes );
+      num_digits += converted;
+
+      if ( converted < block_len )
+      {
+         // Stopped early on an unsupported character or the null terminator
+         break;
+      }
+   }
+
+   return num_digits;
+}
+
+/******************************************************************************/
+static size_t EncodingsToPlanes( const union Ascii7Seg_Encoding_U * encodings,
+                                 size_t num_encodings,
+                                 size_t max_digits,
+                                 uint64_t planes[ASCII_7SEG_NUM_PLANES] )
+{
+   assert( (max_digits % DIGITS_PER_BLOCK == 0) && (max_digits <= 64) );
+
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      planes[plane] = 0;
+   }
+
+   size_t limit = MIN( num_encodings, max_digits );
+   for ( size_t num_digits = 0; num_digits < limit; num_digits += DIGITS_PER_BLOCK )
+   {
+      size_t block_len = MIN( limit - num_digits, (size_t)DIGITS_PER_BLOCK );
+      ScatterBlock( Transpose8x8( PackEncodings(&encodings[num_digits], block_len) ),
+                    num_digits / DIGITS_PER_BLOCK,
+                    planes );
+   }
+
+   return limit;
+}
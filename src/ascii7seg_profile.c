@@ -0,0 +1,191 @@
+/**
+ * @file ascii7seg_profile.c
+ * @brief Implementation of the per-display segment profiles.
+ *
+ * Every encoding is first packed into a byte (bit s = segment s, DP in bit 7).
+ * Rotating a glyph and rewiring its segments both just move bits around, so
+ * the mapping of a packed byte is the OR of the mappings of its set bits. That
+ * is what lets Ascii7Seg_ProfileApply() split the byte into two nibbles with
+ * 16-entry tables each, rather than needing a 256-entry table.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ascii7seg.h"
+#include "ascii7seg_profile.h"
+#include "ascii7seg_pack.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+#define NUM_PORT_BITS   8u
+
+/* Local Datatypes */
+
+/* Local Data */
+
+//! Segment that shows segment s of a glyph on an upside-down display
+static const uint8_t Rotated180[ASCII_7SEG_PROFILE_NUM_SEGMENTS] =
+{
+   3u,   // a -> d
+   4u,   // b -> e
+   5u,   // c -> f
+   0u,   // d -> a
+   1u,   // e -> b
+   2u,   // f -> c
+   6u,   // g stays
+   7u    // dp stays
+};
+
+/* Private Function Prototypes */
+
+static uint8_t MapPacked( const struct Ascii7Seg_ProfileConfig_S * cfg, unsigned int packed );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+bool Ascii7Seg_ProfileInit( struct Ascii7Seg_Profile_S * profile,
+                            const struct Ascii7Seg_ProfileConfig_S * cfg )
+{
+   if ( (NULL == profile) || (NULL == cfg) )
+   {
+      return false;
+   }
+
+   unsigned int bits_used = 0;
+   for ( size_t s = 0; s < ASCII_7SEG_PROFILE_NUM_SEGMENTS; s++ )
+   {
+      if ( (cfg->segment_bits[s] >= NUM_PORT_BITS) ||
+           (0u != (bits_used & (1u << cfg->segment_bits[s]))) )
+      {
+         return false;
+      }
+      bits_used |= 1u << cfg->segment_bits[s];
+   }
+
+   profile->blank = cfg->active_low ? UINT8_MAX : 0u;
+
+   for ( unsigned int n = 0; n < 16u; n++ )
+   {
+      profile->low_nibble[n] = MapPacked( cfg, n );
+      profile->high_nibble[n] = MapPacked( cfg, n << 4 );
+   }
+
+   (void)memset( profile->supported, 0, sizeof(profile->supported) );
+   profile->table[0] = profile->blank;
+   for ( unsigned int c = 1; c < ASCII_7SEG_PROFILE_NUM_CHARS; c++ )
+   {
+      union Ascii7Seg_Encoding_U encoding;
+      if ( Ascii7Seg_ConvertChar((char)c, &encoding) )
+      {
+         profile->table[c] = (uint8_t)( MapPacked(cfg, Ascii7Seg_PackEncoding(&encoding)) ^ profile->blank );
+         profile->supported[c / 8u] |= (uint8_t)( 1u << (c % 8u) );
+      }
+      else
+      {
+         profile->table[c] = profile->blank;
+      }
+   }
+
+   return true;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_ProfileConvertChar( const struct Ascii7Seg_Profile_S * profile,
+                                   char ascii_char,
+                                   uint8_t * buf )
+{
+   if ( (NULL == profile) || (NULL == buf) )
+   {
+      return false;
+   }
+
+   const uint8_t c = (uint8_t)ascii_char;
+   if ( (c >= ASCII_7SEG_PROFILE_NUM_CHARS) ||
+        (0u == (profile->supported[c / 8u] & (1u << (c % 8u)))) )
+   {
+      *buf = profile->blank;
+      return false;
+   }
+
+   *buf = profile->table[c];
+   return true;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_ProfileConvertWord( const struct Ascii7Seg_Profile_S * profile,
+                                     const char * str,
+                                     size_t str_len,
+                                     uint8_t * buf )
+{
+   if ( (NULL == profile) || (NULL == str) || (NULL == buf) )
+   {
+      return 0;
+   }
+
+   size_t chars_converted = 0;
+   while ( (chars_converted < str_len) && (str[chars_converted] != '\0') )
+   {
+      const uint8_t c = (uint8_t)str[chars_converted];
+      if ( (c >= ASCII_7SEG_PROFILE_NUM_CHARS) ||
+           (0u == (profile->supported[c / 8u] & (1u << (c % 8u)))) )
+      {
+         break;
+      }
+
+      buf[chars_converted] = profile->table[c];
+      chars_converted++;
+   }
+
+   return chars_converted;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_ProfileApply( const struct Ascii7Seg_Profile_S * profile,
+                             const union Ascii7Seg_Encoding_U * encodings,
+                             size_t num_encodings,
+                             uint8_t * buf )
+{
+   if ( (NULL == profile) || (NULL == encodings) || (NULL == buf) )
+   {
+      return false;
+   }
+
+   for ( size_t i = 0; i < num_encodings; i++ )
+   {
+      const uint8_t packed = Ascii7Seg_PackEncoding( &encodings[i] );
+      buf[i] = (uint8_t)( (profile->low_nibble[packed & 0x0Fu] |
+                           profile->high_nibble[packed >> 4]) ^ profile->blank );
+   }
+
+   return true;
+}
+
+/* Private Function Implementations */
+
+/**
+ * Moves the segments of a packed encoding to their port bits, rotating the
+ * glyph first if need be. Leaves the polarity alone.
+ */
+/******************************************************************************/
+static uint8_t MapPacked( const struct Ascii7Seg_ProfileConfig_S * cfg, unsigned int packed )
+{
+   unsigned int port = 0;
+   for ( size_t s = 0; s < ASCII_7SEG_PROFILE_NUM_SEGMENTS; s++ )
+   {
+      if ( 0u != (packed & (1u << s)) )
+      {
+         const size_t shown_on = cfg->rotate_180 ? Rotated180[s] : s;
+         port |= 1u << cfg->segment_bits[shown_on];
+      }
+   }
+
+   return (uint8_t)port;
+}
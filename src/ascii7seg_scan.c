@@ -0,0 +1,174 @@
+/**
+ * @file ascii7seg_scan.c
+ * @brief Implementation of the multiplex scan scheduler.
+ *
+ * All of the per-pin work (walking the segments of each encoding, applying the
+ * wiring and the active levels) happens in Ascii7Seg_ScanSetFrame(), at frame
+ * rate. Ascii7Seg_ScanTick() runs at scan rate and only copies precomputed
+ * masks to the ports, with no branch on the frame's contents.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "ascii7seg.h"
+#include "ascii7seg_scan.h"
+#include "ascii7seg_pack.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+/* Local Datatypes */
+
+/* Local Data */
+
+/* Private Function Prototypes */
+
+static inline void ToPortWrite( uint32_t on_pins,
+                                uint32_t all_pins,
+                                bool active_low,
+                                uint32_t * set_mask,
+                                uint32_t * clear_mask );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+bool Ascii7Seg_ScanInit( struct Ascii7Seg_Scan_S * scan,
+                         const struct Ascii7Seg_ScanPinMap_S * pins,
+                         const struct Ascii7Seg_ScanGpio_S * gpio,
+                         size_t blank_ticks )
+{
+   if ( (NULL == scan) || (NULL == pins) || (NULL == gpio) ||
+        (NULL == gpio->write_segments) || (NULL == gpio->write_digits) ||
+        (0 == pins->num_digits) || (pins->num_digits > ASCII_7SEG_SCAN_MAX_DIGITS) )
+   {
+      return false;
+   }
+
+   scan->pins = *pins;
+   scan->gpio = *gpio;
+   scan->blank_ticks = blank_ticks;
+   scan->digit = 0;
+   scan->phase = 0;
+   scan->active_bank = 0;
+
+   uint32_t all_digit_pins = 0;
+   for ( size_t d = 0; d < pins->num_digits; d++ )
+   {
+      all_digit_pins |= pins->digit_pins[d];
+   }
+   ToPortWrite( 0, all_digit_pins, pins->digits_active_low,
+                &scan->digits_off_set, &scan->digits_off_clear );
+
+   // Start out blank, in both banks
+   union Ascii7Seg_Encoding_U blank[ASCII_7SEG_SCAN_MAX_DIGITS];
+   (void)memset( blank, 0, sizeof(blank) );
+   (void)Ascii7Seg_ScanSetFrame( scan, blank );
+   (void)Ascii7Seg_ScanSetFrame( scan, blank );
+
+   scan->gpio.write_digits( scan->gpio.ctx, scan->digits_off_set, scan->digits_off_clear );
+
+   return true;
+}
+
+/******************************************************************************/
+bool Ascii7Seg_ScanSetFrame( struct Ascii7Seg_Scan_S * scan,
+                             const union Ascii7Seg_Encoding_U * digits )
+{
+   if ( (NULL == scan) || (NULL == digits) )
+   {
+      return false;
+   }
+
+   const struct Ascii7Seg_ScanPinMap_S * pins = &scan->pins;
+   const uint8_t bank = (uint8_t)( scan->active_bank ^ 1u );
+
+   uint32_t all_segment_pins = 0;
+   uint32_t all_digit_pins = 0;
+   for ( size_t s = 0; s < ASCII_7SEG_SCAN_NUM_SEGMENTS; s++ )
+   {
+      all_segment_pins |= pins->segment_pins[s];
+   }
+   for ( size_t d = 0; d < pins->num_digits; d++ )
+   {
+      all_digit_pins |= pins->digit_pins[d];
+   }
+
+   for ( size_t d = 0; d < pins->num_digits; d++ )
+   {
+      struct Ascii7Seg_ScanSlot_S * slot = &scan->slots[bank][d];
+      const uint8_t packed = Ascii7Seg_PackEncoding( &digits[d] );
+
+      uint32_t lit_pins = 0;
+      for ( size_t s = 0; s < ASCII_7SEG_SCAN_NUM_SEGMENTS; s++ )
+      {
+         if ( 0u != (packed & (1u << s)) )
+         {
+            lit_pins |= pins->segment_pins[s];
+         }
+      }
+
+      ToPortWrite( lit_pins, all_segment_pins, pins->segments_active_low,
+                   &slot->segments_set, &slot->segments_clear );
+      ToPortWrite( pins->digit_pins[d], all_digit_pins, pins->digits_active_low,
+                   &slot->digit_set, &slot->digit_clear );
+   }
+
+   // A single store, so a tick sees either the old frame or the new one
+   scan->active_bank = bank;
+
+   return true;
+}
+
+/******************************************************************************/
+void Ascii7Seg_ScanTick( struct Ascii7Seg_Scan_S * scan )
+{
+   assert( NULL != scan );
+
+   const struct Ascii7Seg_ScanGpio_S * gpio = &scan->gpio;
+
+   gpio->write_digits( gpio->ctx, scan->digits_off_set, scan->digits_off_clear );
+
+   if ( 0 == scan->phase )
+   {
+      const struct Ascii7Seg_ScanSlot_S * slot = &scan->slots[scan->active_bank][scan->digit];
+      gpio->write_segments( gpio->ctx, slot->segments_set, slot->segments_clear );
+      gpio->write_digits( gpio->ctx, slot->digit_set, slot->digit_clear );
+   }
+
+   if ( scan->phase < scan->blank_ticks )
+   {
+      scan->phase++;
+   }
+   else
+   {
+      scan->phase = 0;
+      scan->digit = ( (scan->digit + 1u) < scan->pins.num_digits ) ? (scan->digit + 1u) : 0;
+   }
+}
+
+/* Private Function Implementations */
+
+/**
+ * The set/clear masks that drive on_pins to their active level and the rest of
+ * all_pins to their inactive level.
+ */
+/******************************************************************************/
+static inline void ToPortWrite( uint32_t on_pins,
+                                uint32_t all_pins,
+                                bool active_low,
+                                uint32_t * set_mask,
+                                uint32_t * clear_mask )
+{
+   const uint32_t off_pins = all_pins & ~on_pins;
+
+   *set_mask = active_low ? off_pins : on_pins;
+   *clear_mask = active_low ? on_pins : off_pins;
+}
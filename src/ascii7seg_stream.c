@@ -0,0 +1,227 @@
+/**
+ * @file ascii7seg_stream.c
+ * @brief Implementation of the streaming 7-segment encoder.
+ *
+ * Runs of supported characters go through Ascii7Seg_ConvertBytes() straight
+ * into the free span of the ring, so a stream encodes at the same speed as a
+ * one-shot conversion (SIMD included) and never copies encodings around. Each
+ * unsupported character that ends a run is handled by the stream's policy
+ * before the next run is started.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <assert.h>
+#include "ascii7seg.h"
+#include "ascii7seg_stream.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+// Function-like macros
+
+#define MIN(a, b) ( ((a) < (b)) ? (a) : (b) )
+
+/* Local Datatypes */
+
+/* Local Data */
+
+/* Private Function Prototypes */
+
+static inline size_t ReadIdx( const struct Ascii7Seg_Stream_S * stream );
+static inline void Advance( struct Ascii7Seg_Stream_S * stream, size_t num_written );
+static inline void ResetStats( struct Ascii7Seg_StreamStats_S * stats );
+
+/* Public API Implementations */
+
+/******************************************************************************/
+bool Ascii7Seg_StreamInit( struct Ascii7Seg_Stream_S * stream,
+                           union Ascii7Seg_Encoding_U * ring,
+                           size_t ring_cap,
+                           enum Ascii7Seg_StreamPolicy_E policy,
+                           const union Ascii7Seg_Encoding_U * replacement )
+{
+   if ( (NULL == stream) || (NULL == ring) || (0 == ring_cap) ||
+        ((unsigned)policy >= (unsigned)ASCII_7SEG_STREAM_NUM_OF_POLICIES) )
+   {
+      return false;
+   }
+
+   stream->ring = ring;
+   stream->ring_cap = ring_cap;
+   stream->write_idx = 0;
+   stream->num_pending = 0;
+   stream->policy = policy;
+
+   if ( NULL != replacement )
+   {
+      stream->replacement = *replacement;
+   }
+   else
+   {
+      (void)memset( &stream->replacement, 0, sizeof(stream->replacement) );
+   }
+
+   ResetStats( &stream->stats );
+
+   return true;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_StreamFeed( struct Ascii7Seg_Stream_S * stream,
+                             const char * chunk,
+                             size_t chunk_len )
+{
+   if ( (NULL == stream) || (NULL == chunk) )
+   {
+      return 0;
+   }
+
+   size_t consumed = 0;
+   while ( consumed < chunk_len )
+   {
+      // The free part of the ring runs from write_idx up to the read index,
+      // wrapping around the end of the array at most once.
+      size_t span = MIN( stream->ring_cap - stream->num_pending,
+                         stream->ring_cap - stream->write_idx );
+      if ( 0 == span )
+      {
+         break; // Ring is full
+      }
+
+      // Passing the whole free span as the capacity is fine, since anything
+      // ConvertBytes() scribbles past the converted encodings is free anyway.
+      struct Ascii7Seg_Result_S result =
+         Ascii7Seg_ConvertBytes( &chunk[consumed],
+                                 chunk_len - consumed,
+                                 &stream->ring[stream->write_idx],
+                                 span );
+      Advance( stream, result.converted );
+      consumed += result.converted;
+
+      if ( ASCII_7SEG_NO_INVALID_IDX == result.invalid_idx )
+      {
+         continue; // The chunk ran out, or the span did and the ring wraps
+      }
+
+      // chunk[consumed] is unsupported
+      if ( ASCII_7SEG_STREAM_REPLACE == stream->policy )
+      {
+         if ( stream->num_pending == stream->ring_cap )
+         {
+            break; // No room for the replacement, so leave it for the next feed
+         }
+
+         stream->ring[stream->write_idx] = stream->replacement;
+         Advance( stream, 1 );
+      }
+
+      if ( 0 == stream->stats.num_invalid )
+      {
+         stream->stats.first_invalid_offset = stream->stats.chars_consumed + consumed;
+         stream->stats.first_invalid_char = result.invalid_char;
+      }
+      stream->stats.num_invalid++;
+      consumed++;
+   }
+
+   stream->stats.chars_consumed += consumed;
+
+   return consumed;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_StreamRead( struct Ascii7Seg_Stream_S * stream,
+                             union Ascii7Seg_Encoding_U * buf,
+                             size_t buf_len )
+{
+   if ( (NULL == stream) || (NULL == buf) )
+   {
+      return 0;
+   }
+
+   size_t num_read = MIN( buf_len, stream->num_pending );
+   size_t read_idx = ReadIdx( stream );
+
+   // At most two copies: up to the end of the ring, then from its start
+   size_t first = MIN( num_read, stream->ring_cap - read_idx );
+   (void)memcpy( buf, &stream->ring[read_idx], first * sizeof(buf[0]) );
+   (void)memcpy( &buf[first], stream->ring, (num_read - first) * sizeof(buf[0]) );
+
+   stream->num_pending -= num_read;
+
+   return num_read;
+}
+
+/******************************************************************************/
+size_t Ascii7Seg_StreamPending( const struct Ascii7Seg_Stream_S * stream )
+{
+   return (NULL == stream) ? 0 : stream->num_pending;
+}
+
+/******************************************************************************/
+struct Ascii7Seg_StreamStats_S Ascii7Seg_StreamFlush( struct Ascii7Seg_Stream_S * stream )
+{
+   struct Ascii7Seg_StreamStats_S stats;
+
+   if ( NULL == stream )
+   {
+      ResetStats( &stats );
+      return stats;
+   }
+
+   stats = stream->stats;
+   ResetStats( &stream->stats );
+
+   return stats;
+}
+
+/* Private Function Implementations */
+
+/**
+ * Index in the ring of the oldest encoding not yet read out (i.e., num_pending
+ * encodings back from write_idx, wrapping around the start of the ring).
+ */
+/******************************************************************************/
+static inline size_t ReadIdx( const struct Ascii7Seg_Stream_S * stream )
+{
+   return ( stream->write_idx >= stream->num_pending ) ?
+            ( stream->write_idx - stream->num_pending ) :
+            ( stream->write_idx + stream->ring_cap - stream->num_pending );
+}
+
+/**
+ * Accounts for num_written encodings just written at write_idx, which must not
+ * run past the end of the ring or fill more than its free space.
+ */
+/******************************************************************************/
+static inline void Advance( struct Ascii7Seg_Stream_S * stream, size_t num_written )
+{
+   assert( num_written <= stream->ring_cap - stream->write_idx );
+   assert( num_written <= stream->ring_cap - stream->num_pending );
+
+   stream->write_idx += num_written;
+   if ( stream->write_idx == stream->ring_cap )
+   {
+      stream->write_idx = 0;
+   }
+   stream->num_pending += num_written;
+   stream->stats.encodings_written += num_written;
+}
+
+/******************************************************************************/
+static inline void ResetStats( struct Ascii7Seg_StreamStats_S * stats )
+{
+   stats->chars_consumed = 0;
+   stats->encodings_written = 0;
+   stats->num_invalid = 0;
+   stats->first_invalid_offset = ASCII_7SEG_STREAM_NO_INVALID_OFFSET;
+   stats->first_invalid_char = '\0';
+}
@@ -0,0 +1,51 @@
+/**
+ * @file ascii7seg_test.h
+ * @brief Hooks for the unit tests to reach code that the host would never
+ *        select on its own. Internal, so not part of the API.
+ *
+ * The library only defines these when it is built with TEST (as the Makefile's
+ * test targets do), and only the tests include this header.
+ *
+ * @author Abdulla Almosalami (memphis242)
+ * @date Oct 17, 2026
+ * @copyright MIT License
+ */
+
+#ifndef ASCII_7SEG_TEST_H_
+#define ASCII_7SEG_TEST_H_
+
+/* File Inclusions */
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Test Hooks */
+
+/**
+ * @brief Forces Ascii7Seg_ConvertWord() and Ascii7Seg_ConvertBytes() onto one
+ *        of the variant's bulk kernels, so that each of them can be checked on
+ *        a host that would only ever select the fastest one.
+ *
+ * @param[in] kernel  0 for the scalar kernel, then SSSE3, AVX2 and AVX-512
+ *                    VBMI (where the variant has them). SIZE_MAX restores the
+ *                    kernel selected at load time.
+ *
+ * @return false if the variant has no such kernel or the CPU can't run it
+ *         (the kernel in use is left as it was)
+ */
+bool Ascii7Seg_TestForceBulkKernel( size_t kernel );
+
+/**
+ * @brief Forces Ascii7Seg_ConvertHex() onto one of its kernels, so that each
+ *        of them can be checked on a host that would only ever select the
+ *        fastest one.
+ *
+ * @param[in] kernel  0 for the scalar kernel, then SSSE3 and AVX2 (where the
+ *                    variant has them). SIZE_MAX restores the kernel selected at
+ *                    load time.
+ *
+ * @return false if the variant has no such kernel or the CPU can't run it
+ *         (the kernel in use is left as it was)
+ */
+bool Ascii7Seg_TestForceHexKernel( size_t kernel );
+
+#endif // ASCII_7SEG_TEST_H_
@@ -8,16 +8,22 @@
  */
 
 /* File Inclusions */
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <ctype.h>
 #include <limits.h>
+#include <string.h>
 #include "unity.h"
 #include "ascii7seg.h"
 #include "ascii7seg_config.h"
+#include "src/ascii7seg_test.h"
 
 /* Local Macro Definitions */
+#define LONG_STR_LEN 200   // Long enough to cover several iterations of any bulk path
+#define BUF_SENTINEL 0xA5
+#define MAX_BULK_KERNELS 4u   // Scalar, SSSE3, AVX2, AVX-512 VBMI
 
 /* Datatypes */
 
@@ -37,6 +43,18 @@ static const char SupportedAsciiCharacters[] =
       'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'
 };
 
+// Characters supported by the variant of the library under test
+#ifdef ASCII_7SEG_NUMS_ONLY
+static const char VariantSupportedChars[] = "0123456789";
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+static const char VariantSupportedChars[] = "0123456789EeRrOo";
+#else
+static const char VariantSupportedChars[] = "0123456789[]()_-|=><abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+#endif
+
+// Bulk kernel the checks are running on (see helper_ForEachBulkKernel())
+static size_t KernelUnderTest;
+
 // Full ASCII Encoding Lookup Table
 extern const union Ascii7Seg_Encoding_U AsciiEncodingReferenceLookup[ UINT8_MAX ];
 
@@ -49,17 +67,47 @@ void test_Ascii7Seg_ConvertChar_ValidChars(void);
 void test_Ascii7Seg_ConvertChar_NonPackedUnionCheck(void);
 void test_Ascii7Seg_ConvertChar_InvalidChars(void);
 void test_Ascii7Seg_ConvertChar_NullBuf(void);
+void test_Ascii7Seg_ConvertChar_PaddedLayout(void);
 
 void test_Ascii7Seg_ConvertWord_ValidString(void);
 void test_Ascii7Seg_ConvertWord_InvalidChars(void);
 void test_Ascii7Seg_ConvertWord_NullBuf(void);
 void test_Ascii7Seg_ConvertWord_NullStr(void);
 void test_Ascii7Seg_ConvertWord_ZeroLen(void);
+void test_Ascii7Seg_ConvertWord_LongStrings(void);
+void test_Ascii7Seg_ConvertWord_LongStringInvalidAtEachPosition(void);
+void test_Ascii7Seg_ConvertWord_LongStringTruncatedByLen(void);
+
+void test_Ascii7Seg_ConvertBytes_ValidBytes(void);
+void test_Ascii7Seg_ConvertBytes_InvalidAtEachPosition(void);
+void test_Ascii7Seg_ConvertBytes_NullCharIsInvalid(void);
+void test_Ascii7Seg_ConvertBytes_StopsAtCapacity(void);
+void test_Ascii7Seg_ConvertBytes_NeverWritesPastCapacity(void);
+void test_Ascii7Seg_ConvertBytes_NullArgs(void);
+
+void test_Ascii7Seg_ConvertWordEx_FoldsDots(void);
+void test_Ascii7Seg_ConvertWordEx_LoneDots(void);
+void test_Ascii7Seg_ConvertWordEx_WithoutFolding(void);
+void test_Ascii7Seg_ConvertWordEx_StopsAtCapacity(void);
+void test_Ascii7Seg_ConvertWordEx_LongString(void);
+void test_Ascii7Seg_ConvertWordEx_NullArgs(void);
 
 void test_Ascii7Seg_IsSupportedChar_AllAscii(void);
 
 
 bool helper_IsSupportedChar(char c);
+void helper_FillLongString(char * str, size_t len);
+void helper_CheckEncodings(const char * str, const union Ascii7Seg_Encoding_U * buf, size_t len);
+void helper_CheckSentinel(const union Ascii7Seg_Encoding_U * buf, size_t start, size_t end);
+void helper_CheckCells(const char * cells, const char * dps, const union Ascii7Seg_Encoding_U * buf, size_t len);
+void helper_ForEachBulkKernel(void (*check)(void));
+void helper_ConvertWord_LongStrings(void);
+void helper_ConvertWord_LongStringInvalidAtEachPosition(void);
+void helper_ConvertWord_LongStringTruncatedByLen(void);
+void helper_ConvertBytes_ValidBytes(void);
+void helper_ConvertBytes_InvalidAtEachPosition(void);
+void helper_ConvertBytes_StopsAtCapacity(void);
+void helper_ConvertBytes_NeverWritesPastCapacity(void);
 
 /* Meat of the Program */
 
@@ -71,12 +119,30 @@ int main(void)
    RUN_TEST(test_Ascii7Seg_ConvertChar_NonPackedUnionCheck);
    RUN_TEST(test_Ascii7Seg_ConvertChar_InvalidChars);
    RUN_TEST(test_Ascii7Seg_ConvertChar_NullBuf);
+   RUN_TEST(test_Ascii7Seg_ConvertChar_PaddedLayout);
 
    RUN_TEST(test_Ascii7Seg_ConvertWord_ValidString);
    RUN_TEST(test_Ascii7Seg_ConvertWord_InvalidChars);
    RUN_TEST(test_Ascii7Seg_ConvertWord_NullBuf);
    RUN_TEST(test_Ascii7Seg_ConvertWord_NullStr);
    RUN_TEST(test_Ascii7Seg_ConvertWord_ZeroLen);
+   RUN_TEST(test_Ascii7Seg_ConvertWord_LongStrings);
+   RUN_TEST(test_Ascii7Seg_ConvertWord_LongStringInvalidAtEachPosition);
+   RUN_TEST(test_Ascii7Seg_ConvertWord_LongStringTruncatedByLen);
+
+   RUN_TEST(test_Ascii7Seg_ConvertBytes_ValidBytes);
+   RUN_TEST(test_Ascii7Seg_ConvertBytes_InvalidAtEachPosition);
+   RUN_TEST(test_Ascii7Seg_ConvertBytes_NullCharIsInvalid);
+   RUN_TEST(test_Ascii7Seg_ConvertBytes_StopsAtCapacity);
+   RUN_TEST(test_Ascii7Seg_ConvertBytes_NeverWritesPastCapacity);
+   RUN_TEST(test_Ascii7Seg_ConvertBytes_NullArgs);
+
+   RUN_TEST(test_Ascii7Seg_ConvertWordEx_FoldsDots);
+   RUN_TEST(test_Ascii7Seg_ConvertWordEx_LoneDots);
+   RUN_TEST(test_Ascii7Seg_ConvertWordEx_WithoutFolding);
+   RUN_TEST(test_Ascii7Seg_ConvertWordEx_StopsAtCapacity);
+   RUN_TEST(test_Ascii7Seg_ConvertWordEx_LongString);
+   RUN_TEST(test_Ascii7Seg_ConvertWordEx_NullArgs);
 
    RUN_TEST(test_Ascii7Seg_IsSupportedChar_AllAscii);
 
@@ -92,7 +158,8 @@ void setUp(void)
 
 void tearDown(void)
 {
-   // Do nothing
+   // Back to the kernel selected at load time, even if a check failed midway
+   (void)Ascii7Seg_TestForceBulkKernel(SIZE_MAX);
 }
 
 /********************************** Helpers ***********************************/
@@ -110,6 +177,90 @@ bool helper_IsSupportedChar(char c)
    return false;
 }
 
+void helper_FillLongString(char * str, size_t len)
+{
+   for ( size_t i = 0; i < len; i++ )
+   {
+      str[i] = VariantSupportedChars[ (i * 7) % (sizeof(VariantSupportedChars) - 1) ];
+   }
+   str[len] = '\0';
+}
+
+void helper_CheckEncodings(const char * str, const union Ascii7Seg_Encoding_U * buf, size_t len)
+{
+   char err_msg[40];
+   for ( size_t i = 0; i < len; i++ )
+   {
+      (void)snprintf( err_msg, sizeof(err_msg), "kernel %zu, idx %zu : %c", KernelUnderTest, i, str[i] );
+#ifdef ASCII_7SEG_BIT_PACK
+      TEST_ASSERT_EQUAL_UINT8_MESSAGE(
+         AsciiEncodingReferenceLookup[(uint8_t)str[i]].encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+         buf[i].encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+         err_msg );
+#else
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE(
+         &AsciiEncodingReferenceLookup[(uint8_t)str[i]],
+         &buf[i],
+         sizeof(union Ascii7Seg_Encoding_U),
+         err_msg );
+#endif
+   }
+}
+
+void helper_CheckSentinel(const union Ascii7Seg_Encoding_U * buf, size_t start, size_t end)
+{
+   const uint8_t * bytes = (const uint8_t *)buf;
+   for ( size_t i = start * sizeof(union Ascii7Seg_Encoding_U);
+         i < end * sizeof(union Ascii7Seg_Encoding_U);
+         i++ )
+   {
+      TEST_ASSERT_EQUAL_UINT8_MESSAGE(BUF_SENTINEL, bytes[i], "buf written past the converted characters");
+   }
+}
+
+// cells[i] is the character buf[i] should show (' ' for blank), with its DP on if dps[i] is '.'
+void helper_CheckCells(const char * cells, const char * dps, const union Ascii7Seg_Encoding_U * buf, size_t len)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   char err_msg[40];
+   for ( size_t i = 0; i < len; i++ )
+   {
+      union Ascii7Seg_Encoding_U expected = AsciiEncodingReferenceLookup[(uint8_t)cells[i]];
+      expected.segments.dp = ('.' == dps[i]);
+
+      (void)snprintf( err_msg, sizeof(err_msg), "idx %zu : %c%c", i, cells[i], dps[i] );
+#ifdef ASCII_7SEG_BIT_PACK
+      TEST_ASSERT_EQUAL_HEX8_MESSAGE( expected.encoding_as_val, buf[i].encoding_as_val, err_msg );
+#else
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE( &expected, &buf[i], sizeof(union Ascii7Seg_Encoding_U), err_msg );
+#endif
+   }
+#else
+   (void)cells;
+   (void)dps;
+   (void)buf;
+   (void)len;
+#endif // ASCII_7SEG_HAS_DP
+}
+
+// Runs check once per bulk kernel of the variant that this CPU can run
+void helper_ForEachBulkKernel(void (*check)(void))
+{
+   size_t kernels_run = 0;
+   for ( KernelUnderTest = 0; KernelUnderTest < MAX_BULK_KERNELS; KernelUnderTest++ )
+   {
+      if ( Ascii7Seg_TestForceBulkKernel(KernelUnderTest) )
+      {
+         check();
+         kernels_run++;
+      }
+   }
+   TEST_ASSERT_TRUE_MESSAGE(kernels_run > 0, "The scalar kernel should always be available");
+
+   KernelUnderTest = 0;
+   (void)Ascii7Seg_TestForceBulkKernel(SIZE_MAX);
+}
+
 /**************************** Convert Single Char *****************************/
 
 void test_Ascii7Seg_ConvertChar_ValidChars(void)
@@ -304,6 +455,27 @@ void test_Ascii7Seg_ConvertChar_NullBuf(void)
    TEST_ASSERT_FALSE_MESSAGE(result, "Ascii7Seg_ConvertChar should fail if buf is NULL");
 }
 
+void test_Ascii7Seg_ConvertChar_PaddedLayout(void)
+{
+#if defined(ASCII_7SEG_PAD_TO_8_BYTES) && !defined(ASCII_7SEG_BIT_PACK)
+   struct AlignmentProbe_S { char c; union Ascii7Seg_Encoding_U enc; };
+
+   TEST_ASSERT_EQUAL_size_t( 8, sizeof(union Ascii7Seg_Encoding_U) );
+   TEST_ASSERT_EQUAL_size_t( 8, offsetof(struct AlignmentProbe_S, enc) );
+
+   // The decimal point must come out off no matter what was in the buffer before
+   for ( size_t i = 0; i < (sizeof(VariantSupportedChars) - 1); i++ )
+   {
+      union Ascii7Seg_Encoding_U enc;
+      memset( &enc, BUF_SENTINEL, sizeof(enc) );
+      TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar(VariantSupportedChars[i], &enc) );
+      TEST_ASSERT_FALSE( enc.segments.dp );
+   }
+#else
+   TEST_IGNORE_MESSAGE("Only applies with ASCII_7SEG_PAD_TO_8_BYTES");
+#endif
+}
+
 /******************************* Convert Word *********************************/
 
 void test_Ascii7Seg_ConvertWord_ValidString(void)
@@ -402,6 +574,371 @@ void test_Ascii7Seg_ConvertWord_ZeroLen(void)
    TEST_ASSERT_EQUAL_MESSAGE(0, converted, "Ascii7Seg_ConvertWord should return 0 if str_len is zero");
 }
 
+void test_Ascii7Seg_ConvertWord_LongStrings(void)
+{
+   helper_ForEachBulkKernel(helper_ConvertWord_LongStrings);
+}
+
+void helper_ConvertWord_LongStrings(void)
+{
+   // Extra room so that every starting alignment of the string can be covered
+   static char storage[LONG_STR_LEN + 64 + 1];
+   static union Ascii7Seg_Encoding_U buf[LONG_STR_LEN + 1];
+
+   for ( size_t offset = 0; offset < 64; offset++ )
+   {
+      for ( size_t len = 0; len <= LONG_STR_LEN; len += 13 )
+      {
+         char * str = &storage[offset];
+         helper_FillLongString(str, len);
+         memset(buf, BUF_SENTINEL, sizeof(buf));
+
+         size_t converted = Ascii7Seg_ConvertWord(str, len + 1, buf);
+
+         TEST_ASSERT_EQUAL_MESSAGE(len, converted, "Ascii7Seg_ConvertWord should stop at the null terminator");
+         helper_CheckEncodings(str, buf, len);
+         helper_CheckSentinel(buf, len, LONG_STR_LEN + 1);
+      }
+   }
+}
+
+void test_Ascii7Seg_ConvertWord_LongStringInvalidAtEachPosition(void)
+{
+   helper_ForEachBulkKernel(helper_ConvertWord_LongStringInvalidAtEachPosition);
+}
+
+void helper_ConvertWord_LongStringInvalidAtEachPosition(void)
+{
+   static char str[LONG_STR_LEN + 1];
+   static union Ascii7Seg_Encoding_U buf[LONG_STR_LEN];
+   const char invalid_chars[] = { ',', '.', ' ', '\n', '/', ':', (char)0x7F, (char)0xC8 };
+
+   for ( size_t i = 0; i < sizeof(invalid_chars); i++ )
+   {
+      for ( size_t pos = 0; pos < LONG_STR_LEN; pos++ )
+      {
+         helper_FillLongString(str, LONG_STR_LEN);
+         str[pos] = invalid_chars[i];
+         memset(buf, BUF_SENTINEL, sizeof(buf));
+
+         size_t converted = Ascii7Seg_ConvertWord(str, LONG_STR_LEN, buf);
+
+         TEST_ASSERT_EQUAL_MESSAGE(pos, converted, "Ascii7Seg_ConvertWord should stop at first invalid char");
+         helper_CheckEncodings(str, buf, pos);
+         helper_CheckSentinel(buf, pos, LONG_STR_LEN);
+      }
+   }
+}
+
+void test_Ascii7Seg_ConvertWord_LongStringTruncatedByLen(void)
+{
+   helper_ForEachBulkKernel(helper_ConvertWord_LongStringTruncatedByLen);
+}
+
+void helper_ConvertWord_LongStringTruncatedByLen(void)
+{
+   static char str[LONG_STR_LEN + 1];
+   static union Ascii7Seg_Encoding_U buf[LONG_STR_LEN];
+
+   helper_FillLongString(str, LONG_STR_LEN);
+
+   for ( size_t len = 0; len <= LONG_STR_LEN; len++ )
+   {
+      memset(buf, BUF_SENTINEL, sizeof(buf));
+
+      size_t converted = Ascii7Seg_ConvertWord(str, len, buf);
+
+      TEST_ASSERT_EQUAL_MESSAGE(len, converted, "Ascii7Seg_ConvertWord should stop at str_len");
+      helper_CheckEncodings(str, buf, len);
+      helper_CheckSentinel(buf, len, LONG_STR_LEN);
+   }
+}
+
+/******************************* Convert Bytes ********************************/
+
+void test_Ascii7Seg_ConvertBytes_ValidBytes(void)
+{
+   helper_ForEachBulkKernel(helper_ConvertBytes_ValidBytes);
+}
+
+void helper_ConvertBytes_ValidBytes(void)
+{
+   static char storage[LONG_STR_LEN + 64 + 1];
+   static union Ascii7Seg_Encoding_U buf[LONG_STR_LEN];
+
+   for ( size_t offset = 0; offset < 64; offset++ )
+   {
+      for ( size_t len = 0; len <= LONG_STR_LEN; len += 13 )
+      {
+         char * src = &storage[offset];
+         helper_FillLongString(src, len);
+
+         struct Ascii7Seg_Result_S result = Ascii7Seg_ConvertBytes(src, len, buf, LONG_STR_LEN);
+
+         TEST_ASSERT_EQUAL_size_t(len, result.converted);
+         TEST_ASSERT_EQUAL_size_t(ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx);
+         TEST_ASSERT_EQUAL_CHAR('\0', result.invalid_char);
+         helper_CheckEncodings(src, buf, len);
+      }
+   }
+}
+
+void test_Ascii7Seg_ConvertBytes_InvalidAtEachPosition(void)
+{
+   helper_ForEachBulkKernel(helper_ConvertBytes_InvalidAtEachPosition);
+}
+
+void helper_ConvertBytes_InvalidAtEachPosition(void)
+{
+   static char src[LONG_STR_LEN + 1];
+   static union Ascii7Seg_Encoding_U buf[LONG_STR_LEN];
+   const char invalid_chars[] = { ',', '.', ' ', '\n', '/', ':', (char)0x7F, (char)0xC8 };
+
+   for ( size_t i = 0; i < sizeof(invalid_chars); i++ )
+   {
+      for ( size_t pos = 0; pos < LONG_STR_LEN; pos++ )
+      {
+         helper_FillLongString(src, LONG_STR_LEN);
+         src[pos] = invalid_chars[i];
+
+         struct Ascii7Seg_Result_S result = Ascii7Seg_ConvertBytes(src, LONG_STR_LEN, buf, LONG_STR_LEN);
+
+         TEST_ASSERT_EQUAL_size_t(pos, result.converted);
+         TEST_ASSERT_EQUAL_size_t(pos, result.invalid_idx);
+         TEST_ASSERT_EQUAL_CHAR(invalid_chars[i], result.invalid_char);
+         helper_CheckEncodings(src, buf, pos);
+      }
+   }
+}
+
+void test_Ascii7Seg_ConvertBytes_NullCharIsInvalid(void)
+{
+   const char src[] = { '1', '2', '\0', '3' };
+   union Ascii7Seg_Encoding_U buf[sizeof(src)];
+
+   struct Ascii7Seg_Result_S result = Ascii7Seg_ConvertBytes(src, sizeof(src), buf, sizeof(src));
+
+   TEST_ASSERT_EQUAL_size_t(2, result.converted);
+   TEST_ASSERT_EQUAL_size_t(2, result.invalid_idx);
+   TEST_ASSERT_EQUAL_CHAR('\0', result.invalid_char);
+   helper_CheckEncodings(src, buf, 2);
+}
+
+void test_Ascii7Seg_ConvertBytes_StopsAtCapacity(void)
+{
+   helper_ForEachBulkKernel(helper_ConvertBytes_StopsAtCapacity);
+}
+
+void helper_ConvertBytes_StopsAtCapacity(void)
+{
+   static char src[LONG_STR_LEN + 1];
+   static union Ascii7Seg_Encoding_U buf[LONG_STR_LEN];
+
+   helper_FillLongString(src, LONG_STR_LEN);
+   for ( size_t cap = 0; cap < LONG_STR_LEN; cap++ )
+   {
+      struct Ascii7Seg_Result_S result = Ascii7Seg_ConvertBytes(src, LONG_STR_LEN, buf, cap);
+
+      // Ran out of room before running into anything unsupported
+      TEST_ASSERT_EQUAL_size_t(cap, result.converted);
+      TEST_ASSERT_EQUAL_size_t(ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx);
+      helper_CheckEncodings(src, buf, cap);
+   }
+}
+
+void test_Ascii7Seg_ConvertBytes_NeverWritesPastCapacity(void)
+{
+   helper_ForEachBulkKernel(helper_ConvertBytes_NeverWritesPastCapacity);
+}
+
+void helper_ConvertBytes_NeverWritesPastCapacity(void)
+{
+   static char src[LONG_STR_LEN + 1];
+   static union Ascii7Seg_Encoding_U buf[LONG_STR_LEN];
+
+   for ( size_t pos = 0; pos < LONG_STR_LEN; pos += 3 )
+   {
+      helper_FillLongString(src, LONG_STR_LEN);
+      src[pos] = ',';
+      for ( size_t cap = pos; cap <= pos + 70 && cap < LONG_STR_LEN; cap += 7 )
+      {
+         memset(buf, BUF_SENTINEL, sizeof(buf));
+
+         struct Ascii7Seg_Result_S result = Ascii7Seg_ConvertBytes(src, LONG_STR_LEN, buf, cap);
+
+         TEST_ASSERT_EQUAL_size_t(pos, result.converted);
+         helper_CheckEncodings(src, buf, pos);
+         // buf[pos] to buf[cap - 1] are scratch, but nothing from cap on is touched
+         helper_CheckSentinel(buf, cap, LONG_STR_LEN);
+      }
+   }
+}
+
+void test_Ascii7Seg_ConvertBytes_NullArgs(void)
+{
+   union Ascii7Seg_Encoding_U buf[3];
+
+   struct Ascii7Seg_Result_S result = Ascii7Seg_ConvertBytes(NULL, 3, buf, 3);
+   TEST_ASSERT_EQUAL_size_t(0, result.converted);
+   TEST_ASSERT_EQUAL_size_t(ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx);
+
+   result = Ascii7Seg_ConvertBytes("123", 3, NULL, 3);
+   TEST_ASSERT_EQUAL_size_t(0, result.converted);
+   TEST_ASSERT_EQUAL_size_t(ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx);
+}
+
+/************************** Convert Word With Options **************************/
+
+void test_Ascii7Seg_ConvertWordEx_FoldsDots(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   union Ascii7Seg_Encoding_U buf[8];
+
+   struct Ascii7Seg_WordResult_S result = Ascii7Seg_ConvertWordEx("3.14", 8, buf, 8, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(4, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(3, result.produced);
+   helper_CheckCells("314", ".  ", buf, 3);
+
+   result = Ascii7Seg_ConvertWordEx("1.2.3.", SIZE_MAX, buf, 8, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(6, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(3, result.produced);
+   helper_CheckCells("123", "...", buf, 3);
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertWordEx_LoneDots(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   union Ascii7Seg_Encoding_U buf[8];
+
+   // Nothing before the dot to fold it into
+   struct Ascii7Seg_WordResult_S result = Ascii7Seg_ConvertWordEx(".5", 8, buf, 8, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(2, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(2, result.produced);
+   helper_CheckCells(" 5", ". ", buf, 2);
+
+   // The first dot already took the DP
+   result = Ascii7Seg_ConvertWordEx("1..2", 8, buf, 8, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(4, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(3, result.produced);
+   helper_CheckCells("1 2", ".. ", buf, 3);
+
+   result = Ascii7Seg_ConvertWordEx("...", 8, buf, 8, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(3, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(3, result.produced);
+   helper_CheckCells("   ", "...", buf, 3);
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertWordEx_WithoutFolding(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   union Ascii7Seg_Encoding_U buf[8];
+
+   // Same as Ascii7Seg_ConvertWord(): '.' is just an unsupported character
+   struct Ascii7Seg_WordResult_S result = Ascii7Seg_ConvertWordEx("3.14", 8, buf, 8, ASCII_7SEG_WORD_NONE);
+   TEST_ASSERT_EQUAL_size_t(1, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(1, result.produced);
+   helper_CheckCells("3", " ", buf, 1);
+
+   // Other unsupported characters and the null terminator still end the word
+   result = Ascii7Seg_ConvertWordEx("1.2,3", 8, buf, 8, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(3, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(2, result.produced);
+   result = Ascii7Seg_ConvertWordEx("1.2\0" "3", 5, buf, 8, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(3, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(2, result.produced);
+   result = Ascii7Seg_ConvertWordEx("1.2.3", 3, buf, 8, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(3, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(2, result.produced);
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertWordEx_StopsAtCapacity(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   union Ascii7Seg_Encoding_U buf[4];
+
+   // A dot after the last encoding still fits, in its DP
+   struct Ascii7Seg_WordResult_S result = Ascii7Seg_ConvertWordEx("12.3", 4, buf, 2, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(3, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(2, result.produced);
+   helper_CheckCells("12", " .", buf, 2);
+
+   // A lone dot doesn't
+   result = Ascii7Seg_ConvertWordEx("1..", 3, buf, 1, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(2, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(1, result.produced);
+   result = Ascii7Seg_ConvertWordEx(".", 1, buf, 0, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(0, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(0, result.produced);
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertWordEx_LongString(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   static char src[LONG_STR_LEN + 1];
+   static char cells[LONG_STR_LEN];
+   static char dps[LONG_STR_LEN];
+   static union Ascii7Seg_Encoding_U buf[LONG_STR_LEN];
+
+   // Long runs between the dots, to go through the bulk paths too
+   helper_FillLongString(src, LONG_STR_LEN);
+   size_t num_cells = 0;
+   for ( size_t i = 0; i < LONG_STR_LEN; i++ )
+   {
+      if ( 0 == (i % 37) )
+      {
+         src[i] = '.';
+      }
+
+      if ( ('.' == src[i]) && (num_cells > 0) && (' ' == dps[num_cells - 1]) && ('.' != src[i - 1]) )
+      {
+         dps[num_cells - 1] = '.';
+      }
+      else
+      {
+         cells[num_cells] = ('.' == src[i]) ? ' ' : src[i];
+         dps[num_cells] = ('.' == src[i]) ? '.' : ' ';
+         num_cells++;
+      }
+   }
+
+   struct Ascii7Seg_WordResult_S result = Ascii7Seg_ConvertWordEx(src, LONG_STR_LEN, buf, LONG_STR_LEN, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(LONG_STR_LEN, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(num_cells, result.produced);
+   helper_CheckCells(cells, dps, buf, num_cells);
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertWordEx_NullArgs(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   union Ascii7Seg_Encoding_U buf[3];
+
+   struct Ascii7Seg_WordResult_S result = Ascii7Seg_ConvertWordEx(NULL, 3, buf, 3, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(0, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(0, result.produced);
+
+   result = Ascii7Seg_ConvertWordEx("1.2", 3, NULL, 3, ASCII_7SEG_WORD_FOLD_DP);
+   TEST_ASSERT_EQUAL_size_t(0, result.consumed);
+   TEST_ASSERT_EQUAL_size_t(0, result.produced);
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
 /******************************* Is Supported? ********************************/
 
 void test_Ascii7Seg_IsSupportedChar_AllAscii(void)
@@ -0,0 +1,245 @@
+/*!
+ * @file    test_ascii7seg_decode.c
+ * @brief   Test file for the decoder from 7-segment encodings back to ASCII.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_decode.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+
+/* Local Variables */
+
+extern const union Ascii7Seg_Encoding_U AsciiEncodingReferenceLookup[ UINT8_MAX ];
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_Decode_InvalidArgs(void);
+void test_Ascii7Seg_DecodeSegments_Digits(void);
+void test_Ascii7Seg_DecodeSegments_InvertsEveryEncoding(void);
+void test_Ascii7Seg_DecodeSegments_Ambiguous(void);
+void test_Ascii7Seg_DecodeSegments_Undecodable(void);
+void test_Ascii7Seg_DecodeSegments_IgnoresDecimalPoint(void);
+void test_Ascii7Seg_DecodeSegmentsBulk_RoundTrip(void);
+void test_Ascii7Seg_DecodeSegmentsBulk_CarriesOnPastUndecodable(void);
+void test_Ascii7Seg_DecodeMatches(void);
+
+union Ascii7Seg_Encoding_U helper_Encoding(uint8_t packed);
+bool helper_SameSegments(const union Ascii7Seg_Encoding_U * x, const union Ascii7Seg_Encoding_U * y);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_Decode_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_DecodeSegments_Digits);
+   RUN_TEST(test_Ascii7Seg_DecodeSegments_InvertsEveryEncoding);
+   RUN_TEST(test_Ascii7Seg_DecodeSegments_Ambiguous);
+   RUN_TEST(test_Ascii7Seg_DecodeSegments_Undecodable);
+   RUN_TEST(test_Ascii7Seg_DecodeSegments_IgnoresDecimalPoint);
+   RUN_TEST(test_Ascii7Seg_DecodeSegmentsBulk_RoundTrip);
+   RUN_TEST(test_Ascii7Seg_DecodeSegmentsBulk_CarriesOnPastUndecodable);
+   RUN_TEST(test_Ascii7Seg_DecodeMatches);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   // Do nothing
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+// The encoding with segment s on if bit s of packed is set (a = 0 ... g = 6)
+union Ascii7Seg_Encoding_U helper_Encoding(uint8_t packed)
+{
+   union Ascii7Seg_Encoding_U encoding;
+   (void)memset( &encoding, 0, sizeof(encoding) );
+   encoding.segments.a = 0u != (packed & (1u << 0));
+   encoding.segments.b = 0u != (packed & (1u << 1));
+   encoding.segments.c = 0u != (packed & (1u << 2));
+   encoding.segments.d = 0u != (packed & (1u << 3));
+   encoding.segments.e = 0u != (packed & (1u << 4));
+   encoding.segments.f = 0u != (packed & (1u << 5));
+   encoding.segments.g = 0u != (packed & (1u << 6));
+   return encoding;
+}
+
+bool helper_SameSegments(const union Ascii7Seg_Encoding_U * x, const union Ascii7Seg_Encoding_U * y)
+{
+   return ( x->segments.a == y->segments.a ) && ( x->segments.b == y->segments.b ) &&
+          ( x->segments.c == y->segments.c ) && ( x->segments.d == y->segments.d ) &&
+          ( x->segments.e == y->segments.e ) && ( x->segments.f == y->segments.f ) &&
+          ( x->segments.g == y->segments.g );
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_Decode_InvalidArgs(void)
+{
+   const struct Ascii7Seg_Decoded_S decoded = Ascii7Seg_DecodeSegments( NULL );
+   TEST_ASSERT_EQUAL_CHAR( '\0', decoded.canonical );
+   TEST_ASSERT_EQUAL_STRING( "", decoded.candidates );
+
+   union Ascii7Seg_Encoding_U encoding = helper_Encoding( 0x3F );
+   char c = 'x';
+   struct Ascii7Seg_DecodeResult_S result = Ascii7Seg_DecodeSegmentsBulk( NULL, 1, &c );
+   TEST_ASSERT_EQUAL_size_t( 0, result.decoded );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_NO_INVALID_IDX, result.first_undecodable );
+   result = Ascii7Seg_DecodeSegmentsBulk( &encoding, 1, NULL );
+   TEST_ASSERT_EQUAL_size_t( 0, result.decoded );
+   TEST_ASSERT_EQUAL_CHAR( 'x', c );
+
+   TEST_ASSERT_FALSE( Ascii7Seg_DecodeMatches(NULL, '0') );
+   TEST_ASSERT_FALSE( Ascii7Seg_DecodeMatches(&encoding, '\0') );
+}
+
+void test_Ascii7Seg_DecodeSegments_Digits(void)
+{
+   static const uint8_t PackedDigits[10] =
+   {
+      0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+   };
+
+   for ( size_t d = 0; d < 10; d++ )
+   {
+      const union Ascii7Seg_Encoding_U encoding = helper_Encoding( PackedDigits[d] );
+      TEST_ASSERT_EQUAL_CHAR( (char)('0' + d), Ascii7Seg_DecodeSegments(&encoding).canonical );
+   }
+}
+
+// Every character the full range encodes is among the candidates of its own
+// encoding, and every candidate is encoded the same way
+void test_Ascii7Seg_DecodeSegments_InvertsEveryEncoding(void)
+{
+   for ( unsigned int c = 1; c < 128u; c++ )
+   {
+      const union Ascii7Seg_Encoding_U * encoding = &AsciiEncodingReferenceLookup[c];
+      const struct Ascii7Seg_Decoded_S decoded = Ascii7Seg_DecodeSegments( encoding );
+      const bool encodable = !helper_SameSegments( encoding, &AsciiEncodingReferenceLookup[0] );
+
+      TEST_ASSERT_EQUAL( encodable, NULL != strchr(decoded.candidates, (int)c) );
+      if ( encodable )
+      {
+         TEST_ASSERT_EQUAL_CHAR( decoded.candidates[0], decoded.canonical );
+         for ( const char * candidate = decoded.candidates; '\0' != *candidate; candidate++ )
+         {
+            TEST_ASSERT_TRUE( helper_SameSegments(encoding, &AsciiEncodingReferenceLookup[(uint8_t)*candidate]) );
+         }
+      }
+   }
+}
+
+void test_Ascii7Seg_DecodeSegments_Ambiguous(void)
+{
+   union Ascii7Seg_Encoding_U encoding = AsciiEncodingReferenceLookup['5'];
+   struct Ascii7Seg_Decoded_S decoded = Ascii7Seg_DecodeSegments( &encoding );
+   TEST_ASSERT_EQUAL_CHAR( '5', decoded.canonical );
+   TEST_ASSERT_NOT_NULL( strchr(decoded.candidates, 'S') );
+
+   encoding = AsciiEncodingReferenceLookup['O'];
+   decoded = Ascii7Seg_DecodeSegments( &encoding );
+   TEST_ASSERT_EQUAL_CHAR( '0', decoded.canonical );
+   TEST_ASSERT_NOT_NULL( strchr(decoded.candidates, 'O') );
+
+   encoding = AsciiEncodingReferenceLookup['B'];
+   decoded = Ascii7Seg_DecodeSegments( &encoding );
+   TEST_ASSERT_EQUAL_CHAR( '8', decoded.canonical );
+   TEST_ASSERT_EQUAL_STRING( "8B", decoded.candidates );
+
+   // Not ambiguous
+   encoding = AsciiEncodingReferenceLookup['E'];
+   TEST_ASSERT_EQUAL_STRING( "E", Ascii7Seg_DecodeSegments(&encoding).candidates );
+}
+
+void test_Ascii7Seg_DecodeSegments_Undecodable(void)
+{
+   // Blank, and segments a and d alone
+   static const uint8_t Undecodable[] = { 0x00, 0x09 };
+
+   for ( size_t i = 0; i < (sizeof(Undecodable) / sizeof(Undecodable[0])); i++ )
+   {
+      const union Ascii7Seg_Encoding_U encoding = helper_Encoding( Undecodable[i] );
+      const struct Ascii7Seg_Decoded_S decoded = Ascii7Seg_DecodeSegments( &encoding );
+      TEST_ASSERT_EQUAL_CHAR( '\0', decoded.canonical );
+      TEST_ASSERT_EQUAL_STRING( "", decoded.candidates );
+   }
+}
+
+void test_Ascii7Seg_DecodeSegments_IgnoresDecimalPoint(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   union Ascii7Seg_Encoding_U encoding = helper_Encoding( 0x6D );
+   encoding.segments.dp = 1;
+   TEST_ASSERT_EQUAL_CHAR( '5', Ascii7Seg_DecodeSegments(&encoding).canonical );
+   TEST_ASSERT_TRUE( Ascii7Seg_DecodeMatches(&encoding, '5') );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_DecodeSegmentsBulk_RoundTrip(void)
+{
+   // Digits only, so that every variant of the library can encode them
+   static const char Digits[] = "31415926535897932384626433832795";
+   union Ascii7Seg_Encoding_U encodings[sizeof(Digits) - 1];
+   char decoded[sizeof(Digits)] = { 0 };
+
+   TEST_ASSERT_EQUAL_size_t( sizeof(Digits) - 1, Ascii7Seg_ConvertWord(Digits, sizeof(Digits) - 1, encodings) );
+   const struct Ascii7Seg_DecodeResult_S result = Ascii7Seg_DecodeSegmentsBulk( encodings, sizeof(Digits) - 1, decoded );
+   TEST_ASSERT_EQUAL_size_t( sizeof(Digits) - 1, result.decoded );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_NO_INVALID_IDX, result.first_undecodable );
+   TEST_ASSERT_EQUAL_STRING( Digits, decoded );
+}
+
+void test_Ascii7Seg_DecodeSegmentsBulk_CarriesOnPastUndecodable(void)
+{
+   union Ascii7Seg_Encoding_U encodings[5] =
+   {
+      helper_Encoding(0x06), helper_Encoding(0x00), helper_Encoding(0x5B),
+      helper_Encoding(0x09), helper_Encoding(0x4F)
+   };
+   char decoded[5];
+
+   const struct Ascii7Seg_DecodeResult_S result = Ascii7Seg_DecodeSegmentsBulk( encodings, 5, decoded );
+   TEST_ASSERT_EQUAL_size_t( 3, result.decoded );
+   TEST_ASSERT_EQUAL_size_t( 1, result.first_undecodable );
+   TEST_ASSERT_EQUAL_MEMORY( "1\0" "2\0" "3", decoded, sizeof(decoded) );
+}
+
+void test_Ascii7Seg_DecodeMatches(void)
+{
+   const union Ascii7Seg_Encoding_U zero = helper_Encoding( 0x3F );
+   TEST_ASSERT_TRUE( Ascii7Seg_DecodeMatches(&zero, '0') );
+   TEST_ASSERT_TRUE( Ascii7Seg_DecodeMatches(&zero, 'O') );
+   TEST_ASSERT_FALSE( Ascii7Seg_DecodeMatches(&zero, '8') );
+
+   const union Ascii7Seg_Encoding_U blank = helper_Encoding( 0x00 );
+   TEST_ASSERT_FALSE( Ascii7Seg_DecodeMatches(&blank, '0') );
+}
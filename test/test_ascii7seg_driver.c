@@ -0,0 +1,268 @@
+/*!
+ * @file    test_ascii7seg_driver.c
+ * @brief   Test file for the driver IC backends.
+ *
+ * The expected bytes are written out from the datasheets (e.g., the MAX7219
+ * no-decode segment table), not computed, so that they also check the bit
+ * order of each IC.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_driver.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+#define LOG_CAP   64
+#define TXN_CAP   16
+
+/* Datatypes */
+
+/* Local Variables */
+
+// Digits 0-9 in MAX7219 no-decode order (DP A B C D E F G, MSB first)
+static const uint8_t Max7219Digits[10] =
+{
+   0x7E, 0x30, 0x6D, 0x79, 0x33, 0x5B, 0x5F, 0x70, 0x7F, 0x7B
+};
+
+// Digits 0-9 in TM1637/HT16K33 order (A in bit 0 up to G in bit 6, DP in bit 7)
+static const uint8_t LsbFirstDigits[10] =
+{
+   0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+};
+
+static union Ascii7Seg_Encoding_U Digits[ASCII_7SEG_MAX7219_MAX_DIGITS];
+
+static uint8_t Log[LOG_CAP];
+static size_t TxnLens[TXN_CAP];
+static struct Ascii7Seg_MockTransport_S Mock;
+static struct Ascii7Seg_Transport_S Transport;
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_Max7219BuildFrame_SegmentOrder(void);
+void test_Ascii7Seg_Max7219_InitAndWriteFrame(void);
+void test_Ascii7Seg_Tm1637_WriteFrame(void);
+void test_Ascii7Seg_Ht16k33_InitAndWriteFrame(void);
+void test_Ascii7Seg_Driver_DecimalPoint(void);
+void test_Ascii7Seg_Driver_InvalidArgs(void);
+void test_Ascii7Seg_Driver_TransportFailure(void);
+
+void helper_CheckTxnLens(const size_t * expected, size_t num_txns);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_Max7219BuildFrame_SegmentOrder);
+   RUN_TEST(test_Ascii7Seg_Max7219_InitAndWriteFrame);
+   RUN_TEST(test_Ascii7Seg_Tm1637_WriteFrame);
+   RUN_TEST(test_Ascii7Seg_Ht16k33_InitAndWriteFrame);
+   RUN_TEST(test_Ascii7Seg_Driver_DecimalPoint);
+   RUN_TEST(test_Ascii7Seg_Driver_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_Driver_TransportFailure);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   // Digit i shows i, except the last, which shows 9
+   for ( size_t i = 0; i < ASCII_7SEG_MAX7219_MAX_DIGITS; i++ )
+   {
+      const char c = (i + 1 < ASCII_7SEG_MAX7219_MAX_DIGITS) ? (char)('0' + i) : '9';
+      TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar(c, &Digits[i]) );
+   }
+
+   TEST_ASSERT_TRUE( Ascii7Seg_MockTransportInit(&Mock, Log, LOG_CAP, TxnLens, TXN_CAP, &Transport) );
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+void helper_CheckTxnLens(const size_t * expected, size_t num_txns)
+{
+   TEST_ASSERT_EQUAL_size_t( num_txns, Mock.num_txns );
+   for ( size_t t = 0; t < num_txns; t++ )
+   {
+      TEST_ASSERT_EQUAL_size_t( expected[t], TxnLens[t] );
+   }
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_Max7219BuildFrame_SegmentOrder(void)
+{
+   const uint8_t expected[] =
+   {
+      0x01, Max7219Digits[0], 0x02, Max7219Digits[1], 0x03, Max7219Digits[2], 0x04, Max7219Digits[3],
+      0x05, Max7219Digits[4], 0x06, Max7219Digits[5], 0x07, Max7219Digits[6], 0x08, Max7219Digits[9]
+   };
+   uint8_t frame[ASCII_7SEG_MAX7219_FRAME_LEN(ASCII_7SEG_MAX7219_MAX_DIGITS)];
+
+   TEST_ASSERT_EQUAL_size_t( sizeof(expected),
+                             Ascii7Seg_Max7219BuildFrame(Digits, ASCII_7SEG_MAX7219_MAX_DIGITS, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected, frame, sizeof(expected) );
+
+   // The other two digits not covered above
+   union Ascii7Seg_Encoding_U more[2];
+   TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar('7', &more[0]) );
+   TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar('8', &more[1]) );
+   TEST_ASSERT_EQUAL_size_t( 4, Ascii7Seg_Max7219BuildFrame(more, 2, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_HEX8( Max7219Digits[7], frame[1] );
+   TEST_ASSERT_EQUAL_HEX8( Max7219Digits[8], frame[3] );
+}
+
+void test_Ascii7Seg_Max7219_InitAndWriteFrame(void)
+{
+   const uint8_t expected_init[] = { 0x0F, 0x00, 0x09, 0x00, 0x0B, 0x03, 0x0A, 0x07, 0x0C, 0x01 };
+   const uint8_t expected_frame[] =
+   {
+      0x01, Max7219Digits[0], 0x02, Max7219Digits[1], 0x03, Max7219Digits[2], 0x04, Max7219Digits[3]
+   };
+   const size_t expected_lens[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2 };
+
+   TEST_ASSERT_TRUE( Ascii7Seg_Max7219Init(&Transport, 4, 7) );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected_init, Log, sizeof(expected_init) );
+   helper_CheckTxnLens( expected_lens, 5 );
+
+   Mock.log_len = 0;
+   Mock.num_txns = 0;
+   TEST_ASSERT_TRUE( Ascii7Seg_Max7219WriteFrame(&Transport, Digits, 4) );
+   TEST_ASSERT_EQUAL_size_t( sizeof(expected_frame), Mock.log_len );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected_frame, Log, sizeof(expected_frame) );
+   helper_CheckTxnLens( expected_lens, 4 );
+}
+
+void test_Ascii7Seg_Tm1637_WriteFrame(void)
+{
+   const uint8_t expected[] =
+   {
+      0x40,
+      0xC0, LsbFirstDigits[0], LsbFirstDigits[1], LsbFirstDigits[2], LsbFirstDigits[3],
+      0x8D
+   };
+   const size_t expected_lens[] = { 1, 5, 1 };
+
+   uint8_t frame[ASCII_7SEG_TM1637_FRAME_LEN(4)];
+   TEST_ASSERT_EQUAL_size_t( sizeof(expected), Ascii7Seg_Tm1637BuildFrame(Digits, 4, 5, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected, frame, sizeof(expected) );
+
+   TEST_ASSERT_TRUE( Ascii7Seg_Tm1637WriteFrame(&Transport, Digits, 4, 5) );
+   TEST_ASSERT_EQUAL_size_t( sizeof(expected), Mock.log_len );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected, Log, sizeof(expected) );
+   helper_CheckTxnLens( expected_lens, 3 );
+}
+
+void test_Ascii7Seg_Ht16k33_InitAndWriteFrame(void)
+{
+   const uint8_t expected_init[] = { 0x21, 0xEF, 0x81 };
+   const size_t expected_init_lens[] = { 1, 1, 1 };
+   const uint8_t expected_frame[ASCII_7SEG_HT16K33_FRAME_LEN] =
+   {
+      0x00,
+      LsbFirstDigits[0], 0, LsbFirstDigits[1], 0, LsbFirstDigits[2], 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0  // Digits past the third are cleared
+   };
+
+   TEST_ASSERT_TRUE( Ascii7Seg_Ht16k33Init(&Transport, ASCII_7SEG_HT16K33_MAX_BRIGHTNESS) );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected_init, Log, sizeof(expected_init) );
+   helper_CheckTxnLens( expected_init_lens, 3 );
+
+   Mock.log_len = 0;
+   Mock.num_txns = 0;
+   TEST_ASSERT_TRUE( Ascii7Seg_Ht16k33WriteFrame(&Transport, Digits, 3) );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_HT16K33_FRAME_LEN, Mock.log_len );
+   TEST_ASSERT_EQUAL_HEX8_ARRAY( expected_frame, Log, sizeof(expected_frame) );
+   TEST_ASSERT_EQUAL_size_t( 1, Mock.num_txns );
+}
+
+void test_Ascii7Seg_Driver_DecimalPoint(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   uint8_t frame[ASCII_7SEG_HT16K33_FRAME_LEN];
+   Digits[1].segments.dp = 1;
+
+   TEST_ASSERT_EQUAL_size_t( 4, Ascii7Seg_Max7219BuildFrame(Digits, 2, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_HEX8( Max7219Digits[0], frame[1] );
+   TEST_ASSERT_EQUAL_HEX8( 0x80 | Max7219Digits[1], frame[3] );
+
+   TEST_ASSERT_EQUAL_size_t( 5, Ascii7Seg_Tm1637BuildFrame(Digits, 2, 0, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_HEX8( LsbFirstDigits[0], frame[2] );
+   TEST_ASSERT_EQUAL_HEX8( 0x80 | LsbFirstDigits[1], frame[3] );
+
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_HT16K33_FRAME_LEN, Ascii7Seg_Ht16k33BuildFrame(Digits, 2, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_HEX8( LsbFirstDigits[0], frame[1] );
+   TEST_ASSERT_EQUAL_HEX8( 0x80 | LsbFirstDigits[1], frame[3] );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_Driver_InvalidArgs(void)
+{
+   uint8_t frame[64];
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Max7219BuildFrame(NULL, 4, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Max7219BuildFrame(Digits, 4, NULL, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Max7219BuildFrame(Digits, 0, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Max7219BuildFrame(Digits, ASCII_7SEG_MAX7219_MAX_DIGITS + 1, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Max7219BuildFrame(Digits, 4, frame, 7) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Max7219Init(&Transport, 4, ASCII_7SEG_MAX7219_MAX_BRIGHTNESS + 1) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Max7219Init(&Transport, 0, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Max7219Init(NULL, 4, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Max7219WriteFrame(&Transport, Digits, 0) );
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Tm1637BuildFrame(Digits, ASCII_7SEG_TM1637_MAX_DIGITS + 1, 0, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Tm1637BuildFrame(Digits, 4, ASCII_7SEG_TM1637_MAX_BRIGHTNESS + 1, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Tm1637BuildFrame(Digits, 4, 0, frame, ASCII_7SEG_TM1637_FRAME_LEN(4) - 1) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Tm1637WriteFrame(NULL, Digits, 4, 0) );
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Ht16k33BuildFrame(Digits, ASCII_7SEG_HT16K33_MAX_DIGITS + 1, frame, sizeof(frame)) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_Ht16k33BuildFrame(Digits, 4, frame, ASCII_7SEG_HT16K33_FRAME_LEN - 1) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Ht16k33Init(&Transport, ASCII_7SEG_HT16K33_MAX_BRIGHTNESS + 1) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Ht16k33WriteFrame(&Transport, NULL, 4) );
+
+   TEST_ASSERT_FALSE( Ascii7Seg_MockTransportInit(NULL, Log, LOG_CAP, TxnLens, TXN_CAP, &Transport) );
+   TEST_ASSERT_FALSE( Ascii7Seg_MockTransportInit(&Mock, Log, LOG_CAP, TxnLens, TXN_CAP, NULL) );
+
+   // Nothing was sent along the way
+   TEST_ASSERT_EQUAL_size_t( 0, Mock.num_txns );
+}
+
+void test_Ascii7Seg_Driver_TransportFailure(void)
+{
+   Mock.fail = true;
+   TEST_ASSERT_FALSE( Ascii7Seg_Max7219WriteFrame(&Transport, Digits, 4) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Tm1637WriteFrame(&Transport, Digits, 4, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_Ht16k33WriteFrame(&Transport, Digits, 4) );
+   TEST_ASSERT_EQUAL_size_t( 0, Mock.num_txns );
+
+   // Running out of log stops a frame partway through
+   Mock.fail = false;
+   Mock.txn_cap = 3;
+   TEST_ASSERT_FALSE( Ascii7Seg_Max7219WriteFrame(&Transport, Digits, 4) );
+   TEST_ASSERT_EQUAL_size_t( 3, Mock.num_txns );
+   TEST_ASSERT_EQUAL_size_t( 6, Mock.log_len );
+}
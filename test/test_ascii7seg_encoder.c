@@ -0,0 +1,329 @@
+/*!
+ * @file    test_ascii7seg_encoder.c
+ * @brief   Test file for the runtime-selectable encoders.
+ *
+ * Every build has the kernel of its configured range and strategy, which must
+ * behave exactly like the core API. Built with ASCII_7SEG_RUNTIME_DISPATCH, the
+ * other five are checked against the reference table and against each other.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_encoder.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+
+/* Local Variables */
+
+extern const union Ascii7Seg_Encoding_U AsciiEncodingReferenceLookup[ UINT8_MAX ];
+
+static struct Ascii7Seg_Encoder_S Encoder;
+
+// What each range supports. Whatever the reference says the full range
+// kernels support is checked against the core API in test_ascii7seg.c
+static const char * const RangeChars[ASCII_7SEG_NUM_OF_RANGES] =
+{
+   [ASCII_7SEG_RANGE_NUMS_ONLY] = "0123456789",
+   [ASCII_7SEG_RANGE_NUMS_AND_ERROR_ONLY] = "0123456789EeRrOo",
+   [ASCII_7SEG_RANGE_FULL] = NULL
+};
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_EncoderInit_InvalidArgs(void);
+void test_Ascii7Seg_Encoder_NotSetUp(void);
+void test_Ascii7Seg_Encoder_ConfiguredMatchesCoreApi(void);
+void test_Ascii7Seg_Encoder_OtherKernels(void);
+void test_Ascii7Seg_Encoder_KernelsMatchReference(void);
+void test_Ascii7Seg_EncoderConvertBytes_StopsOnUnsupported(void);
+void test_Ascii7Seg_EncoderConvertWordEx_FoldsDp(void);
+void test_Ascii7Seg_Encoder_SeveralAtOnce(void);
+
+bool helper_IsInRange(enum Ascii7Seg_Range_E range, char c);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_EncoderInit_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_Encoder_NotSetUp);
+   RUN_TEST(test_Ascii7Seg_Encoder_ConfiguredMatchesCoreApi);
+   RUN_TEST(test_Ascii7Seg_Encoder_OtherKernels);
+   RUN_TEST(test_Ascii7Seg_Encoder_KernelsMatchReference);
+   RUN_TEST(test_Ascii7Seg_EncoderConvertBytes_StopsOnUnsupported);
+   RUN_TEST(test_Ascii7Seg_EncoderConvertWordEx_FoldsDp);
+   RUN_TEST(test_Ascii7Seg_Encoder_SeveralAtOnce);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   (void)memset( &Encoder, 0, sizeof(Encoder) );
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+bool helper_IsInRange(enum Ascii7Seg_Range_E range, char c)
+{
+   if ( (range >= ASCII_7SEG_NUM_OF_RANGES) || (NULL == RangeChars[range]) )
+   {
+      return true;
+   }
+
+   for ( const char * supported = RangeChars[range]; '\0' != *supported; supported++ )
+   {
+      if ( *supported == c )
+      {
+         return true;
+      }
+   }
+
+   return false;
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_EncoderInit_InvalidArgs(void)
+{
+   TEST_ASSERT_FALSE( Ascii7Seg_EncoderInit(NULL, ASCII_7SEG_CONFIGURED_RANGE, ASCII_7SEG_CONFIGURED_STRATEGY) );
+   TEST_ASSERT_FALSE( Ascii7Seg_EncoderInit(&Encoder, ASCII_7SEG_NUM_OF_RANGES, ASCII_7SEG_CONFIGURED_STRATEGY) );
+   TEST_ASSERT_FALSE( Ascii7Seg_EncoderInit(&Encoder, ASCII_7SEG_CONFIGURED_RANGE, ASCII_7SEG_NUM_OF_STRATEGIES) );
+   TEST_ASSERT_NULL( Encoder.kernel );
+
+   TEST_ASSERT_TRUE( Ascii7Seg_EncoderInit(&Encoder, ASCII_7SEG_CONFIGURED_RANGE, ASCII_7SEG_CONFIGURED_STRATEGY) );
+   TEST_ASSERT_NOT_NULL( Encoder.kernel );
+   TEST_ASSERT_EQUAL_INT( ASCII_7SEG_CONFIGURED_RANGE, Encoder.range );
+   TEST_ASSERT_EQUAL_INT( ASCII_7SEG_CONFIGURED_STRATEGY, Encoder.strategy );
+
+   // The arguments of the kernel itself are still checked
+   union Ascii7Seg_Encoding_U buf[2];
+   TEST_ASSERT_FALSE( Ascii7Seg_EncoderConvertChar(&Encoder, '0', NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncoderConvertWord(&Encoder, NULL, 1, buf) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncoderConvertWord(&Encoder, "0", 1, NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncoderConvertBytes(&Encoder, NULL, 1, buf, 2).converted );
+}
+
+void test_Ascii7Seg_Encoder_NotSetUp(void)
+{
+   union Ascii7Seg_Encoding_U buf[2];
+
+   // Neither NULL nor a zeroed encoder that was never set up convert anything
+   const struct Ascii7Seg_Encoder_S * encoders[] = { NULL, &Encoder };
+   for ( size_t i = 0; i < (sizeof(encoders) / sizeof(encoders[0])); i++ )
+   {
+      TEST_ASSERT_FALSE( Ascii7Seg_EncoderConvertChar(encoders[i], '0', buf) );
+      TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncoderConvertWord(encoders[i], "01", 2, buf) );
+      TEST_ASSERT_FALSE( Ascii7Seg_EncoderIsSupportedChar(encoders[i], '0') );
+
+      const struct Ascii7Seg_Result_S result = Ascii7Seg_EncoderConvertBytes( encoders[i], "01", 2, buf, 2 );
+      TEST_ASSERT_EQUAL_size_t( 0, result.converted );
+      TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx );
+
+#ifdef ASCII_7SEG_HAS_DP
+      const struct Ascii7Seg_WordResult_S word = Ascii7Seg_EncoderConvertWordEx( encoders[i], "0.", 2, buf, 2,
+                                                                                 ASCII_7SEG_WORD_FOLD_DP );
+      TEST_ASSERT_EQUAL_size_t( 0, word.consumed );
+      TEST_ASSERT_EQUAL_size_t( 0, word.produced );
+#endif
+   }
+}
+
+void test_Ascii7Seg_Encoder_ConfiguredMatchesCoreApi(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_EncoderInit(&Encoder, ASCII_7SEG_CONFIGURED_RANGE, ASCII_7SEG_CONFIGURED_STRATEGY) );
+
+   char err_msg[32];
+   for ( int c = 1; c <= CHAR_MAX; c++ )
+   {
+      union Ascii7Seg_Encoding_U expected;
+      union Ascii7Seg_Encoding_U actual;
+      (void)memset( &expected, 0, sizeof(expected) );
+      (void)memset( &actual, 0, sizeof(actual) );
+
+      (void)snprintf( err_msg, sizeof(err_msg), "char %d", c );
+      TEST_ASSERT_EQUAL_MESSAGE( Ascii7Seg_IsSupportedChar((char)c),
+                                 Ascii7Seg_EncoderIsSupportedChar(&Encoder, (char)c), err_msg );
+      TEST_ASSERT_EQUAL_MESSAGE( Ascii7Seg_ConvertChar((char)c, &expected),
+                                 Ascii7Seg_EncoderConvertChar(&Encoder, (char)c, &actual), err_msg );
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE( &expected, &actual, sizeof(expected), err_msg );
+   }
+
+   const char digits[] = "0123456789012345678901234567890123456789";
+   union Ascii7Seg_Encoding_U expected[sizeof(digits)];
+   union Ascii7Seg_Encoding_U actual[sizeof(digits)];
+   (void)memset( expected, 0, sizeof(expected) );
+   (void)memset( actual, 0, sizeof(actual) );
+   TEST_ASSERT_EQUAL_size_t( Ascii7Seg_ConvertWord(digits, sizeof(digits) - 1, expected),
+                             Ascii7Seg_EncoderConvertWord(&Encoder, digits, sizeof(digits) - 1, actual) );
+   TEST_ASSERT_EQUAL_MEMORY( expected, actual, sizeof(expected) );
+}
+
+void test_Ascii7Seg_Encoder_OtherKernels(void)
+{
+   for ( int r = 0; r < (int)ASCII_7SEG_NUM_OF_RANGES; r++ )
+   {
+      for ( int s = 0; s < (int)ASCII_7SEG_NUM_OF_STRATEGIES; s++ )
+      {
+         const bool configured = (ASCII_7SEG_CONFIGURED_RANGE == r) && (ASCII_7SEG_CONFIGURED_STRATEGY == s);
+         const bool ok = Ascii7Seg_EncoderInit( &Encoder, (enum Ascii7Seg_Range_E)r, (enum Ascii7Seg_Strategy_E)s );
+#ifdef ASCII_7SEG_RUNTIME_DISPATCH
+         (void)configured;
+         TEST_ASSERT_TRUE( ok );
+#else
+         TEST_ASSERT_EQUAL( configured, ok );
+#endif
+      }
+   }
+}
+
+void test_Ascii7Seg_Encoder_KernelsMatchReference(void)
+{
+#ifdef ASCII_7SEG_RUNTIME_DISPATCH
+   struct Ascii7Seg_Encoder_S lut;
+   struct Ascii7Seg_Encoder_S computed;
+   char err_msg[48];
+
+   for ( int r = 0; r < (int)ASCII_7SEG_NUM_OF_RANGES; r++ )
+   {
+      const enum Ascii7Seg_Range_E range = (enum Ascii7Seg_Range_E)r;
+      TEST_ASSERT_TRUE( Ascii7Seg_EncoderInit(&lut, range, ASCII_7SEG_STRATEGY_LOOKUP_TABLE) );
+      TEST_ASSERT_TRUE( Ascii7Seg_EncoderInit(&computed, range, ASCII_7SEG_STRATEGY_COMPUTED) );
+
+      for ( int c = 1; c <= CHAR_MAX; c++ )
+      {
+         union Ascii7Seg_Encoding_U from_lut;
+         union Ascii7Seg_Encoding_U from_computed;
+         (void)memset( &from_lut, 0, sizeof(from_lut) );
+         (void)memset( &from_computed, 0, sizeof(from_computed) );
+
+         (void)snprintf( err_msg, sizeof(err_msg), "range %d, char %d", r, c );
+         const bool supported = Ascii7Seg_EncoderIsSupportedChar( &lut, (char)c );
+         TEST_ASSERT_EQUAL_MESSAGE( supported, Ascii7Seg_EncoderIsSupportedChar(&computed, (char)c), err_msg );
+         if ( !helper_IsInRange(range, (char)c) )
+         {
+            TEST_ASSERT_FALSE_MESSAGE( supported, err_msg );
+         }
+
+         TEST_ASSERT_EQUAL_MESSAGE( supported, Ascii7Seg_EncoderConvertChar(&lut, (char)c, &from_lut), err_msg );
+         TEST_ASSERT_EQUAL_MESSAGE( supported, Ascii7Seg_EncoderConvertChar(&computed, (char)c, &from_computed), err_msg );
+         if ( supported )
+         {
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE( &AsciiEncodingReferenceLookup[c], &from_lut, sizeof(from_lut), err_msg );
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE( &AsciiEncodingReferenceLookup[c], &from_computed, sizeof(from_computed), err_msg );
+         }
+      }
+
+      // Every range has the digits
+      for ( char c = '0'; c <= '9'; c++ )
+      {
+         TEST_ASSERT_TRUE( Ascii7Seg_EncoderIsSupportedChar(&lut, c) );
+      }
+   }
+#else
+   TEST_IGNORE_MESSAGE("Only applies to builds with ASCII_7SEG_RUNTIME_DISPATCH");
+#endif
+}
+
+void test_Ascii7Seg_EncoderConvertBytes_StopsOnUnsupported(void)
+{
+   // '#' is outside of every range
+   const char src[] = "0123456789012345678901234567890123#56789";
+   union Ascii7Seg_Encoding_U buf[sizeof(src)];
+
+   for ( int r = 0; r < (int)ASCII_7SEG_NUM_OF_RANGES; r++ )
+   {
+      for ( int s = 0; s < (int)ASCII_7SEG_NUM_OF_STRATEGIES; s++ )
+      {
+         if ( !Ascii7Seg_EncoderInit(&Encoder, (enum Ascii7Seg_Range_E)r, (enum Ascii7Seg_Strategy_E)s) )
+         {
+            continue;
+         }
+
+         const struct Ascii7Seg_Result_S result = Ascii7Seg_EncoderConvertBytes( &Encoder, src, sizeof(src) - 1,
+                                                                                buf, sizeof(src) - 1 );
+         TEST_ASSERT_EQUAL_size_t( 34, result.converted );
+         TEST_ASSERT_EQUAL_size_t( 34, result.invalid_idx );
+         TEST_ASSERT_EQUAL_CHAR( '#', result.invalid_char );
+         TEST_ASSERT_EQUAL_size_t( 34, Ascii7Seg_EncoderConvertWord(&Encoder, src, sizeof(src) - 1, buf) );
+
+         for ( size_t i = 0; i < 34; i++ )
+         {
+            TEST_ASSERT_EQUAL_MEMORY( &AsciiEncodingReferenceLookup[(uint8_t)src[i]], &buf[i], sizeof(buf[i]) );
+         }
+      }
+   }
+}
+
+void test_Ascii7Seg_EncoderConvertWordEx_FoldsDp(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   for ( int r = 0; r < (int)ASCII_7SEG_NUM_OF_RANGES; r++ )
+   {
+      for ( int s = 0; s < (int)ASCII_7SEG_NUM_OF_STRATEGIES; s++ )
+      {
+         if ( !Ascii7Seg_EncoderInit(&Encoder, (enum Ascii7Seg_Range_E)r, (enum Ascii7Seg_Strategy_E)s) )
+         {
+            continue;
+         }
+
+         union Ascii7Seg_Encoding_U buf[4];
+         const struct Ascii7Seg_WordResult_S result =
+            Ascii7Seg_EncoderConvertWordEx( &Encoder, "12.5", 4, buf, 4, ASCII_7SEG_WORD_FOLD_DP );
+         TEST_ASSERT_EQUAL_size_t( 4, result.consumed );
+         TEST_ASSERT_EQUAL_size_t( 3, result.produced );
+
+         union Ascii7Seg_Encoding_U expected = AsciiEncodingReferenceLookup[(uint8_t)'2'];
+         expected.segments.dp = 1;
+         TEST_ASSERT_EQUAL_MEMORY( &AsciiEncodingReferenceLookup[(uint8_t)'1'], &buf[0], sizeof(buf[0]) );
+         TEST_ASSERT_EQUAL_MEMORY( &expected, &buf[1], sizeof(buf[1]) );
+         TEST_ASSERT_EQUAL_MEMORY( &AsciiEncodingReferenceLookup[(uint8_t)'5'], &buf[2], sizeof(buf[2]) );
+      }
+   }
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_Encoder_SeveralAtOnce(void)
+{
+#ifdef ASCII_7SEG_RUNTIME_DISPATCH
+   struct Ascii7Seg_Encoder_S digits;
+   struct Ascii7Seg_Encoder_S error;
+   TEST_ASSERT_TRUE( Ascii7Seg_EncoderInit(&digits, ASCII_7SEG_RANGE_NUMS_ONLY, ASCII_7SEG_STRATEGY_LOOKUP_TABLE) );
+   TEST_ASSERT_TRUE( Ascii7Seg_EncoderInit(&error, ASCII_7SEG_RANGE_NUMS_AND_ERROR_ONLY, ASCII_7SEG_STRATEGY_COMPUTED) );
+
+   union Ascii7Seg_Encoding_U buf[4];
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncoderConvertWord(&digits, "Err", 3, buf) );
+   TEST_ASSERT_EQUAL_size_t( 3, Ascii7Seg_EncoderConvertWord(&error, "Err", 3, buf) );
+   TEST_ASSERT_EQUAL_size_t( 2, Ascii7Seg_EncoderConvertWord(&digits, "42", 2, buf) );
+   TEST_ASSERT_EQUAL_MEMORY( &AsciiEncodingReferenceLookup[(uint8_t)'4'], &buf[0], sizeof(buf[0]) );
+#else
+   TEST_IGNORE_MESSAGE("Only applies to builds with ASCII_7SEG_RUNTIME_DISPATCH");
+#endif
+}
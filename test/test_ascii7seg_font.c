@@ -0,0 +1,319 @@
+/*!
+ * @file    test_ascii7seg_font.c
+ * @brief   Test file for the width-generic segment engine and its fonts.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_font.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+// 14-segment bits
+#define SEG14_A   (1u << 0)
+#define SEG14_B   (1u << 1)
+#define SEG14_C   (1u << 2)
+#define SEG14_D   (1u << 3)
+#define SEG14_E   (1u << 4)
+#define SEG14_F   (1u << 5)
+#define SEG14_G1  (1u << 6)
+#define SEG14_G2  (1u << 7)
+#define SEG14_K   (1u << 10)
+#define SEG14_N   (1u << 13)
+
+// 16-segment bits
+#define SEG16_A1  (1u << 0)
+#define SEG16_A2  (1u << 1)
+#define SEG16_D1  (1u << 4)
+#define SEG16_D2  (1u << 5)
+
+/* Datatypes */
+
+/* Local Variables */
+
+static const struct Ascii7Seg_Font_S * const Fonts[] =
+{
+   &Ascii7Seg_Font7Seg, &Ascii7Seg_Font14Seg, &Ascii7Seg_Font16Seg
+};
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_Font_InvalidArgs(void);
+void test_Ascii7Seg_Font_Widths(void);
+void test_Ascii7Seg_Font7Seg_MatchesCore(void);
+void test_Ascii7Seg_Font7Seg_LongInputs(void);
+void test_Ascii7Seg_Font14Seg_Glyphs(void);
+void test_Ascii7Seg_Font16Seg_SplitsAAndD(void);
+void test_Ascii7Seg_Font_LowercaseLikeUppercase(void);
+void test_Ascii7Seg_FontConvertChar_Unsupported(void);
+void test_Ascii7Seg_FontConvertWord_Stops(void);
+void test_Ascii7Seg_FontConvertBytes_InvalidAndCapacity(void);
+
+uint16_t helper_Pack(const union Ascii7Seg_Encoding_U * encoding);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_Font_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_Font_Widths);
+   RUN_TEST(test_Ascii7Seg_Font7Seg_MatchesCore);
+   RUN_TEST(test_Ascii7Seg_Font7Seg_LongInputs);
+   RUN_TEST(test_Ascii7Seg_Font14Seg_Glyphs);
+   RUN_TEST(test_Ascii7Seg_Font16Seg_SplitsAAndD);
+   RUN_TEST(test_Ascii7Seg_Font_LowercaseLikeUppercase);
+   RUN_TEST(test_Ascii7Seg_FontConvertChar_Unsupported);
+   RUN_TEST(test_Ascii7Seg_FontConvertWord_Stops);
+   RUN_TEST(test_Ascii7Seg_FontConvertBytes_InvalidAndCapacity);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   // Do nothing
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+// Segments a to g into bits 0 to 6, whatever the layout of the encoding
+uint16_t helper_Pack(const union Ascii7Seg_Encoding_U * encoding)
+{
+   return (uint16_t)( ((unsigned int)encoding->segments.a << 0) |
+                      ((unsigned int)encoding->segments.b << 1) |
+                      ((unsigned int)encoding->segments.c << 2) |
+                      ((unsigned int)encoding->segments.d << 3) |
+                      ((unsigned int)encoding->segments.e << 4) |
+                      ((unsigned int)encoding->segments.f << 5) |
+                      ((unsigned int)encoding->segments.g << 6) );
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_Font_InvalidArgs(void)
+{
+   uint16_t cell = 0;
+   TEST_ASSERT_FALSE( Ascii7Seg_FontConvertChar(NULL, '0', &cell) );
+   TEST_ASSERT_FALSE( Ascii7Seg_FontConvertChar(&Ascii7Seg_Font14Seg, '0', NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FontConvertWord(NULL, "0", 1, &cell) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FontConvertWord(&Ascii7Seg_Font14Seg, NULL, 1, &cell) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FontConvertWord(&Ascii7Seg_Font14Seg, "0", 1, NULL) );
+   TEST_ASSERT_FALSE( Ascii7Seg_FontIsSupportedChar(NULL, '0') );
+
+   struct Ascii7Seg_Result_S result = Ascii7Seg_FontConvertBytes( NULL, "0", 1, &cell, 1 );
+   TEST_ASSERT_EQUAL_size_t( 0, result.converted );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx );
+   result = Ascii7Seg_FontConvertBytes( &Ascii7Seg_Font14Seg, NULL, 1, &cell, 1 );
+   TEST_ASSERT_EQUAL_size_t( 0, result.converted );
+   result = Ascii7Seg_FontConvertBytes( &Ascii7Seg_Font14Seg, "0", 1, NULL, 1 );
+   TEST_ASSERT_EQUAL_size_t( 0, result.converted );
+}
+
+void test_Ascii7Seg_Font_Widths(void)
+{
+   TEST_ASSERT_EQUAL_UINT8( 7, Ascii7Seg_Font7Seg.num_segments );
+   TEST_ASSERT_EQUAL_UINT8( 14, Ascii7Seg_Font14Seg.num_segments );
+   TEST_ASSERT_EQUAL_UINT8( 16, Ascii7Seg_Font16Seg.num_segments );
+   TEST_ASSERT_EQUAL_HEX16( 1u << 7, Ascii7Seg_Font7Seg.dp_mask );
+   TEST_ASSERT_EQUAL_HEX16( 1u << 14, Ascii7Seg_Font14Seg.dp_mask );
+   TEST_ASSERT_EQUAL_HEX16( 0, Ascii7Seg_Font16Seg.dp_mask );
+
+   // No glyph lights a segment the font doesn't have, or its decimal point
+   for ( size_t f = 0; f < (sizeof(Fonts) / sizeof(Fonts[0])); f++ )
+   {
+      const unsigned int segments = (1u << Fonts[f]->num_segments) - 1u;
+      for ( unsigned int c = 0; c < ASCII_7SEG_FONT_NUM_CHARS; c++ )
+      {
+         uint16_t cell = 0;
+         (void)Ascii7Seg_FontConvertChar( Fonts[f], (char)c, &cell );
+         TEST_ASSERT_EQUAL_HEX16( 0, cell & ~segments );
+      }
+   }
+}
+
+void test_Ascii7Seg_Font7Seg_MatchesCore(void)
+{
+   // Same encodings and range variant as Ascii7Seg_ConvertChar()
+   for ( unsigned int c = 1; c < ASCII_7SEG_FONT_NUM_CHARS; c++ )
+   {
+      uint16_t cell = 0xFFFF;
+      union Ascii7Seg_Encoding_U encoding = { 0 };
+      const bool supported = Ascii7Seg_ConvertChar( (char)c, &encoding );
+      TEST_ASSERT_EQUAL( supported, Ascii7Seg_FontConvertChar(&Ascii7Seg_Font7Seg, (char)c, &cell) );
+      TEST_ASSERT_EQUAL_HEX16( supported ? helper_Pack(&encoding) : 0u, cell );
+   }
+}
+
+void test_Ascii7Seg_Font7Seg_LongInputs(void)
+{
+   // Long enough to go through the core in several chunks
+   char input[300];
+   uint16_t cells[sizeof(input) + 1];
+   for ( size_t i = 0; i < sizeof(input); i++ )
+   {
+      input[i] = (char)( '0' + (i % 10u) );
+   }
+
+   TEST_ASSERT_EQUAL_size_t( sizeof(input),
+                             Ascii7Seg_FontConvertWord(&Ascii7Seg_Font7Seg, input, sizeof(input), cells) );
+   for ( size_t i = 0; i < sizeof(input); i++ )
+   {
+      uint16_t expected = 0;
+      TEST_ASSERT_TRUE( Ascii7Seg_FontConvertChar(&Ascii7Seg_Font7Seg, input[i], &expected) );
+      TEST_ASSERT_EQUAL_HEX16( expected, cells[i] );
+   }
+
+   // An invalid character in a later chunk, and nothing written past it
+   (void)memset( cells, 0xA5, sizeof(cells) );
+   input[200] = '@';
+   struct Ascii7Seg_Result_S result =
+      Ascii7Seg_FontConvertBytes( &Ascii7Seg_Font7Seg, input, sizeof(input), cells, sizeof(input) );
+   TEST_ASSERT_EQUAL_size_t( 200, result.converted );
+   TEST_ASSERT_EQUAL_size_t( 200, result.invalid_idx );
+   TEST_ASSERT_EQUAL_CHAR( '@', result.invalid_char );
+   TEST_ASSERT_EQUAL_HEX16( 0xA5A5, cells[200] );
+
+   // Capacity in the middle of a chunk
+   (void)memset( cells, 0xA5, sizeof(cells) );
+   result = Ascii7Seg_FontConvertBytes( &Ascii7Seg_Font7Seg, input, sizeof(input), cells, 70 );
+   TEST_ASSERT_EQUAL_size_t( 70, result.converted );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx );
+   TEST_ASSERT_EQUAL_HEX16( 0xA5A5, cells[70] );
+}
+
+void test_Ascii7Seg_Font14Seg_Glyphs(void)
+{
+   uint16_t cell = 0;
+   TEST_ASSERT_TRUE( Ascii7Seg_FontConvertChar(&Ascii7Seg_Font14Seg, '1', &cell) );
+   TEST_ASSERT_EQUAL_HEX16( SEG14_B | SEG14_C | SEG14_K, cell );
+
+   TEST_ASSERT_TRUE( Ascii7Seg_FontConvertChar(&Ascii7Seg_Font14Seg, '0', &cell) );
+   TEST_ASSERT_EQUAL_HEX16( SEG14_A | SEG14_B | SEG14_C | SEG14_D | SEG14_E | SEG14_F |
+                            SEG14_K | SEG14_N, cell );
+
+   TEST_ASSERT_TRUE( Ascii7Seg_FontConvertChar(&Ascii7Seg_Font14Seg, 'A', &cell) );
+   TEST_ASSERT_EQUAL_HEX16( SEG14_A | SEG14_B | SEG14_C | SEG14_E | SEG14_F |
+                            SEG14_G1 | SEG14_G2, cell );
+
+   // Letters that 7 segments can't tell apart from digits can be here
+   uint16_t b = 0;
+   uint16_t eight = 0;
+   TEST_ASSERT_TRUE( Ascii7Seg_FontConvertChar(&Ascii7Seg_Font14Seg, 'B', &b) );
+   TEST_ASSERT_TRUE( Ascii7Seg_FontConvertChar(&Ascii7Seg_Font14Seg, '8', &eight) );
+   TEST_ASSERT_TRUE( b != eight );
+}
+
+void test_Ascii7Seg_Font16Seg_SplitsAAndD(void)
+{
+   for ( unsigned int c = 1; c < ASCII_7SEG_FONT_NUM_CHARS; c++ )
+   {
+      const uint16_t glyph14 = Ascii7Seg_Font14Seg.glyphs[c];
+      const uint16_t glyph16 = Ascii7Seg_Font16Seg.glyphs[c];
+      TEST_ASSERT_EQUAL( 0u != glyph14, 0u != glyph16 );
+
+      // Both halves of A and of D, or neither
+      const bool has_a = ( 0u != (glyph14 & SEG14_A) );
+      const bool has_d = ( 0u != (glyph14 & SEG14_D) );
+      TEST_ASSERT_EQUAL_HEX16( has_a ? (SEG16_A1 | SEG16_A2) : 0u, glyph16 & (SEG16_A1 | SEG16_A2) );
+      TEST_ASSERT_EQUAL_HEX16( has_d ? (SEG16_D1 | SEG16_D2) : 0u, glyph16 & (SEG16_D1 | SEG16_D2) );
+   }
+}
+
+void test_Ascii7Seg_Font_LowercaseLikeUppercase(void)
+{
+   for ( char c = 'a'; c <= 'z'; c++ )
+   {
+      const char upper = (char)( c - 'a' + 'A' );
+      TEST_ASSERT_TRUE( Ascii7Seg_FontIsSupportedChar(&Ascii7Seg_Font14Seg, c) );
+      TEST_ASSERT_TRUE( Ascii7Seg_FontIsSupportedChar(&Ascii7Seg_Font16Seg, c) );
+      TEST_ASSERT_EQUAL_HEX16( Ascii7Seg_Font14Seg.glyphs[(uint8_t)upper], Ascii7Seg_Font14Seg.glyphs[(uint8_t)c] );
+      TEST_ASSERT_EQUAL_HEX16( Ascii7Seg_Font16Seg.glyphs[(uint8_t)upper], Ascii7Seg_Font16Seg.glyphs[(uint8_t)c] );
+   }
+}
+
+void test_Ascii7Seg_FontConvertChar_Unsupported(void)
+{
+   for ( size_t f = 0; f < (sizeof(Fonts) / sizeof(Fonts[0])); f++ )
+   {
+      for ( int c = CHAR_MIN; c <= CHAR_MAX; c++ )
+      {
+         uint16_t cell = 0xFFFF;
+         const bool supported = Ascii7Seg_FontIsSupportedChar( Fonts[f], (char)c );
+         TEST_ASSERT_EQUAL( supported, Ascii7Seg_FontConvertChar(Fonts[f], (char)c, &cell) );
+         TEST_ASSERT_EQUAL( supported, 0u != cell );
+         if ( (c <= 0) || (c >= (int)ASCII_7SEG_FONT_NUM_CHARS) )
+         {
+            TEST_ASSERT_FALSE( supported );
+         }
+      }
+   }
+}
+
+void test_Ascii7Seg_FontConvertWord_Stops(void)
+{
+   uint16_t cells[8] = { 0 };
+
+   // At the null terminator
+   TEST_ASSERT_EQUAL_size_t( 3, Ascii7Seg_FontConvertWord(&Ascii7Seg_Font14Seg, "123", 8, cells) );
+   TEST_ASSERT_EQUAL_HEX16( Ascii7Seg_Font14Seg.glyphs['1'], cells[0] );
+   TEST_ASSERT_EQUAL_HEX16( Ascii7Seg_Font14Seg.glyphs['2'], cells[1] );
+   TEST_ASSERT_EQUAL_HEX16( Ascii7Seg_Font14Seg.glyphs['3'], cells[2] );
+
+   // At str_len
+   (void)memset( cells, 0, sizeof(cells) );
+   TEST_ASSERT_EQUAL_size_t( 2, Ascii7Seg_FontConvertWord(&Ascii7Seg_Font16Seg, "123", 2, cells) );
+   TEST_ASSERT_EQUAL_HEX16( 0, cells[2] );
+
+   // At an unsupported character ('@' has no glyph in any of the fonts)
+   TEST_ASSERT_EQUAL_size_t( 2, Ascii7Seg_FontConvertWord(&Ascii7Seg_Font7Seg, "12@3", 8, cells) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FontConvertWord(&Ascii7Seg_Font14Seg, "@", 8, cells) );
+}
+
+void test_Ascii7Seg_FontConvertBytes_InvalidAndCapacity(void)
+{
+   uint16_t cells[8];
+   (void)memset( cells, 0xA5, sizeof(cells) );
+
+   // Stops at the invalid character, null character included
+   struct Ascii7Seg_Result_S result = Ascii7Seg_FontConvertBytes( &Ascii7Seg_Font14Seg, "12\0" "34", 5, cells, 8 );
+   TEST_ASSERT_EQUAL_size_t( 2, result.converted );
+   TEST_ASSERT_EQUAL_size_t( 2, result.invalid_idx );
+   TEST_ASSERT_EQUAL_CHAR( '\0', result.invalid_char );
+   TEST_ASSERT_EQUAL_HEX16( 0xA5A5, cells[2] );
+
+   result = Ascii7Seg_FontConvertBytes( &Ascii7Seg_Font16Seg, "9@", 2, cells, 8 );
+   TEST_ASSERT_EQUAL_size_t( 1, result.converted );
+   TEST_ASSERT_EQUAL_size_t( 1, result.invalid_idx );
+   TEST_ASSERT_EQUAL_CHAR( '@', result.invalid_char );
+
+   // Stops when the buffer is full, without an invalid character
+   (void)memset( cells, 0xA5, sizeof(cells) );
+   result = Ascii7Seg_FontConvertBytes( &Ascii7Seg_Font14Seg, "123456789", 9, cells, 4 );
+   TEST_ASSERT_EQUAL_size_t( 4, result.converted );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx );
+   TEST_ASSERT_EQUAL_HEX16( Ascii7Seg_Font14Seg.glyphs['4'], cells[3] );
+   TEST_ASSERT_EQUAL_HEX16( 0xA5A5, cells[4] );
+}
@@ -0,0 +1,548 @@
+/*!
+ * @file    test_ascii7seg_format.c
+ * @brief   Test file for the number formatting API.
+ *
+ * Each formatted number is checked against snprintf() of the same value, run
+ * through the reference lookup table (where ' ' is blank). Hex dumps are
+ * checked against printf's "%02X"/"%02x", with the case fixed up per digit.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <float.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_format.h"
+#include "ascii7seg_config.h"
+#include "src/ascii7seg_test.h"
+
+/* Local Macro Definitions */
+#define MAX_WIDTH          24   // Wider than any 64-bit value
+#define NUM_RANDOM_VALUES  20000
+#define MAX_HEX_BYTES      100  // A few AVX2 vectors' worth, plus every tail length
+#define MAX_HEX_KERNELS    3u   // Scalar, SSSE3, AVX2
+
+/* Datatypes */
+
+/* Local Variables */
+
+// Full ASCII Encoding Lookup Table
+extern const union Ascii7Seg_Encoding_U AsciiEncodingReferenceLookup[ UINT8_MAX ];
+
+static uint64_t RandomState = UINT64_C(0x9E3779B97F4A7C15);
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_ConvertU32_PowersOf10AndNeighbors(void);
+void test_Ascii7Seg_ConvertU32_RandomValues(void);
+void test_Ascii7Seg_ConvertU32_ZeroPad(void);
+void test_Ascii7Seg_ConvertI32_Negative(void);
+void test_Ascii7Seg_ConvertU64_PowersOf10AndNeighbors(void);
+void test_Ascii7Seg_ConvertU64_RandomValues(void);
+void test_Ascii7Seg_Convert_TooNarrow(void);
+void test_Ascii7Seg_Convert_NullBuf(void);
+void test_Ascii7Seg_ConvertFixed_MatchesPrintf(void);
+void test_Ascii7Seg_ConvertFixed_TooNarrow(void);
+void test_Ascii7Seg_ConvertFloat_MatchesPrintf(void);
+void test_Ascii7Seg_ConvertFloat_RoundsTiesToEven(void);
+void test_Ascii7Seg_ConvertFloat_NotFinite(void);
+void test_Ascii7Seg_ConvertHex_MatchesPrintf(void);
+void test_Ascii7Seg_ConvertHex_BufCapCutsShort(void);
+void test_Ascii7Seg_ConvertHex_BadArgs(void);
+
+uint64_t helper_Random(void);
+void helper_CheckFormatted(const char * expected, const union Ascii7Seg_Encoding_U * buf, size_t width);
+void helper_CheckU32(uint32_t value, size_t width, unsigned int flags);
+void helper_CheckI32(int32_t value, size_t width, unsigned int flags);
+void helper_CheckU64(uint64_t value, size_t width, unsigned int flags);
+#ifdef ASCII_7SEG_HAS_DP
+void helper_CheckWithDP(const char * expected, const union Ascii7Seg_Encoding_U * buf, size_t width);
+void helper_CheckFixed(int32_t value, unsigned int frac_digits, size_t width, unsigned int flags);
+void helper_CheckFloat(float value, unsigned int frac_digits, size_t width, unsigned int flags);
+#endif
+void helper_CheckHex(const uint8_t * bytes, size_t num_bytes, unsigned int flags);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_ConvertU32_PowersOf10AndNeighbors);
+   RUN_TEST(test_Ascii7Seg_ConvertU32_RandomValues);
+   RUN_TEST(test_Ascii7Seg_ConvertU32_ZeroPad);
+   RUN_TEST(test_Ascii7Seg_ConvertI32_Negative);
+   RUN_TEST(test_Ascii7Seg_ConvertU64_PowersOf10AndNeighbors);
+   RUN_TEST(test_Ascii7Seg_ConvertU64_RandomValues);
+   RUN_TEST(test_Ascii7Seg_Convert_TooNarrow);
+   RUN_TEST(test_Ascii7Seg_Convert_NullBuf);
+   RUN_TEST(test_Ascii7Seg_ConvertFixed_MatchesPrintf);
+   RUN_TEST(test_Ascii7Seg_ConvertFixed_TooNarrow);
+   RUN_TEST(test_Ascii7Seg_ConvertFloat_MatchesPrintf);
+   RUN_TEST(test_Ascii7Seg_ConvertFloat_RoundsTiesToEven);
+   RUN_TEST(test_Ascii7Seg_ConvertFloat_NotFinite);
+   RUN_TEST(test_Ascii7Seg_ConvertHex_MatchesPrintf);
+   RUN_TEST(test_Ascii7Seg_ConvertHex_BufCapCutsShort);
+   RUN_TEST(test_Ascii7Seg_ConvertHex_BadArgs);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   // Do nothing
+}
+
+void tearDown(void)
+{
+   // Back to the hex kernel selected at load time, even if a check failed midway
+   (void)Ascii7Seg_TestForceHexKernel(SIZE_MAX);
+}
+
+/********************************** Helpers ***********************************/
+
+// xorshift64, so that the "random" values are the same on every run
+uint64_t helper_Random(void)
+{
+   RandomState ^= RandomState << 13;
+   RandomState ^= RandomState >> 7;
+   RandomState ^= RandomState << 17;
+   return RandomState;
+}
+
+void helper_CheckFormatted(const char * expected, const union Ascii7Seg_Encoding_U * buf, size_t width)
+{
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( width, strlen(expected), expected );
+   for ( size_t i = 0; i < width; i++ )
+   {
+      const union Ascii7Seg_Encoding_U * ref = &AsciiEncodingReferenceLookup[(uint8_t)expected[i]];
+#ifdef ASCII_7SEG_BIT_PACK
+      TEST_ASSERT_EQUAL_HEX8_MESSAGE( ref->encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                      buf[i].encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                      expected );
+#else
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE( ref, &buf[i], sizeof(*ref), expected );
+#endif
+   }
+}
+
+void helper_CheckU32(uint32_t value, size_t width, unsigned int flags)
+{
+   char expected[MAX_WIDTH + 1];
+   union Ascii7Seg_Encoding_U buf[MAX_WIDTH];
+   const bool zero_pad = ( 0u != (flags & ASCII_7SEG_FMT_ZERO_PAD) );
+   (void)snprintf( expected, sizeof(expected), zero_pad ? "%0*" PRIu32 : "%*" PRIu32, (int)width, value );
+
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( width, Ascii7Seg_ConvertU32(value, buf, width, flags), expected );
+   helper_CheckFormatted( expected, buf, width );
+}
+
+void helper_CheckI32(int32_t value, size_t width, unsigned int flags)
+{
+   char expected[MAX_WIDTH + 1];
+   union Ascii7Seg_Encoding_U buf[MAX_WIDTH];
+   const bool zero_pad = ( 0u != (flags & ASCII_7SEG_FMT_ZERO_PAD) );
+   (void)snprintf( expected, sizeof(expected), zero_pad ? "%0*" PRId32 : "%*" PRId32, (int)width, value );
+
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( width, Ascii7Seg_ConvertI32(value, buf, width, flags), expected );
+   helper_CheckFormatted( expected, buf, width );
+}
+
+void helper_CheckU64(uint64_t value, size_t width, unsigned int flags)
+{
+   char expected[MAX_WIDTH + 1];
+   union Ascii7Seg_Encoding_U buf[MAX_WIDTH];
+   const bool zero_pad = ( 0u != (flags & ASCII_7SEG_FMT_ZERO_PAD) );
+   (void)snprintf( expected, sizeof(expected), zero_pad ? "%0*" PRIu64 : "%*" PRIu64, (int)width, value );
+
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( width, Ascii7Seg_ConvertU64(value, buf, width, flags), expected );
+   helper_CheckFormatted( expected, buf, width );
+}
+
+void helper_CheckHex(const uint8_t * bytes, size_t num_bytes, unsigned int flags)
+{
+   char expected[(2 * MAX_HEX_BYTES) + 1] = { '\0' };
+   union Ascii7Seg_Encoding_U buf[2 * MAX_HEX_BYTES];
+   const bool lower = ( 0u != (flags & ASCII_7SEG_FMT_HEX_LOWER) );
+   const bool reverse = ( 0u != (flags & ASCII_7SEG_FMT_HEX_REVERSE) );
+
+   for ( size_t k = 0; k < num_bytes; k++ )
+   {
+      const uint8_t byte = reverse ? bytes[num_bytes - 1 - k] : bytes[k];
+      (void)snprintf( &expected[2 * k], 3, lower ? "%02x" : "%02X", (unsigned int)byte );
+   }
+
+   if ( 0u == (flags & (ASCII_7SEG_FMT_HEX_UPPER | ASCII_7SEG_FMT_HEX_LOWER)) )
+   {
+      // A b C d E F
+      for ( char * c = expected; *c != '\0'; c++ )
+      {
+         if ( (*c == 'B') || (*c == 'D') )
+         {
+            *c = (char)(*c - 'A' + 'a');
+         }
+      }
+   }
+
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( 2 * num_bytes,
+                                     Ascii7Seg_ConvertHex(bytes, num_bytes, buf, 2 * MAX_HEX_BYTES, flags),
+                                     expected );
+   helper_CheckFormatted( expected, buf, 2 * num_bytes );
+}
+
+#ifdef ASCII_7SEG_HAS_DP
+
+// Like helper_CheckFormatted(), where each '.' is the decimal point of the digit before it
+void helper_CheckWithDP(const char * expected, const union Ascii7Seg_Encoding_U * buf, size_t width)
+{
+   union Ascii7Seg_Encoding_U cells[MAX_WIDTH];
+   size_t num_cells = 0;
+   for ( const char * c = expected; *c != '\0'; c++ )
+   {
+      if ( *c == '.' )
+      {
+         TEST_ASSERT_TRUE_MESSAGE( num_cells > 0, expected );
+         cells[num_cells - 1].segments.dp = 1;
+      }
+      else
+      {
+         TEST_ASSERT_TRUE_MESSAGE( num_cells < MAX_WIDTH, expected );
+         cells[num_cells] = AsciiEncodingReferenceLookup[(uint8_t)*c];
+         num_cells++;
+      }
+   }
+
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( width, num_cells, expected );
+   for ( size_t i = 0; i < width; i++ )
+   {
+#ifdef ASCII_7SEG_BIT_PACK
+      TEST_ASSERT_EQUAL_HEX8_MESSAGE( cells[i].encoding_as_val, buf[i].encoding_as_val, expected );
+#else
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE( &cells[i], &buf[i], sizeof(cells[i]), expected );
+#endif
+   }
+}
+
+void helper_CheckFixed(int32_t value, unsigned int frac_digits, size_t width, unsigned int flags)
+{
+   static const double PowersOf10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+   char expected[MAX_WIDTH + 2];
+   union Ascii7Seg_Encoding_U buf[MAX_WIDTH];
+   const bool zero_pad = ( 0u != (flags & ASCII_7SEG_FMT_ZERO_PAD) );
+   const int text_width = (int)width + ( (frac_digits > 0) ? 1 : 0 );   // The '.' takes no digit
+   (void)snprintf( expected, sizeof(expected), zero_pad ? "%0*.*f" : "%*.*f",
+                   text_width, (int)frac_digits, (double)value / PowersOf10[frac_digits] );
+
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( width, Ascii7Seg_ConvertFixed(value, frac_digits, buf, width, flags), expected );
+   helper_CheckWithDP( expected, buf, width );
+}
+
+void helper_CheckFloat(float value, unsigned int frac_digits, size_t width, unsigned int flags)
+{
+   char expected[64];
+   union Ascii7Seg_Encoding_U buf[MAX_WIDTH];
+   const bool zero_pad = ( 0u != (flags & ASCII_7SEG_FMT_ZERO_PAD) );
+   const int text_width = (int)width + ( (frac_digits > 0) ? 1 : 0 );
+   (void)snprintf( expected, sizeof(expected), zero_pad ? "%0*.*f" : "%*.*f",
+                   text_width, (int)frac_digits, (double)value );
+
+   // printf keeps the sign of a negative value that rounds to 0, which the library doesn't
+   if ( strpbrk(expected, "123456789") == NULL )
+   {
+      (void)snprintf( expected, sizeof(expected), zero_pad ? "%0*.*f" : "%*.*f",
+                      text_width, (int)frac_digits, 0.0 );
+   }
+
+   size_t result = Ascii7Seg_ConvertFloat( value, frac_digits, buf, width, flags );
+   if ( strlen(expected) > (size_t)text_width )
+   {
+      TEST_ASSERT_EQUAL_size_t_MESSAGE( 0, result, expected );  // Doesn't fit
+   }
+   else
+   {
+      TEST_ASSERT_EQUAL_size_t_MESSAGE( width, result, expected );
+      helper_CheckWithDP( expected, buf, width );
+   }
+}
+
+#endif // ASCII_7SEG_HAS_DP
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_ConvertU32_PowersOf10AndNeighbors(void)
+{
+   helper_CheckU32( 0, 1, ASCII_7SEG_FMT_NONE );
+   helper_CheckU32( UINT32_MAX, 10, ASCII_7SEG_FMT_NONE );
+
+   for ( uint64_t power = 10; power <= UINT32_MAX; power *= 10 )
+   {
+      for ( uint64_t value = power - 2; value <= power + 1; value++ )
+      {
+         helper_CheckU32( (uint32_t)value, 10, ASCII_7SEG_FMT_NONE );
+      }
+   }
+}
+
+void test_Ascii7Seg_ConvertU32_RandomValues(void)
+{
+   for ( size_t i = 0; i < NUM_RANDOM_VALUES; i++ )
+   {
+      // Shift by a random amount so that every number of digits comes up
+      uint64_t r = helper_Random();
+      uint32_t value = (uint32_t)r >> (r >> 59);
+      helper_CheckU32( value, 12, ASCII_7SEG_FMT_NONE );
+   }
+}
+
+void test_Ascii7Seg_ConvertU32_ZeroPad(void)
+{
+   helper_CheckU32( 0, 4, ASCII_7SEG_FMT_ZERO_PAD );
+   helper_CheckU32( 7, 4, ASCII_7SEG_FMT_ZERO_PAD );
+   helper_CheckU32( 1234, 4, ASCII_7SEG_FMT_ZERO_PAD );
+   helper_CheckU32( 56789, 8, ASCII_7SEG_FMT_ZERO_PAD );
+}
+
+void test_Ascii7Seg_ConvertI32_Negative(void)
+{
+   static const int32_t Values[] = { 0, -1, 1, -9, -10, -99, -100, 12345, -12345, INT32_MAX, INT32_MIN, INT32_MIN + 1 };
+
+   for ( size_t i = 0; i < sizeof(Values) / sizeof(Values[0]); i++ )
+   {
+      helper_CheckI32( Values[i], 11, ASCII_7SEG_FMT_NONE );
+      helper_CheckI32( Values[i], 11, ASCII_7SEG_FMT_ZERO_PAD );
+      helper_CheckI32( Values[i], 14, ASCII_7SEG_FMT_ZERO_PAD );
+   }
+
+   // The minus sign needs its own digit
+   union Ascii7Seg_Encoding_U buf[4];
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertI32(-1234, buf, 4, ASCII_7SEG_FMT_NONE) );
+   helper_CheckI32( -123, 4, ASCII_7SEG_FMT_NONE );
+   helper_CheckI32( -12, 4, ASCII_7SEG_FMT_ZERO_PAD );
+}
+
+void test_Ascii7Seg_ConvertU64_PowersOf10AndNeighbors(void)
+{
+   helper_CheckU64( 0, 1, ASCII_7SEG_FMT_NONE );
+   helper_CheckU64( UINT64_MAX, 20, ASCII_7SEG_FMT_NONE );
+   helper_CheckU64( UINT64_MAX - 1, 20, ASCII_7SEG_FMT_NONE );
+   helper_CheckU64( (uint64_t)UINT32_MAX + 1, 20, ASCII_7SEG_FMT_NONE );
+   helper_CheckU64( UINT32_MAX, 20, ASCII_7SEG_FMT_NONE );
+
+   for ( uint64_t power = 10; power <= UINT64_MAX / 10; power *= 10 )
+   {
+      for ( uint64_t value = power - 2; value <= power + 1; value++ )
+      {
+         helper_CheckU64( value, 20, ASCII_7SEG_FMT_NONE );
+      }
+   }
+}
+
+void test_Ascii7Seg_ConvertU64_RandomValues(void)
+{
+   for ( size_t i = 0; i < NUM_RANDOM_VALUES; i++ )
+   {
+      uint64_t r = helper_Random();
+      uint64_t value = helper_Random() >> (r >> 58);
+      helper_CheckU64( value, 21, ASCII_7SEG_FMT_NONE );
+      helper_CheckU64( value, 20, ASCII_7SEG_FMT_ZERO_PAD );
+   }
+}
+
+// A value that doesn't fit leaves buf alone
+void test_Ascii7Seg_Convert_TooNarrow(void)
+{
+   union Ascii7Seg_Encoding_U buf[MAX_WIDTH];
+   union Ascii7Seg_Encoding_U untouched[MAX_WIDTH];
+   (void)memset( buf, 0xA5, sizeof(buf) );
+   (void)memcpy( untouched, buf, sizeof(buf) );
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertU32(10000, buf, 4, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertU32(0, buf, 0, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertI32(-1, buf, 1, ASCII_7SEG_FMT_ZERO_PAD) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertU64(UINT64_MAX, buf, 19, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_MEMORY( untouched, buf, sizeof(buf) );
+
+   helper_CheckU32( 9999, 4, ASCII_7SEG_FMT_NONE );
+}
+
+void test_Ascii7Seg_Convert_NullBuf(void)
+{
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertU32(1, NULL, 4, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertI32(-1, NULL, 4, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertU64(1, NULL, 4, ASCII_7SEG_FMT_NONE) );
+}
+
+void test_Ascii7Seg_ConvertFixed_MatchesPrintf(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   static const int32_t Values[] = { 0, 5, -5, 125, -125, 1000, 99999, -100000, 123456789, INT32_MAX, INT32_MIN };
+
+   for ( size_t i = 0; i < sizeof(Values) / sizeof(Values[0]); i++ )
+   {
+      for ( unsigned int frac_digits = 0; frac_digits <= ASCII_7SEG_FMT_MAX_FRAC_DIGITS; frac_digits++ )
+      {
+         helper_CheckFixed( Values[i], frac_digits, 12, ASCII_7SEG_FMT_NONE );
+         helper_CheckFixed( Values[i], frac_digits, 13, ASCII_7SEG_FMT_ZERO_PAD );
+      }
+   }
+
+   // e.g. "12.5" takes only 3 digits
+   helper_CheckFixed( 125, 1, 3, ASCII_7SEG_FMT_NONE );
+   helper_CheckFixed( -5, 2, 4, ASCII_7SEG_FMT_NONE );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertFixed_TooNarrow(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   union Ascii7Seg_Encoding_U buf[MAX_WIDTH];
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFixed(5, 2, buf, 2, ASCII_7SEG_FMT_NONE) );     // "0.05"
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFixed(-125, 1, buf, 3, ASCII_7SEG_FMT_NONE) );  // "-12.5"
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFixed(1, ASCII_7SEG_FMT_MAX_FRAC_DIGITS + 1, buf, MAX_WIDTH, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFixed(1, 1, NULL, MAX_WIDTH, ASCII_7SEG_FMT_NONE) );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertFloat_MatchesPrintf(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   for ( size_t i = 0; i < NUM_RANDOM_VALUES; i++ )
+   {
+      // Random sign and mantissa, with exponents from about 2^-40 to 2^40
+      uint64_t r = helper_Random();
+      uint32_t bits = ( (uint32_t)r & UINT32_C(0x807FFFFF) ) | ( (uint32_t)(87u + (r >> 32) % 80u) << 23 );
+      float value;
+      (void)memcpy( &value, &bits, sizeof(value) );
+
+      unsigned int frac_digits = (unsigned int)( (r >> 48) % (ASCII_7SEG_FMT_MAX_FRAC_DIGITS + 1u) );
+      helper_CheckFloat( value, frac_digits, 18, ((r >> 60) & 1u) ? ASCII_7SEG_FMT_ZERO_PAD : ASCII_7SEG_FMT_NONE );
+   }
+
+   helper_CheckFloat( 12.5f, 1, 3, ASCII_7SEG_FMT_NONE );
+   helper_CheckFloat( -0.001f, 2, 4, ASCII_7SEG_FMT_NONE );   // No "-0.00"
+   helper_CheckFloat( 1e-45f, 9, 10, ASCII_7SEG_FMT_NONE );   // Smallest subnormal
+   helper_CheckFloat( 16777216.0f, 0, 8, ASCII_7SEG_FMT_NONE );
+   helper_CheckFloat( 9.9999f, 3, 5, ASCII_7SEG_FMT_NONE );   // Rounds up into another digit
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertFloat_RoundsTiesToEven(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   // All exactly representable, so each is a true tie
+   helper_CheckFloat( 0.5f, 0, 1, ASCII_7SEG_FMT_NONE );    // 0
+   helper_CheckFloat( 1.5f, 0, 1, ASCII_7SEG_FMT_NONE );    // 2
+   helper_CheckFloat( 2.5f, 0, 1, ASCII_7SEG_FMT_NONE );    // 2
+   helper_CheckFloat( 0.125f, 2, 3, ASCII_7SEG_FMT_NONE );  // 0.12
+   helper_CheckFloat( 0.375f, 2, 3, ASCII_7SEG_FMT_NONE );  // 0.38
+   helper_CheckFloat( -2.5f, 0, 2, ASCII_7SEG_FMT_NONE );   // -2
+
+   // Not a tie once the float is exact: 2.675f is 2.67499995...
+   helper_CheckFloat( 2.675f, 2, 3, ASCII_7SEG_FMT_NONE );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertFloat_NotFinite(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   union Ascii7Seg_Encoding_U buf[MAX_WIDTH];
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFloat(INFINITY, 1, buf, MAX_WIDTH, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFloat(-INFINITY, 1, buf, MAX_WIDTH, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFloat(NAN, 1, buf, MAX_WIDTH, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFloat(FLT_MAX, 0, buf, MAX_WIDTH, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertFloat(1.0f, ASCII_7SEG_FMT_MAX_FRAC_DIGITS + 1, buf, MAX_WIDTH, ASCII_7SEG_FMT_NONE) );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_ConvertHex_MatchesPrintf(void)
+{
+   static const unsigned int Cases[] =
+   {
+      ASCII_7SEG_FMT_NONE, ASCII_7SEG_FMT_HEX_UPPER, ASCII_7SEG_FMT_HEX_LOWER
+   };
+
+   // A few spare bytes in front, so that the dumps don't all start aligned
+   uint8_t bytes[MAX_HEX_BYTES + 8];
+   for ( size_t i = 0; i < sizeof(bytes); i++ )
+   {
+      bytes[i] = (uint8_t)helper_Random();
+   }
+
+   // Every kernel the CPU can run, over every tail length, forwards and in reverse
+   size_t kernels_run = 0;
+   for ( size_t kernel = 0; kernel < MAX_HEX_KERNELS; kernel++ )
+   {
+      if ( !Ascii7Seg_TestForceHexKernel(kernel) )
+      {
+         continue;
+      }
+      kernels_run++;
+
+      for ( size_t num_bytes = 0; num_bytes <= MAX_HEX_BYTES; num_bytes++ )
+      {
+         for ( size_t c = 0; c < (sizeof(Cases) / sizeof(Cases[0])); c++ )
+         {
+            helper_CheckHex( &bytes[num_bytes % 8], num_bytes, Cases[c] );
+            helper_CheckHex( &bytes[num_bytes % 8], num_bytes, Cases[c] | ASCII_7SEG_FMT_HEX_REVERSE );
+         }
+      }
+   }
+   TEST_ASSERT_TRUE_MESSAGE( kernels_run > 0, "The scalar kernel should always be available" );
+}
+
+void test_Ascii7Seg_ConvertHex_BufCapCutsShort(void)
+{
+   const uint8_t bytes[] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF };
+   union Ascii7Seg_Encoding_U buf[16];
+   union Ascii7Seg_Encoding_U untouched;
+   (void)memset( buf, 0xA5, sizeof(buf) );
+   (void)memset( &untouched, 0xA5, sizeof(untouched) );
+
+   // Only whole bytes are dumped, so 7 encodings hold 3 of them
+   TEST_ASSERT_EQUAL_size_t( 6, Ascii7Seg_ConvertHex(bytes, sizeof(bytes), buf, 7, ASCII_7SEG_FMT_NONE) );
+   helper_CheckFormatted( "012345", buf, 6 );
+   for ( size_t i = 6; i < 16; i++ )
+   {
+      TEST_ASSERT_EQUAL_MEMORY( &untouched, &buf[i], sizeof(untouched) );
+   }
+
+   // In reverse, the bytes that fit are the last ones
+   TEST_ASSERT_EQUAL_size_t( 4, Ascii7Seg_ConvertHex(bytes, sizeof(bytes), buf, 4, ASCII_7SEG_FMT_HEX_REVERSE) );
+   helper_CheckFormatted( "2301", buf, 4 );
+}
+
+void test_Ascii7Seg_ConvertHex_BadArgs(void)
+{
+   const uint8_t bytes[] = { 0xAB };
+   union Ascii7Seg_Encoding_U buf[2];
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertHex(NULL, sizeof(bytes), buf, 2, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertHex(bytes, sizeof(bytes), NULL, 2, ASCII_7SEG_FMT_NONE) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertHex(bytes, sizeof(bytes), buf, 2,
+                                                     ASCII_7SEG_FMT_HEX_UPPER | ASCII_7SEG_FMT_HEX_LOWER) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertHex(bytes, 0, buf, 2, ASCII_7SEG_FMT_NONE) );
+}
@@ -0,0 +1,343 @@
+/*!
+ * @file    test_ascii7seg_framebuffer.c
+ * @brief   Test file for the dirty-tracking framebuffer API.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_framebuffer.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+#define NUM_DIGITS         40   // Several bit-packed words, plus a partial one
+#define MAX_RANGES         NUM_DIGITS
+#define NUM_RANDOM_FRAMES  2000
+
+/* Datatypes */
+
+/* Local Variables */
+
+static union Ascii7Seg_Encoding_U Shadow[NUM_DIGITS];
+static union Ascii7Seg_Encoding_U Frame[NUM_DIGITS];
+static struct Ascii7Seg_DirtyRange_S Ranges[MAX_RANGES];
+static struct Ascii7Seg_Framebuffer_S Fb;
+
+static uint16_t CellShadow[NUM_DIGITS];
+static uint16_t CellFrame[NUM_DIGITS];
+static struct Ascii7Seg_CellFramebuffer_S CellFb;
+
+static uint64_t RandomState = UINT64_C(0x2545F4914F6CDD1D);
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_FramebufferInit_InvalidArgs(void);
+void test_Ascii7Seg_FramebufferUpdate_FirstUpdateSendsAll(void);
+void test_Ascii7Seg_FramebufferUpdate_NothingChanged(void);
+void test_Ascii7Seg_FramebufferUpdate_AdjacentDigitsMerge(void);
+void test_Ascii7Seg_FramebufferUpdate_MergeGap(void);
+void test_Ascii7Seg_FramebufferUpdate_OutOfRanges(void);
+void test_Ascii7Seg_FramebufferUpdate_DecimalPointOnly(void);
+void test_Ascii7Seg_FramebufferInvalidate_SendsAll(void);
+void test_Ascii7Seg_FramebufferUpdate_RandomFrames(void);
+void test_Ascii7Seg_CellFramebufferInit_InvalidArgs(void);
+void test_Ascii7Seg_CellFramebufferUpdate_RandomFrames(void);
+
+uint64_t helper_Random(void);
+void helper_SetDigit(size_t idx, char digit);
+void helper_FillFrame(const char * digits);
+void helper_CheckRange(size_t r, size_t first, size_t len);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_FramebufferInit_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_FramebufferUpdate_FirstUpdateSendsAll);
+   RUN_TEST(test_Ascii7Seg_FramebufferUpdate_NothingChanged);
+   RUN_TEST(test_Ascii7Seg_FramebufferUpdate_AdjacentDigitsMerge);
+   RUN_TEST(test_Ascii7Seg_FramebufferUpdate_MergeGap);
+   RUN_TEST(test_Ascii7Seg_FramebufferUpdate_OutOfRanges);
+   RUN_TEST(test_Ascii7Seg_FramebufferUpdate_DecimalPointOnly);
+   RUN_TEST(test_Ascii7Seg_FramebufferInvalidate_SendsAll);
+   RUN_TEST(test_Ascii7Seg_FramebufferUpdate_RandomFrames);
+   RUN_TEST(test_Ascii7Seg_CellFramebufferInit_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_CellFramebufferUpdate_RandomFrames);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   (void)memset( Shadow, 0xA5, sizeof(Shadow) );
+   helper_FillFrame( "0000000000000000000000000000000000000000" );
+   (void)memset( CellShadow, 0xA5, sizeof(CellShadow) );
+   (void)memset( CellFrame, 0, sizeof(CellFrame) );
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+// xorshift64, so that the "random" frames are the same on every run
+uint64_t helper_Random(void)
+{
+   RandomState ^= RandomState << 13;
+   RandomState ^= RandomState >> 7;
+   RandomState ^= RandomState << 17;
+   return RandomState;
+}
+
+// Digits only, so that every variant of the library can encode them
+void helper_SetDigit(size_t idx, char digit)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar(digit, &Frame[idx]) );
+}
+
+void helper_FillFrame(const char * digits)
+{
+   TEST_ASSERT_EQUAL_size_t( NUM_DIGITS, strlen(digits) );
+   for ( size_t i = 0; i < NUM_DIGITS; i++ )
+   {
+      helper_SetDigit( i, digits[i] );
+   }
+}
+
+void helper_CheckRange(size_t r, size_t first, size_t len)
+{
+   TEST_ASSERT_EQUAL_size_t( first, Ranges[r].first );
+   TEST_ASSERT_EQUAL_size_t( len, Ranges[r].len );
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_FramebufferInit_InvalidArgs(void)
+{
+   TEST_ASSERT_FALSE( Ascii7Seg_FramebufferInit(NULL, Shadow, NUM_DIGITS, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_FramebufferInit(&Fb, NULL, NUM_DIGITS, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_FramebufferInit(&Fb, Shadow, 0, 0) );
+
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, 0) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FramebufferUpdate(NULL, Frame, Ranges, MAX_RANGES) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FramebufferUpdate(&Fb, NULL, Ranges, MAX_RANGES) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FramebufferUpdate(&Fb, Frame, NULL, MAX_RANGES) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, 0) );
+   Ascii7Seg_FramebufferInvalidate( NULL );
+
+   // None of those counted as an update
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, MAX_RANGES) );
+   helper_CheckRange( 0, 0, NUM_DIGITS );
+}
+
+void test_Ascii7Seg_FramebufferUpdate_FirstUpdateSendsAll(void)
+{
+   // Even though the shadow happens to match the frame already
+   (void)memcpy( Shadow, Frame, sizeof(Shadow) );
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, 0) );
+
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, MAX_RANGES) );
+   helper_CheckRange( 0, 0, NUM_DIGITS );
+   TEST_ASSERT_EQUAL_MEMORY( Frame, Shadow, sizeof(Frame) );
+}
+
+void test_Ascii7Seg_FramebufferUpdate_NothingChanged(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, 0) );
+   (void)Ascii7Seg_FramebufferUpdate( &Fb, Frame, Ranges, MAX_RANGES );
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, MAX_RANGES) );
+}
+
+void test_Ascii7Seg_FramebufferUpdate_AdjacentDigitsMerge(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, 0) );
+   (void)Ascii7Seg_FramebufferUpdate( &Fb, Frame, Ranges, MAX_RANGES );
+
+   // Digits 7 to 10 changed from different values, but still go in one range
+   helper_FillFrame( "1000000122200000000000000000000000000003" );
+   TEST_ASSERT_EQUAL_size_t( 3, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, MAX_RANGES) );
+   helper_CheckRange( 0, 0, 1 );
+   helper_CheckRange( 1, 7, 4 );
+   helper_CheckRange( 2, 39, 1 );
+   TEST_ASSERT_EQUAL_MEMORY( Frame, Shadow, sizeof(Frame) );
+}
+
+void test_Ascii7Seg_FramebufferUpdate_MergeGap(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, 2) );
+   (void)Ascii7Seg_FramebufferUpdate( &Fb, Frame, Ranges, MAX_RANGES );
+
+   // Gaps of 1 and 2 clean digits are merged over, a gap of 3 is not
+   helper_FillFrame( "0110100100010000000000000000000000000000" );
+   TEST_ASSERT_EQUAL_size_t( 2, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, MAX_RANGES) );
+   helper_CheckRange( 0, 1, 7 );
+   helper_CheckRange( 1, 11, 1 );
+}
+
+void test_Ascii7Seg_FramebufferUpdate_OutOfRanges(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, 0) );
+   (void)Ascii7Seg_FramebufferUpdate( &Fb, Frame, Ranges, MAX_RANGES );
+
+   // 4 runs into 2 ranges: the second range stretches over the last 3 runs
+   helper_FillFrame( "0100000000100000000001000000000000000110" );
+   TEST_ASSERT_EQUAL_size_t( 2, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, 2) );
+   helper_CheckRange( 0, 1, 1 );
+   helper_CheckRange( 1, 10, 29 );
+   TEST_ASSERT_EQUAL_MEMORY( Frame, Shadow, sizeof(Frame) );
+}
+
+void test_Ascii7Seg_FramebufferUpdate_DecimalPointOnly(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, 0) );
+   (void)Ascii7Seg_FramebufferUpdate( &Fb, Frame, Ranges, MAX_RANGES );
+
+   Frame[17].segments.dp = 1;
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, MAX_RANGES) );
+   helper_CheckRange( 0, 17, 1 );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_FramebufferInvalidate_SendsAll(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, 0) );
+   (void)Ascii7Seg_FramebufferUpdate( &Fb, Frame, Ranges, MAX_RANGES );
+
+   Ascii7Seg_FramebufferInvalidate( &Fb );
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, MAX_RANGES) );
+   helper_CheckRange( 0, 0, NUM_DIGITS );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_FramebufferUpdate(&Fb, Frame, Ranges, MAX_RANGES) );
+}
+
+// Sending just the ranges of each update must reproduce every frame on a model
+// of the display, with each range starting and ending on a dirty digit and
+// ranges more than merge_gap clean digits apart.
+void test_Ascii7Seg_FramebufferUpdate_RandomFrames(void)
+{
+   static const size_t MergeGap = 2;
+   union Ascii7Seg_Encoding_U display[NUM_DIGITS];
+   union Ascii7Seg_Encoding_U prev[NUM_DIGITS];
+
+   TEST_ASSERT_TRUE( Ascii7Seg_FramebufferInit(&Fb, Shadow, NUM_DIGITS, MergeGap) );
+   (void)Ascii7Seg_FramebufferUpdate( &Fb, Frame, Ranges, MAX_RANGES );
+   (void)memcpy( display, Frame, sizeof(display) );
+
+   for ( size_t f = 0; f < NUM_RANDOM_FRAMES; f++ )
+   {
+      (void)memcpy( prev, Frame, sizeof(prev) );
+
+      // Change a few digits, sometimes none
+      const size_t num_changes = (size_t)(helper_Random() % 6);
+      for ( size_t c = 0; c < num_changes; c++ )
+      {
+         helper_SetDigit( (size_t)(helper_Random() % NUM_DIGITS), (char)('0' + (helper_Random() % 10)) );
+      }
+
+      const size_t num_ranges = Ascii7Seg_FramebufferUpdate( &Fb, Frame, Ranges, MAX_RANGES );
+      for ( size_t r = 0; r < num_ranges; r++ )
+      {
+         const size_t first = Ranges[r].first;
+         const size_t last = first + Ranges[r].len - 1;
+         TEST_ASSERT_TRUE( Ranges[r].len > 0 );
+         TEST_ASSERT_TRUE( last < NUM_DIGITS );
+         TEST_ASSERT_TRUE( 0 != memcmp(&prev[first], &Frame[first], sizeof(Frame[0])) );
+         TEST_ASSERT_TRUE( 0 != memcmp(&prev[last], &Frame[last], sizeof(Frame[0])) );
+         if ( r > 0 )
+         {
+            TEST_ASSERT_TRUE( first > (Ranges[r - 1].first + Ranges[r - 1].len + MergeGap) );
+         }
+         (void)memcpy( &display[first], &Frame[first], Ranges[r].len * sizeof(Frame[0]) );
+      }
+
+      TEST_ASSERT_EQUAL_MEMORY( Frame, display, sizeof(Frame) );
+   }
+}
+
+void test_Ascii7Seg_CellFramebufferInit_InvalidArgs(void)
+{
+   TEST_ASSERT_FALSE( Ascii7Seg_CellFramebufferInit(NULL, CellShadow, NUM_DIGITS, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_CellFramebufferInit(&CellFb, NULL, NUM_DIGITS, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_CellFramebufferInit(&CellFb, CellShadow, 0, 0) );
+
+   TEST_ASSERT_TRUE( Ascii7Seg_CellFramebufferInit(&CellFb, CellShadow, NUM_DIGITS, 0) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_CellFramebufferUpdate(NULL, CellFrame, Ranges, MAX_RANGES) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_CellFramebufferUpdate(&CellFb, NULL, Ranges, MAX_RANGES) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_CellFramebufferUpdate(&CellFb, CellFrame, NULL, MAX_RANGES) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_CellFramebufferUpdate(&CellFb, CellFrame, Ranges, 0) );
+   Ascii7Seg_CellFramebufferInvalidate( NULL );
+
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_CellFramebufferUpdate(&CellFb, CellFrame, Ranges, MAX_RANGES) );
+   helper_CheckRange( 0, 0, NUM_DIGITS );
+   TEST_ASSERT_EQUAL_MEMORY( CellFrame, CellShadow, sizeof(CellFrame) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_CellFramebufferUpdate(&CellFb, CellFrame, Ranges, MAX_RANGES) );
+
+   Ascii7Seg_CellFramebufferInvalidate( &CellFb );
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_CellFramebufferUpdate(&CellFb, CellFrame, Ranges, MAX_RANGES) );
+   helper_CheckRange( 0, 0, NUM_DIGITS );
+}
+
+// Same as test_Ascii7Seg_FramebufferUpdate_RandomFrames(), with changes that
+// are sometimes only in the high byte of a cell (e.g., a diagonal segment of a
+// 14-segment glyph), which the byte-wise comparison alone would miss.
+void test_Ascii7Seg_CellFramebufferUpdate_RandomFrames(void)
+{
+   static const size_t MergeGap = 1;
+   uint16_t display[NUM_DIGITS];
+   uint16_t prev[NUM_DIGITS];
+
+   TEST_ASSERT_TRUE( Ascii7Seg_CellFramebufferInit(&CellFb, CellShadow, NUM_DIGITS, MergeGap) );
+   (void)Ascii7Seg_CellFramebufferUpdate( &CellFb, CellFrame, Ranges, MAX_RANGES );
+   (void)memcpy( display, CellFrame, sizeof(display) );
+
+   for ( size_t f = 0; f < NUM_RANDOM_FRAMES; f++ )
+   {
+      (void)memcpy( prev, CellFrame, sizeof(prev) );
+
+      const size_t num_changes = (size_t)(helper_Random() % 6);
+      for ( size_t c = 0; c < num_changes; c++ )
+      {
+         const size_t idx = (size_t)(helper_Random() % NUM_DIGITS);
+         const uint16_t bit = (uint16_t)( 1u << (helper_Random() % 16) );
+         CellFrame[idx] ^= bit;
+      }
+
+      const size_t num_ranges = Ascii7Seg_CellFramebufferUpdate( &CellFb, CellFrame, Ranges, MAX_RANGES );
+      for ( size_t r = 0; r < num_ranges; r++ )
+      {
+         const size_t first = Ranges[r].first;
+         const size_t last = first + Ranges[r].len - 1;
+         TEST_ASSERT_TRUE( Ranges[r].len > 0 );
+         TEST_ASSERT_TRUE( last < NUM_DIGITS );
+         TEST_ASSERT_TRUE( prev[first] != CellFrame[first] );
+         TEST_ASSERT_TRUE( prev[last] != CellFrame[last] );
+         if ( r > 0 )
+         {
+            TEST_ASSERT_TRUE( first > (Ranges[r - 1].first + Ranges[r - 1].len + MergeGap) );
+         }
+         (void)memcpy( &display[first], &CellFrame[first], Ranges[r].len * sizeof(CellFrame[0]) );
+      }
+
+      TEST_ASSERT_EQUAL_MEMORY( CellFrame, display, sizeof(CellFrame) );
+   }
+}
@@ -0,0 +1,205 @@
+/*!
+ * @file    test_ascii7seg_hpp.cpp
+ * @brief   Test file for the constexpr C++ interface in ascii7seg.hpp.
+ *
+ * Most of the checks are static_asserts, since the point of the interface is
+ * that it runs at compile time. The runtime tests compare it against the C
+ * library, which is linked in as usual.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg.hpp"
+#include "ascii7seg_config.h"
+
+using namespace ascii7seg::literals;
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+
+/* Local Variables */
+
+// Characters supported by the variant of the library under test
+#ifdef ASCII_7SEG_NUMS_ONLY
+static constexpr char VariantSupportedChars[] = "0123456789";
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+static constexpr char VariantSupportedChars[] = "0123456789EeRrOo";
+#else
+static constexpr char VariantSupportedChars[] = "0123456789[]()_-|=><abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+#endif
+
+/****************************** Compile-Time Checks *****************************/
+
+static_assert( ascii7seg::IsSupportedChar('0'), "All variants support '0'" );
+static_assert( !ascii7seg::IsSupportedChar('\0'), "The null terminator is never supported" );
+static_assert( !ascii7seg::IsSupportedChar('#'), "No variant supports '#'" );
+static_assert( !ascii7seg::IsSupportedChar(static_cast<char>(0x80)), "No variant supports non-ASCII" );
+
+static constexpr auto & Zero = "0"_7seg;
+static_assert( Zero.size() == 1, "One encoding per character, no terminator" );
+static_assert( Zero[0].segments.a && Zero[0].segments.f && !Zero[0].segments.g,
+               "'0' is every segment but the middle one" );
+
+static constexpr auto & Digits = "0123456789"_7seg;
+static_assert( Digits.size() == 10, "One encoding per character, no terminator" );
+static_assert( Digits[8].segments.g && !Digits[1].segments.a, "'8' has g on, '1' has a off" );
+
+// constexpr ConvertWord() stops where the C one does
+constexpr std::size_t ConvertedAtCompileTime( const char * str, std::size_t len )
+{
+   union Ascii7Seg_Encoding_U buf[16] = {};
+   return ascii7seg::ConvertWord( str, len, buf );
+}
+static_assert( ConvertedAtCompileTime("12#34", 5) == 2, "Stops at an unsupported character" );
+static_assert( ConvertedAtCompileTime("12\0" "34", 5) == 2, "Stops at the null terminator" );
+static_assert( ConvertedAtCompileTime("1234", 3) == 3, "Stops at str_len" );
+static_assert( ConvertedAtCompileTime(nullptr, 3) == 0, "NULL str" );
+
+/* Forward Function Declarations */
+
+extern "C" void setUp(void);
+extern "C" void tearDown(void);
+
+void test_Ascii7SegHpp_ConvertChar_MatchesC(void);
+void test_Ascii7SegHpp_IsSupportedChar_MatchesC(void);
+void test_Ascii7SegHpp_ConvertWord_MatchesC(void);
+void test_Ascii7SegHpp_Literal_MatchesC(void);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7SegHpp_ConvertChar_MatchesC);
+   RUN_TEST(test_Ascii7SegHpp_IsSupportedChar_MatchesC);
+   RUN_TEST(test_Ascii7SegHpp_ConvertWord_MatchesC);
+   RUN_TEST(test_Ascii7SegHpp_Literal_MatchesC);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   // Do nothing
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7SegHpp_ConvertChar_MatchesC(void)
+{
+   for ( int c = CHAR_MIN; c <= CHAR_MAX; c++ )
+   {
+      char err_msg[20];
+      (void)std::snprintf( err_msg, sizeof(err_msg), "char %d", c );
+
+      union Ascii7Seg_Encoding_U expected;
+      union Ascii7Seg_Encoding_U actual;
+      std::memset( &expected, 0, sizeof(expected) );
+      std::memset( &actual, 0, sizeof(actual) );
+
+      const bool expected_ok = Ascii7Seg_ConvertChar( static_cast<char>(c), &expected );
+      const bool actual_ok = ascii7seg::ConvertChar( static_cast<char>(c), &actual );
+      TEST_ASSERT_EQUAL_MESSAGE( expected_ok, actual_ok, err_msg );
+      if ( expected_ok )
+      {
+#ifdef ASCII_7SEG_BIT_PACK
+         TEST_ASSERT_EQUAL_UINT8_MESSAGE( expected.encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                          actual.encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                          err_msg );
+#else
+         TEST_ASSERT_EQUAL_MEMORY_MESSAGE( &expected, &actual, sizeof(expected), err_msg );
+#endif
+      }
+   }
+
+   TEST_ASSERT_FALSE( ascii7seg::ConvertChar('0', nullptr) );
+}
+
+void test_Ascii7SegHpp_IsSupportedChar_MatchesC(void)
+{
+   for ( int c = CHAR_MIN; c <= CHAR_MAX; c++ )
+   {
+      char err_msg[20];
+      (void)std::snprintf( err_msg, sizeof(err_msg), "char %d", c );
+      TEST_ASSERT_EQUAL_MESSAGE( Ascii7Seg_IsSupportedChar(static_cast<char>(c)),
+                                 ascii7seg::IsSupportedChar(static_cast<char>(c)),
+                                 err_msg );
+   }
+}
+
+void test_Ascii7SegHpp_ConvertWord_MatchesC(void)
+{
+   static const char * const Words[] = { "0123", "12#34", "", "9876543210", "1 2" };
+
+   for ( const char * word : Words )
+   {
+      union Ascii7Seg_Encoding_U expected[16];
+      union Ascii7Seg_Encoding_U actual[16];
+      std::memset( expected, 0, sizeof(expected) );
+      std::memset( actual, 0, sizeof(actual) );
+
+      const std::size_t len = std::strlen( word ) + 1;
+      const std::size_t expected_n = Ascii7Seg_ConvertWord( word, len, expected );
+      const std::size_t actual_n = ascii7seg::ConvertWord( word, len, actual );
+      TEST_ASSERT_EQUAL_size_t_MESSAGE( expected_n, actual_n, word );
+      for ( std::size_t i = 0; i < expected_n; i++ )
+      {
+#ifdef ASCII_7SEG_BIT_PACK
+         TEST_ASSERT_EQUAL_UINT8_MESSAGE( expected[i].encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                          actual[i].encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                          word );
+#else
+         TEST_ASSERT_EQUAL_MEMORY_MESSAGE( &expected[i], &actual[i], sizeof(expected[i]), word );
+#endif
+      }
+   }
+}
+
+void test_Ascii7SegHpp_Literal_MatchesC(void)
+{
+   const auto & literal = "0123456789"_7seg;
+   TEST_ASSERT_EQUAL_size_t( 10, literal.size() );
+
+   for ( std::size_t i = 0; i < literal.size(); i++ )
+   {
+      union Ascii7Seg_Encoding_U expected;
+      std::memset( &expected, 0, sizeof(expected) );
+      TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar(static_cast<char>('0' + i), &expected) );
+#ifdef ASCII_7SEG_BIT_PACK
+      TEST_ASSERT_EQUAL_UINT8( expected.encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                               literal[i].encoding_as_val & ASCII_7SEG_BIT_PACK_MASK );
+#else
+      TEST_ASSERT_EQUAL_MEMORY( &expected, &literal[i], sizeof(expected) );
+#endif
+   }
+
+   // Every character this variant supports can go in a literal
+#if !defined(ASCII_7SEG_NUMS_ONLY) && !defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+   const auto & all = "0123456789[]()_-|=><abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ"_7seg;
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+   const auto & all = "0123456789EeRrOo"_7seg;
+#else
+   const auto & all = "0123456789"_7seg;
+#endif
+   TEST_ASSERT_EQUAL_size_t( sizeof(VariantSupportedChars) - 1, all.size() );
+}
@@ -0,0 +1,283 @@
+/*!
+ * @file    test_ascii7seg_marquee.c
+ * @brief   Test file for the scrolling marquee API.
+ *
+ * Each frame is checked against the substring of the padded message that it
+ * should show, run through the reference lookup table (where ' ' is blank).
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_marquee.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+#define RING_CAP     32
+#define MAX_WIDTH    8
+
+/* Datatypes */
+
+/* Local Variables */
+
+// Full ASCII Encoding Lookup Table
+extern const union Ascii7Seg_Encoding_U AsciiEncodingReferenceLookup[ UINT8_MAX ];
+
+// Digits only, so that the message is supported by every variant of the library
+static const char Message[] = "0123456789";
+#define MESSAGE_LEN  ( sizeof(Message) - 1 )
+
+static union Ascii7Seg_Encoding_U Ring[RING_CAP];
+static struct Ascii7Seg_Marquee_S Marquee;
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_MarqueeInit_InvalidArgs(void);
+void test_Ascii7Seg_MarqueeInit_RingTooSmall(void);
+void test_Ascii7Seg_Marquee_LoopScrollsThroughBlanks(void);
+void test_Ascii7Seg_Marquee_LoopStepLandsOnStart(void);
+void test_Ascii7Seg_Marquee_PausesAtEnds(void);
+void test_Ascii7Seg_Marquee_Bounce(void);
+void test_Ascii7Seg_Marquee_BounceShortMessageStaysPut(void);
+void test_Ascii7Seg_Marquee_FramesPointIntoRing(void);
+void test_Ascii7Seg_Marquee_UnsupportedCharsAreBlank(void);
+
+void helper_Init(size_t width, enum Ascii7Seg_MarqueeMode_E mode, size_t step, size_t pause_frames);
+void helper_CheckFrame(const char * expected);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_MarqueeInit_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_MarqueeInit_RingTooSmall);
+   RUN_TEST(test_Ascii7Seg_Marquee_LoopScrollsThroughBlanks);
+   RUN_TEST(test_Ascii7Seg_Marquee_LoopStepLandsOnStart);
+   RUN_TEST(test_Ascii7Seg_Marquee_PausesAtEnds);
+   RUN_TEST(test_Ascii7Seg_Marquee_Bounce);
+   RUN_TEST(test_Ascii7Seg_Marquee_BounceShortMessageStaysPut);
+   RUN_TEST(test_Ascii7Seg_Marquee_FramesPointIntoRing);
+   RUN_TEST(test_Ascii7Seg_Marquee_UnsupportedCharsAreBlank);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   (void)memset( Ring, 0xA5, sizeof(Ring) );
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+void helper_Init(size_t width, enum Ascii7Seg_MarqueeMode_E mode, size_t step, size_t pause_frames)
+{
+   const struct Ascii7Seg_MarqueeConfig_S cfg =
+      { .width = width, .mode = mode, .step = step, .pause_frames = pause_frames };
+   TEST_ASSERT_TRUE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, Ring, RING_CAP, Message, MESSAGE_LEN) );
+}
+
+// Checks the current frame against expected, one character per digit
+void helper_CheckFrame(const char * expected)
+{
+   const struct Ascii7Seg_MarqueeFrame_S frame = Ascii7Seg_MarqueeFrame( &Marquee );
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( strlen(expected), frame.head_len + frame.wrap_len, expected );
+   TEST_ASSERT_TRUE_MESSAGE( (frame.wrap_len > 0) == (frame.wrap != NULL), expected );
+
+   for ( size_t i = 0; expected[i] != '\0'; i++ )
+   {
+      const union Ascii7Seg_Encoding_U * ref = &AsciiEncodingReferenceLookup[(uint8_t)expected[i]];
+      const union Ascii7Seg_Encoding_U * actual = (i < frame.head_len) ? &frame.head[i] :
+                                                                         &frame.wrap[i - frame.head_len];
+#ifdef ASCII_7SEG_BIT_PACK
+      TEST_ASSERT_EQUAL_HEX8_MESSAGE( ref->encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                      actual->encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                      expected );
+#else
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE( ref, actual, sizeof(*ref), expected );
+#endif
+   }
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_MarqueeInit_InvalidArgs(void)
+{
+   struct Ascii7Seg_MarqueeConfig_S cfg =
+      { .width = 4, .mode = ASCII_7SEG_MARQUEE_LOOP, .step = 1, .pause_frames = 0 };
+
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(NULL, &cfg, Ring, RING_CAP, Message, MESSAGE_LEN) );
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(&Marquee, NULL, Ring, RING_CAP, Message, MESSAGE_LEN) );
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, NULL, RING_CAP, Message, MESSAGE_LEN) );
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, Ring, RING_CAP, NULL, MESSAGE_LEN) );
+
+   cfg.width = 0;
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, Ring, RING_CAP, Message, MESSAGE_LEN) );
+   cfg.width = 4;
+   cfg.step = 0;
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, Ring, RING_CAP, Message, MESSAGE_LEN) );
+   cfg.step = 1;
+   cfg.mode = ASCII_7SEG_MARQUEE_NUM_OF_MODES;
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, Ring, RING_CAP, Message, MESSAGE_LEN) );
+
+   // An empty message is fine, and just shows blanks
+   cfg.mode = ASCII_7SEG_MARQUEE_LOOP;
+   TEST_ASSERT_TRUE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, Ring, RING_CAP, NULL, 0) );
+   helper_CheckFrame("    ");
+   Ascii7Seg_MarqueeAdvance( &Marquee );
+   helper_CheckFrame("    ");
+
+   // NULL marquees are ignored
+   Ascii7Seg_MarqueeAdvance( NULL );
+   Ascii7Seg_MarqueeRestart( NULL );
+   const struct Ascii7Seg_MarqueeFrame_S frame = Ascii7Seg_MarqueeFrame( NULL );
+   TEST_ASSERT_NULL( frame.head );
+   TEST_ASSERT_EQUAL_size_t( 0, frame.head_len + frame.wrap_len );
+}
+
+void test_Ascii7Seg_MarqueeInit_RingTooSmall(void)
+{
+   const struct Ascii7Seg_MarqueeConfig_S loop =
+      { .width = 4, .mode = ASCII_7SEG_MARQUEE_LOOP, .step = 1, .pause_frames = 0 };
+   const struct Ascii7Seg_MarqueeConfig_S bounce =
+      { .width = 4, .mode = ASCII_7SEG_MARQUEE_BOUNCE, .step = 1, .pause_frames = 0 };
+
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(&Marquee, &loop, Ring, MESSAGE_LEN + 3, Message, MESSAGE_LEN) );
+   TEST_ASSERT_TRUE( Ascii7Seg_MarqueeInit(&Marquee, &loop, Ring, MESSAGE_LEN + 4, Message, MESSAGE_LEN) );
+   TEST_ASSERT_FALSE( Ascii7Seg_MarqueeInit(&Marquee, &bounce, Ring, MESSAGE_LEN - 1, Message, MESSAGE_LEN) );
+   TEST_ASSERT_TRUE( Ascii7Seg_MarqueeInit(&Marquee, &bounce, Ring, MESSAGE_LEN, Message, MESSAGE_LEN) );
+}
+
+void test_Ascii7Seg_Marquee_LoopScrollsThroughBlanks(void)
+{
+   static const char * const Frames[] =
+   {
+      "0123", "1234", "2345", "3456", "4567", "5678", "6789", "789 ", "89  ", "9   ",
+      "    ", "   0", "  01", " 012",
+      "0123", "1234" // and around again
+   };
+
+   helper_Init( 4, ASCII_7SEG_MARQUEE_LOOP, 1, 0 );
+   for ( size_t i = 0; i < (sizeof(Frames) / sizeof(Frames[0])); i++ )
+   {
+      helper_CheckFrame( Frames[i] );
+      Ascii7Seg_MarqueeAdvance( &Marquee );
+   }
+}
+
+void test_Ascii7Seg_Marquee_LoopStepLandsOnStart(void)
+{
+   // The ring is 14 long, so a step of 4 would go 0, 4, 8, 12, then past the end
+   static const char * const Frames[] = { "0123", "4567", "89  ", "  01", "0123", "4567" };
+
+   helper_Init( 4, ASCII_7SEG_MARQUEE_LOOP, 4, 0 );
+   for ( size_t i = 0; i < (sizeof(Frames) / sizeof(Frames[0])); i++ )
+   {
+      helper_CheckFrame( Frames[i] );
+      Ascii7Seg_MarqueeAdvance( &Marquee );
+   }
+}
+
+void test_Ascii7Seg_Marquee_PausesAtEnds(void)
+{
+   static const char * const Frames[] =
+   {
+      "012345", "012345", "012345", // held for 2 extra frames
+      "234567", "456789",
+      "456789", "456789",           // and at the other end
+      "234567", "012345",
+      "012345", "012345",
+      "234567"
+   };
+
+   helper_Init( 6, ASCII_7SEG_MARQUEE_BOUNCE, 2, 2 );
+   for ( size_t i = 0; i < (sizeof(Frames) / sizeof(Frames[0])); i++ )
+   {
+      helper_CheckFrame( Frames[i] );
+      Ascii7Seg_MarqueeAdvance( &Marquee );
+   }
+
+   // Restarting holds at the start again
+   Ascii7Seg_MarqueeRestart( &Marquee );
+   for ( size_t i = 0; i < 3; i++ )
+   {
+      helper_CheckFrame( Frames[i] );
+      Ascii7Seg_MarqueeAdvance( &Marquee );
+   }
+}
+
+void test_Ascii7Seg_Marquee_Bounce(void)
+{
+   // A step of 4 would overshoot both ends, so it stops at them
+   static const char * const Frames[] =
+   {
+      "01234", "45678", "56789", "12345", "01234", "45678", "56789"
+   };
+
+   helper_Init( 5, ASCII_7SEG_MARQUEE_BOUNCE, 4, 0 );
+   for ( size_t i = 0; i < (sizeof(Frames) / sizeof(Frames[0])); i++ )
+   {
+      helper_CheckFrame( Frames[i] );
+      Ascii7Seg_MarqueeAdvance( &Marquee );
+   }
+}
+
+void test_Ascii7Seg_Marquee_BounceShortMessageStaysPut(void)
+{
+   const struct Ascii7Seg_MarqueeConfig_S cfg =
+      { .width = MAX_WIDTH, .mode = ASCII_7SEG_MARQUEE_BOUNCE, .step = 1, .pause_frames = 0 };
+   TEST_ASSERT_TRUE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, Ring, RING_CAP, "42", 2) );
+
+   for ( size_t i = 0; i < 5; i++ )
+   {
+      helper_CheckFrame( "42      " );
+      Ascii7Seg_MarqueeAdvance( &Marquee );
+   }
+}
+
+void test_Ascii7Seg_Marquee_FramesPointIntoRing(void)
+{
+   helper_Init( 4, ASCII_7SEG_MARQUEE_LOOP, 1, 0 );
+
+   for ( size_t i = 0; i < 12; i++ )
+   {
+      Ascii7Seg_MarqueeAdvance( &Marquee );
+   }
+
+   // Position 12 of a 14-long ring: 2 blanks at its end, then 2 digits from its start
+   const struct Ascii7Seg_MarqueeFrame_S frame = Ascii7Seg_MarqueeFrame( &Marquee );
+   TEST_ASSERT_EQUAL_PTR( &Ring[12], frame.head );
+   TEST_ASSERT_EQUAL_size_t( 2, frame.head_len );
+   TEST_ASSERT_EQUAL_PTR( &Ring[0], frame.wrap );
+   TEST_ASSERT_EQUAL_size_t( 2, frame.wrap_len );
+   helper_CheckFrame( "  01" );
+}
+
+void test_Ascii7Seg_Marquee_UnsupportedCharsAreBlank(void)
+{
+   static const char Text[] = "1#2\0003";
+   const struct Ascii7Seg_MarqueeConfig_S cfg =
+      { .width = 6, .mode = ASCII_7SEG_MARQUEE_BOUNCE, .step = 1, .pause_frames = 0 };
+   TEST_ASSERT_TRUE( Ascii7Seg_MarqueeInit(&Marquee, &cfg, Ring, RING_CAP, Text, sizeof(Text) - 1) );
+
+   helper_CheckFrame( "1 2 3 " );
+}
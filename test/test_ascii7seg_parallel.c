@@ -0,0 +1,277 @@
+/*!
+ * @file    test_ascii7seg_parallel.c
+ * @brief   Test file for the worker pool for very large conversions.
+ *
+ * Every result is compared against Ascii7Seg_ConvertBytes() over the same
+ * input, with the unsupported characters placed in and around the chunk
+ * boundaries, where the merging of the workers' results could go wrong.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_parallel.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+#define CHUNK        ASCII_7SEG_POOL_CHUNK_LEN
+#define INPUT_LEN    ( (8u * CHUNK) + 123u )
+#define NUM_WORKERS  4u
+
+/* Datatypes */
+
+/* Local Variables */
+
+static char Input[INPUT_LEN + 1];
+static union Ascii7Seg_Encoding_U Expected[INPUT_LEN];
+static union Ascii7Seg_Encoding_U Actual[INPUT_LEN];
+
+static struct Ascii7Seg_Pool_S Pool;
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_PoolInit_InvalidArgs(void);
+void test_Ascii7Seg_PoolConvertBytes_AllValid(void);
+void test_Ascii7Seg_PoolConvertBytes_InvalidAroundChunkEdges(void);
+void test_Ascii7Seg_PoolConvertBytes_FirstOfSeveralInvalid(void);
+void test_Ascii7Seg_PoolConvertBytes_CapacityLimits(void);
+void test_Ascii7Seg_PoolConvertBytes_UnalignedOutput(void);
+void test_Ascii7Seg_PoolConvertWord_StopsAtNul(void);
+void test_Ascii7Seg_PoolConvertWord_ShortStringLongLen(void);
+void test_Ascii7Seg_Pool_OneWorker(void);
+void test_Ascii7Seg_Pool_ReusedAcrossCalls(void);
+
+void helper_CheckAgainstSerial(size_t src_len, size_t buf_cap, size_t buf_offset, const char * msg);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_PoolInit_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_PoolConvertBytes_AllValid);
+   RUN_TEST(test_Ascii7Seg_PoolConvertBytes_InvalidAroundChunkEdges);
+   RUN_TEST(test_Ascii7Seg_PoolConvertBytes_FirstOfSeveralInvalid);
+   RUN_TEST(test_Ascii7Seg_PoolConvertBytes_CapacityLimits);
+   RUN_TEST(test_Ascii7Seg_PoolConvertBytes_UnalignedOutput);
+   RUN_TEST(test_Ascii7Seg_PoolConvertWord_StopsAtNul);
+   RUN_TEST(test_Ascii7Seg_PoolConvertWord_ShortStringLongLen);
+   RUN_TEST(test_Ascii7Seg_Pool_OneWorker);
+   RUN_TEST(test_Ascii7Seg_Pool_ReusedAcrossCalls);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   // Digits, so that every range variant supports all of it
+   for ( size_t i = 0; i < INPUT_LEN; i++ )
+   {
+      Input[i] = (char)( '0' + (i % 10u) );
+   }
+   Input[INPUT_LEN] = '\0';
+
+   TEST_ASSERT_TRUE( Ascii7Seg_PoolInit(&Pool, NUM_WORKERS) );
+}
+
+void tearDown(void)
+{
+   Ascii7Seg_PoolDeinit( &Pool );
+}
+
+/********************************** Helpers ***********************************/
+
+void helper_CheckAgainstSerial(size_t src_len, size_t buf_cap, size_t buf_offset, const char * msg)
+{
+   (void)memset( Expected, 0, sizeof(Expected) );
+   (void)memset( Actual, 0, sizeof(Actual) );
+
+   const struct Ascii7Seg_Result_S expected = Ascii7Seg_ConvertBytes( Input, src_len, Expected, buf_cap );
+   const struct Ascii7Seg_Result_S actual = Ascii7Seg_PoolConvertBytes( &Pool, Input, src_len,
+                                                                        &Actual[buf_offset], buf_cap );
+
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( expected.converted, actual.converted, msg );
+   TEST_ASSERT_EQUAL_size_t_MESSAGE( expected.invalid_idx, actual.invalid_idx, msg );
+   TEST_ASSERT_EQUAL_CHAR_MESSAGE( expected.invalid_char, actual.invalid_char, msg );
+   if ( expected.converted > 0u )
+   {
+      TEST_ASSERT_EQUAL_MEMORY_MESSAGE( Expected, &Actual[buf_offset],
+                                        expected.converted * sizeof(Expected[0]), msg );
+   }
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_PoolInit_InvalidArgs(void)
+{
+   TEST_ASSERT_FALSE( Ascii7Seg_PoolInit(NULL, 2) );
+   Ascii7Seg_PoolDeinit( NULL );
+
+   struct Ascii7Seg_Result_S result = Ascii7Seg_PoolConvertBytes( NULL, Input, INPUT_LEN, Actual, INPUT_LEN );
+   TEST_ASSERT_EQUAL_size_t( 0, result.converted );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx );
+
+   result = Ascii7Seg_PoolConvertBytes( &Pool, NULL, INPUT_LEN, Actual, INPUT_LEN );
+   TEST_ASSERT_EQUAL_size_t( 0, result.converted );
+   result = Ascii7Seg_PoolConvertBytes( &Pool, Input, INPUT_LEN, NULL, INPUT_LEN );
+   TEST_ASSERT_EQUAL_size_t( 0, result.converted );
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_PoolConvertWord(NULL, Input, INPUT_LEN, Actual) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_PoolConvertWord(&Pool, NULL, INPUT_LEN, Actual) );
+
+   // More workers than the pool can have are capped, 0 is one per CPU
+   struct Ascii7Seg_Pool_S pool;
+   TEST_ASSERT_TRUE( Ascii7Seg_PoolInit(&pool, ASCII_7SEG_POOL_MAX_WORKERS + 5u) );
+   TEST_ASSERT_TRUE( pool.num_workers <= ASCII_7SEG_POOL_MAX_WORKERS );
+   Ascii7Seg_PoolDeinit( &pool );
+   TEST_ASSERT_TRUE( Ascii7Seg_PoolInit(&pool, 0) );
+   TEST_ASSERT_TRUE( pool.num_workers >= 1u );
+   Ascii7Seg_PoolDeinit( &pool );
+   Ascii7Seg_PoolDeinit( &pool );   // Twice is harmless
+}
+
+void test_Ascii7Seg_PoolConvertBytes_AllValid(void)
+{
+   helper_CheckAgainstSerial( INPUT_LEN, INPUT_LEN, 0, NULL );
+
+   const struct Ascii7Seg_Result_S result = Ascii7Seg_PoolConvertBytes( &Pool, Input, INPUT_LEN, Actual, INPUT_LEN );
+   TEST_ASSERT_EQUAL_size_t( INPUT_LEN, result.converted );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_NO_INVALID_IDX, result.invalid_idx );
+}
+
+void test_Ascii7Seg_PoolConvertBytes_InvalidAroundChunkEdges(void)
+{
+   // '#' is outside of every range
+   const size_t positions[] =
+   {
+      0, 1, 63, 64, 65, CHUNK - 1u, CHUNK, CHUNK + 1u, (3u * CHUNK) - 1u, 3u * CHUNK,
+      (3u * CHUNK) + 64u, 5u * CHUNK, (7u * CHUNK) + 7u, INPUT_LEN - 1u
+   };
+
+   char err_msg[32];
+   for ( size_t p = 0; p < (sizeof(positions) / sizeof(positions[0])); p++ )
+   {
+      const char digit = Input[positions[p]];
+      Input[positions[p]] = '#';
+      (void)snprintf( err_msg, sizeof(err_msg), "'#' at %zu", positions[p] );
+      helper_CheckAgainstSerial( INPUT_LEN, INPUT_LEN, 0, err_msg );
+      Input[positions[p]] = digit;
+   }
+}
+
+void test_Ascii7Seg_PoolConvertBytes_FirstOfSeveralInvalid(void)
+{
+   // The later ones are in chunks that may well be converted first
+   Input[INPUT_LEN - 10u] = '#';
+   Input[6u * CHUNK] = '#';
+   Input[(2u * CHUNK) + 100u] = '#';
+   Input[(4u * CHUNK) + 1u] = '#';
+
+   helper_CheckAgainstSerial( INPUT_LEN, INPUT_LEN, 0, NULL );
+
+   const struct Ascii7Seg_Result_S result = Ascii7Seg_PoolConvertBytes( &Pool, Input, INPUT_LEN, Actual, INPUT_LEN );
+   TEST_ASSERT_EQUAL_size_t( (2u * CHUNK) + 100u, result.converted );
+   TEST_ASSERT_EQUAL_size_t( (2u * CHUNK) + 100u, result.invalid_idx );
+   TEST_ASSERT_EQUAL_CHAR( '#', result.invalid_char );
+}
+
+void test_Ascii7Seg_PoolConvertBytes_CapacityLimits(void)
+{
+   // Capped by the buffer, with an unsupported character just past the cap
+   Input[5u * CHUNK] = '#';
+   helper_CheckAgainstSerial( INPUT_LEN, 5u * CHUNK, 0, NULL );
+   helper_CheckAgainstSerial( INPUT_LEN, (5u * CHUNK) + 1u, 0, NULL );
+
+   // Capped by the source
+   helper_CheckAgainstSerial( 3u * CHUNK, INPUT_LEN, 0, NULL );
+
+   // Short enough to be converted without the workers
+   helper_CheckAgainstSerial( CHUNK, INPUT_LEN, 0, NULL );
+   helper_CheckAgainstSerial( 0, INPUT_LEN, 0, NULL );
+}
+
+void test_Ascii7Seg_PoolConvertBytes_UnalignedOutput(void)
+{
+   // Wherever the output starts within a cache line, the chunks have to cover it exactly
+   Input[(3u * CHUNK) + 2u] = '#';
+   for ( size_t offset = 1; offset < 4u; offset++ )
+   {
+      helper_CheckAgainstSerial( INPUT_LEN - offset, INPUT_LEN - offset, offset, NULL );
+   }
+}
+
+void test_Ascii7Seg_PoolConvertWord_StopsAtNul(void)
+{
+   Input[(4u * CHUNK) + 3u] = '\0';
+   TEST_ASSERT_EQUAL_size_t( Ascii7Seg_ConvertWord(Input, INPUT_LEN, Expected),
+                             Ascii7Seg_PoolConvertWord(&Pool, Input, INPUT_LEN, Actual) );
+   TEST_ASSERT_EQUAL_size_t( (4u * CHUNK) + 3u, Ascii7Seg_PoolConvertWord(&Pool, Input, INPUT_LEN, Actual) );
+   TEST_ASSERT_EQUAL_MEMORY( Expected, Actual, ((4u * CHUNK) + 3u) * sizeof(Expected[0]) );
+}
+
+void test_Ascii7Seg_PoolConvertWord_ShortStringLongLen(void)
+{
+   // str_len only bounds the word: neither str nor buf go as far as it
+   static const char word[] = "12345";
+   const size_t word_len = sizeof(word) - 1u;
+   char * str = malloc( sizeof(word) );
+   union Ascii7Seg_Encoding_U * buf = malloc( word_len * sizeof(*buf) );
+   TEST_ASSERT_NOT_NULL( str );
+   TEST_ASSERT_NOT_NULL( buf );
+   (void)memcpy( str, word, sizeof(word) );
+
+   // Whether a worker gets to a chunk past the word before the null terminator
+   // is found depends on scheduling, so give it plenty of chances
+   for ( size_t call = 0; call < 100u; call++ )
+   {
+      TEST_ASSERT_EQUAL_size_t( word_len, Ascii7Seg_PoolConvertWord(&Pool, str, 8u * CHUNK, buf) );
+   }
+   for ( size_t i = 0; i < word_len; i++ )
+   {
+      union Ascii7Seg_Encoding_U expected;
+      TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar(word[i], &expected) );
+      TEST_ASSERT_EQUAL_MEMORY( &expected, &buf[i], sizeof(expected) );
+   }
+
+   free( buf );
+   free( str );
+}
+
+void test_Ascii7Seg_Pool_OneWorker(void)
+{
+   tearDown();
+   TEST_ASSERT_TRUE( Ascii7Seg_PoolInit(&Pool, 1) );
+   TEST_ASSERT_EQUAL_size_t( 1, Pool.num_workers );
+
+   Input[(2u * CHUNK) + 5u] = '#';
+   helper_CheckAgainstSerial( INPUT_LEN, INPUT_LEN, 0, NULL );
+}
+
+void test_Ascii7Seg_Pool_ReusedAcrossCalls(void)
+{
+   char err_msg[32];
+   for ( size_t call = 0; call < 50u; call++ )
+   {
+      const size_t invalid = ( (call * 997u) + 13u ) % INPUT_LEN;
+      Input[invalid] = '#';
+      (void)snprintf( err_msg, sizeof(err_msg), "call %zu", call );
+      helper_CheckAgainstSerial( INPUT_LEN, INPUT_LEN, 0, err_msg );
+      Input[invalid] = (char)( '0' + (invalid % 10u) );
+   }
+}
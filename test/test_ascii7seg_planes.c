@@ -0,0 +1,340 @@
+/*!
+ * @file    test_ascii7seg_planes.c
+ * @brief   Test file for the bit-sliced segment plane API.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_planes.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+#define MAX_DIGITS   64
+#define STR_LEN      80   // Longer than the widest plane
+
+/* Datatypes */
+
+/* Local Variables */
+
+// Characters supported by the variant of the library under test
+#ifdef ASCII_7SEG_NUMS_ONLY
+static const char VariantSupportedChars[] = "0123456789";
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+static const char VariantSupportedChars[] = "0123456789EeRrOo";
+#else
+static const char VariantSupportedChars[] = "0123456789[]()_-|=><abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+#endif
+
+// Full ASCII Encoding Lookup Table
+extern const union Ascii7Seg_Encoding_U AsciiEncodingReferenceLookup[ UINT8_MAX ];
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_ConvertWordToPlanes_AllWidths(void);
+void test_Ascii7Seg_ConvertWordToPlanes_EachDigitCount(void);
+void test_Ascii7Seg_ConvertWordToPlanes_InvalidAtEachPosition(void);
+void test_Ascii7Seg_ConvertWordToPlanes_TruncatedByLen(void);
+void test_Ascii7Seg_ConvertWordToPlanes_DecimalPointPlaneBlank(void);
+void test_Ascii7Seg_ConvertWordToPlanes_NullArgs(void);
+
+void test_Ascii7Seg_EncodingsToPlanes_MatchesConvertWord(void);
+void test_Ascii7Seg_EncodingsToPlanes_ClampedToWidth(void);
+void test_Ascii7Seg_EncodingsToPlanes_DecimalPoint(void);
+void test_Ascii7Seg_EncodingsToPlanes_NullArgs(void);
+
+void helper_FillString(char * str, size_t len, size_t offset);
+uint64_t helper_ExpectedPlane(const char * str, size_t num_digits, size_t plane);
+void helper_CheckPlanes(const char * str, size_t num_digits, const uint64_t * planes);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_ConvertWordToPlanes_AllWidths);
+   RUN_TEST(test_Ascii7Seg_ConvertWordToPlanes_EachDigitCount);
+   RUN_TEST(test_Ascii7Seg_ConvertWordToPlanes_InvalidAtEachPosition);
+   RUN_TEST(test_Ascii7Seg_ConvertWordToPlanes_TruncatedByLen);
+   RUN_TEST(test_Ascii7Seg_ConvertWordToPlanes_DecimalPointPlaneBlank);
+   RUN_TEST(test_Ascii7Seg_ConvertWordToPlanes_NullArgs);
+
+   RUN_TEST(test_Ascii7Seg_EncodingsToPlanes_MatchesConvertWord);
+   RUN_TEST(test_Ascii7Seg_EncodingsToPlanes_ClampedToWidth);
+   RUN_TEST(test_Ascii7Seg_EncodingsToPlanes_DecimalPoint);
+   RUN_TEST(test_Ascii7Seg_EncodingsToPlanes_NullArgs);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   // Do nothing
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+void helper_FillString(char * str, size_t len, size_t offset)
+{
+   for ( size_t i = 0; i < len; i++ )
+   {
+      str[i] = VariantSupportedChars[ (offset + i * 7) % (sizeof(VariantSupportedChars) - 1) ];
+   }
+   str[len] = '\0';
+}
+
+// Builds the expected plane one digit at a time from the reference table
+uint64_t helper_ExpectedPlane(const char * str, size_t num_digits, size_t plane)
+{
+   uint64_t expected = 0;
+   for ( size_t i = 0; i < num_digits; i++ )
+   {
+      const union Ascii7Seg_Encoding_U * ref = &AsciiEncodingReferenceLookup[(uint8_t)str[i]];
+      bool on;
+      switch ( plane )
+      {
+         case ASCII_7SEG_PLANE_A: on = ref->segments.a; break;
+         case ASCII_7SEG_PLANE_B: on = ref->segments.b; break;
+         case ASCII_7SEG_PLANE_C: on = ref->segments.c; break;
+         case ASCII_7SEG_PLANE_D: on = ref->segments.d; break;
+         case ASCII_7SEG_PLANE_E: on = ref->segments.e; break;
+         case ASCII_7SEG_PLANE_F: on = ref->segments.f; break;
+         case ASCII_7SEG_PLANE_G: on = ref->segments.g; break;
+         default:                 on = false;           break;
+      }
+      if ( on )
+      {
+         expected |= UINT64_C(1) << i;
+      }
+   }
+
+   return expected;
+}
+
+void helper_CheckPlanes(const char * str, size_t num_digits, const uint64_t * planes)
+{
+   char err_msg[40];
+   for ( size_t plane = 0; plane < ASCII_7SEG_NUM_PLANES; plane++ )
+   {
+      (void)snprintf( err_msg, sizeof(err_msg), "plane %zu, %zu digits", plane, num_digits );
+      TEST_ASSERT_EQUAL_HEX64_MESSAGE( helper_ExpectedPlane(str, num_digits, plane),
+                                       planes[plane],
+                                       err_msg );
+   }
+}
+
+/************************* Convert Word To Planes *****************************/
+
+void test_Ascii7Seg_ConvertWordToPlanes_AllWidths(void)
+{
+   char str[STR_LEN + 1];
+   uint8_t planes8[ASCII_7SEG_NUM_PLANES];
+   uint16_t planes16[ASCII_7SEG_NUM_PLANES];
+   uint32_t planes32[ASCII_7SEG_NUM_PLANES];
+   uint64_t planes64[ASCII_7SEG_NUM_PLANES];
+   uint64_t widened[ASCII_7SEG_NUM_PLANES];
+
+   for ( size_t offset = 0; offset < sizeof(VariantSupportedChars) - 1; offset++ )
+   {
+      helper_FillString(str, STR_LEN, offset);
+
+      TEST_ASSERT_EQUAL_size_t( 8, Ascii7Seg_ConvertWordToPlanes8(str, STR_LEN, planes8) );
+      for ( size_t p = 0; p < ASCII_7SEG_NUM_PLANES; p++ )  widened[p] = planes8[p];
+      helper_CheckPlanes(str, 8, widened);
+
+      TEST_ASSERT_EQUAL_size_t( 16, Ascii7Seg_ConvertWordToPlanes16(str, STR_LEN, planes16) );
+      for ( size_t p = 0; p < ASCII_7SEG_NUM_PLANES; p++ )  widened[p] = planes16[p];
+      helper_CheckPlanes(str, 16, widened);
+
+      TEST_ASSERT_EQUAL_size_t( 32, Ascii7Seg_ConvertWordToPlanes32(str, STR_LEN, planes32) );
+      for ( size_t p = 0; p < ASCII_7SEG_NUM_PLANES; p++ )  widened[p] = planes32[p];
+      helper_CheckPlanes(str, 32, widened);
+
+      TEST_ASSERT_EQUAL_size_t( 64, Ascii7Seg_ConvertWordToPlanes64(str, STR_LEN, planes64) );
+      helper_CheckPlanes(str, 64, planes64);
+   }
+}
+
+void test_Ascii7Seg_ConvertWordToPlanes_EachDigitCount(void)
+{
+   char str[STR_LEN + 1];
+   uint64_t planes[ASCII_7SEG_NUM_PLANES];
+
+   for ( size_t len = 0; len <= MAX_DIGITS; len++ )
+   {
+      // The string ends (null terminator) right after len characters
+      helper_FillString(str, len, len);
+      memset(planes, 0xA5, sizeof(planes));
+
+      TEST_ASSERT_EQUAL_size_t( len, Ascii7Seg_ConvertWordToPlanes64(str, STR_LEN, planes) );
+      helper_CheckPlanes(str, len, planes);
+   }
+}
+
+void test_Ascii7Seg_ConvertWordToPlanes_InvalidAtEachPosition(void)
+{
+   char str[STR_LEN + 1];
+   uint64_t planes[ASCII_7SEG_NUM_PLANES];
+
+   for ( size_t pos = 0; pos < MAX_DIGITS; pos++ )
+   {
+      helper_FillString(str, STR_LEN, pos);
+      str[pos] = ',';   // Not supported by any variant
+
+      TEST_ASSERT_EQUAL_size_t( pos, Ascii7Seg_ConvertWordToPlanes64(str, STR_LEN, planes) );
+      // Everything from the invalid character on is blank
+      helper_CheckPlanes(str, pos, planes);
+   }
+}
+
+void test_Ascii7Seg_ConvertWordToPlanes_TruncatedByLen(void)
+{
+   char str[STR_LEN + 1];
+   uint16_t planes16[ASCII_7SEG_NUM_PLANES];
+   uint64_t widened[ASCII_7SEG_NUM_PLANES];
+
+   helper_FillString(str, STR_LEN, 0);
+   for ( size_t len = 0; len <= 16; len++ )
+   {
+      TEST_ASSERT_EQUAL_size_t( len, Ascii7Seg_ConvertWordToPlanes16(str, len, planes16) );
+      for ( size_t p = 0; p < ASCII_7SEG_NUM_PLANES; p++ )  widened[p] = planes16[p];
+      helper_CheckPlanes(str, len, widened);
+   }
+}
+
+void test_Ascii7Seg_ConvertWordToPlanes_DecimalPointPlaneBlank(void)
+{
+   // '8' lights up every segment in every variant, so this is the one most
+   // likely to leak into the decimal point plane
+   const char str[] = "88888888";
+   uint8_t planes[ASCII_7SEG_NUM_PLANES];
+
+   TEST_ASSERT_EQUAL_size_t( 8, Ascii7Seg_ConvertWordToPlanes8(str, sizeof(str), planes) );
+   for ( size_t p = ASCII_7SEG_PLANE_A; p <= ASCII_7SEG_PLANE_G; p++ )
+   {
+      TEST_ASSERT_EQUAL_HEX8( 0xFF, planes[p] );
+   }
+   TEST_ASSERT_EQUAL_HEX8( 0x00, planes[ASCII_7SEG_PLANE_DP] );
+}
+
+void test_Ascii7Seg_ConvertWordToPlanes_NullArgs(void)
+{
+   uint8_t planes8[ASCII_7SEG_NUM_PLANES];
+   uint16_t planes16[ASCII_7SEG_NUM_PLANES];
+   uint32_t planes32[ASCII_7SEG_NUM_PLANES];
+   uint64_t planes64[ASCII_7SEG_NUM_PLANES];
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertWordToPlanes8(NULL, 3, planes8) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertWordToPlanes8("123", 3, NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertWordToPlanes16(NULL, 3, planes16) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertWordToPlanes16("123", 3, NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertWordToPlanes32(NULL, 3, planes32) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertWordToPlanes32("123", 3, NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertWordToPlanes64(NULL, 3, planes64) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ConvertWordToPlanes64("123", 3, NULL) );
+}
+
+/************************** Encodings To Planes *******************************/
+
+void test_Ascii7Seg_EncodingsToPlanes_MatchesConvertWord(void)
+{
+   char str[STR_LEN + 1];
+   union Ascii7Seg_Encoding_U encodings[MAX_DIGITS];
+   uint64_t planes[ASCII_7SEG_NUM_PLANES];
+
+   for ( size_t len = 0; len <= MAX_DIGITS; len++ )
+   {
+      helper_FillString(str, len, len);
+      TEST_ASSERT_EQUAL_size_t( len, Ascii7Seg_ConvertWord(str, len, encodings) );
+
+      TEST_ASSERT_EQUAL_size_t( len, Ascii7Seg_EncodingsToPlanes64(encodings, len, planes) );
+      helper_CheckPlanes(str, len, planes);
+   }
+}
+
+void test_Ascii7Seg_EncodingsToPlanes_ClampedToWidth(void)
+{
+   char str[STR_LEN + 1];
+   union Ascii7Seg_Encoding_U encodings[MAX_DIGITS];
+   uint8_t planes8[ASCII_7SEG_NUM_PLANES];
+   uint16_t planes16[ASCII_7SEG_NUM_PLANES];
+   uint32_t planes32[ASCII_7SEG_NUM_PLANES];
+   uint64_t widened[ASCII_7SEG_NUM_PLANES];
+
+   helper_FillString(str, MAX_DIGITS, 3);
+   TEST_ASSERT_EQUAL_size_t( MAX_DIGITS, Ascii7Seg_ConvertWord(str, MAX_DIGITS, encodings) );
+
+   TEST_ASSERT_EQUAL_size_t( 8, Ascii7Seg_EncodingsToPlanes8(encodings, MAX_DIGITS, planes8) );
+   for ( size_t p = 0; p < ASCII_7SEG_NUM_PLANES; p++ )  widened[p] = planes8[p];
+   helper_CheckPlanes(str, 8, widened);
+
+   TEST_ASSERT_EQUAL_size_t( 16, Ascii7Seg_EncodingsToPlanes16(encodings, MAX_DIGITS, planes16) );
+   for ( size_t p = 0; p < ASCII_7SEG_NUM_PLANES; p++ )  widened[p] = planes16[p];
+   helper_CheckPlanes(str, 16, widened);
+
+   TEST_ASSERT_EQUAL_size_t( 32, Ascii7Seg_EncodingsToPlanes32(encodings, MAX_DIGITS, planes32) );
+   for ( size_t p = 0; p < ASCII_7SEG_NUM_PLANES; p++ )  widened[p] = planes32[p];
+   helper_CheckPlanes(str, 32, widened);
+}
+
+void test_Ascii7Seg_EncodingsToPlanes_DecimalPoint(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   char str[9];
+   union Ascii7Seg_Encoding_U encodings[8];
+   uint8_t planes[ASCII_7SEG_NUM_PLANES];
+
+   helper_FillString(str, 8, 0);
+   TEST_ASSERT_EQUAL_size_t( 8, Ascii7Seg_ConvertWord(str, 8, encodings) );
+   encodings[1].segments.dp = 1;
+   encodings[6].segments.dp = 1;
+
+   TEST_ASSERT_EQUAL_size_t( 8, Ascii7Seg_EncodingsToPlanes8(encodings, 8, planes) );
+   TEST_ASSERT_EQUAL_HEX8( 0x42, planes[ASCII_7SEG_PLANE_DP] );
+   for ( size_t p = ASCII_7SEG_PLANE_A; p <= ASCII_7SEG_PLANE_G; p++ )
+   {
+      TEST_ASSERT_EQUAL_HEX8( (uint8_t)helper_ExpectedPlane(str, 8, p), planes[p] );
+   }
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_EncodingsToPlanes_NullArgs(void)
+{
+   union Ascii7Seg_Encoding_U encodings[1];
+   uint8_t planes8[ASCII_7SEG_NUM_PLANES];
+   uint16_t planes16[ASCII_7SEG_NUM_PLANES];
+   uint32_t planes32[ASCII_7SEG_NUM_PLANES];
+   uint64_t planes64[ASCII_7SEG_NUM_PLANES];
+
+   TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar('1', &encodings[0]) );
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncodingsToPlanes8(NULL, 1, planes8) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncodingsToPlanes8(encodings, 1, NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncodingsToPlanes16(NULL, 1, planes16) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncodingsToPlanes16(encodings, 1, NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncodingsToPlanes32(NULL, 1, planes32) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncodingsToPlanes32(encodings, 1, NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncodingsToPlanes64(NULL, 1, planes64) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_EncodingsToPlanes64(encodings, 1, NULL) );
+}
@@ -0,0 +1,293 @@
+/*!
+ * @file    test_ascii7seg_profile.c
+ * @brief   Test file for the per-display segment profiles.
+ *
+ * The expected port bytes are worked out by hand from the packed digits (bit
+ * s = segment s), so that the tests check the wiring, the polarity, and the
+ * rotation independently of the code that builds the tables.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_profile.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+
+/* Datatypes */
+
+/* Local Variables */
+
+// Digits 0-9, bit s = segment s
+static const uint8_t PackedDigits[10] =
+{
+   0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+};
+
+// Digits 0-9 upside down: a <-> d, b <-> e, c <-> f
+static const uint8_t RotatedDigits[10] =
+{
+   0x3F, 0x30, 0x5B, 0x79, 0x74, 0x6D, 0x6F, 0x38, 0x7F, 0x7D
+};
+
+// Segments wired to the port in the order dp, g, f, ..., a from bit 0
+static const struct Ascii7Seg_ProfileConfig_S ReversedWiring =
+{
+   .segment_bits = { 7, 6, 5, 4, 3, 2, 1, 0 },
+   .active_low = false,
+   .rotate_180 = false
+};
+
+static struct Ascii7Seg_ProfileConfig_S Cfg;
+static struct Ascii7Seg_Profile_S Profile;
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_ProfileInit_InvalidArgs(void);
+void test_Ascii7Seg_ProfileConvertChar_Identity(void);
+void test_Ascii7Seg_ProfileConvertChar_Wiring(void);
+void test_Ascii7Seg_ProfileConvertChar_ActiveLow(void);
+void test_Ascii7Seg_ProfileConvertChar_Rotate180(void);
+void test_Ascii7Seg_ProfileConvertChar_Unsupported(void);
+void test_Ascii7Seg_ProfileConvertWord_StopsLikeConvertWord(void);
+void test_Ascii7Seg_ProfileApply_MatchesConvertChar(void);
+void test_Ascii7Seg_ProfileApply_DecimalPoint(void);
+void test_Ascii7Seg_Profile_SeveralAtOnce(void);
+
+uint8_t helper_Reverse(uint8_t byte);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_ProfileInit_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_ProfileConvertChar_Identity);
+   RUN_TEST(test_Ascii7Seg_ProfileConvertChar_Wiring);
+   RUN_TEST(test_Ascii7Seg_ProfileConvertChar_ActiveLow);
+   RUN_TEST(test_Ascii7Seg_ProfileConvertChar_Rotate180);
+   RUN_TEST(test_Ascii7Seg_ProfileConvertChar_Unsupported);
+   RUN_TEST(test_Ascii7Seg_ProfileConvertWord_StopsLikeConvertWord);
+   RUN_TEST(test_Ascii7Seg_ProfileApply_MatchesConvertChar);
+   RUN_TEST(test_Ascii7Seg_ProfileApply_DecimalPoint);
+   RUN_TEST(test_Ascii7Seg_Profile_SeveralAtOnce);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   // a to g and dp on bits 0 to 7, active high, upright
+   for ( uint8_t s = 0; s < ASCII_7SEG_PROFILE_NUM_SEGMENTS; s++ )
+   {
+      Cfg.segment_bits[s] = s;
+   }
+   Cfg.active_low = false;
+   Cfg.rotate_180 = false;
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+uint8_t helper_Reverse(uint8_t byte)
+{
+   uint8_t reversed = 0;
+   for ( size_t i = 0; i < 8; i++ )
+   {
+      if ( 0u != (byte & (1u << i)) )
+      {
+         reversed |= (uint8_t)( 0x80u >> i );
+      }
+   }
+   return reversed;
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_ProfileInit_InvalidArgs(void)
+{
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileInit(NULL, &Cfg) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileInit(&Profile, NULL) );
+
+   Cfg.segment_bits[7] = 8;   // Off the port
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+   Cfg.segment_bits[7] = 0;   // Shared with segment a
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+   Cfg.segment_bits[7] = 7;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+
+   uint8_t port = 0;
+   union Ascii7Seg_Encoding_U encoding;
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileConvertChar(NULL, '0', &port) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileConvertChar(&Profile, '0', NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ProfileConvertWord(NULL, "0", 1, &port) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ProfileConvertWord(&Profile, NULL, 1, &port) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ProfileConvertWord(&Profile, "0", 1, NULL) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileApply(NULL, &encoding, 1, &port) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileApply(&Profile, NULL, 1, &port) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ProfileApply(&Profile, &encoding, 1, NULL) );
+}
+
+void test_Ascii7Seg_ProfileConvertChar_Identity(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+
+   for ( size_t d = 0; d < 10; d++ )
+   {
+      uint8_t port = 0xA5;
+      TEST_ASSERT_TRUE( Ascii7Seg_ProfileConvertChar(&Profile, (char)('0' + d), &port) );
+      TEST_ASSERT_EQUAL_HEX8( PackedDigits[d], port );
+   }
+}
+
+void test_Ascii7Seg_ProfileConvertChar_Wiring(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &ReversedWiring) );
+
+   for ( size_t d = 0; d < 10; d++ )
+   {
+      uint8_t port = 0;
+      TEST_ASSERT_TRUE( Ascii7Seg_ProfileConvertChar(&Profile, (char)('0' + d), &port) );
+      TEST_ASSERT_EQUAL_HEX8( helper_Reverse(PackedDigits[d]), port );
+   }
+}
+
+void test_Ascii7Seg_ProfileConvertChar_ActiveLow(void)
+{
+   Cfg.active_low = true;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+
+   for ( size_t d = 0; d < 10; d++ )
+   {
+      const uint8_t expected = (uint8_t)( 0xFFu ^ PackedDigits[d] );
+      uint8_t port = 0;
+      TEST_ASSERT_TRUE( Ascii7Seg_ProfileConvertChar(&Profile, (char)('0' + d), &port) );
+      TEST_ASSERT_EQUAL_HEX8( expected, port );
+   }
+}
+
+void test_Ascii7Seg_ProfileConvertChar_Rotate180(void)
+{
+   Cfg.rotate_180 = true;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+
+   for ( size_t d = 0; d < 10; d++ )
+   {
+      uint8_t port = 0;
+      TEST_ASSERT_TRUE( Ascii7Seg_ProfileConvertChar(&Profile, (char)('0' + d), &port) );
+      TEST_ASSERT_EQUAL_HEX8( RotatedDigits[d], port );
+   }
+}
+
+void test_Ascii7Seg_ProfileConvertChar_Unsupported(void)
+{
+   Cfg.active_low = true;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+
+   // Every character the library can't encode comes out blank, i.e., all 1s here
+   for ( int c = CHAR_MIN; c <= CHAR_MAX; c++ )
+   {
+      uint8_t port = 0;
+      const bool converted = Ascii7Seg_ProfileConvertChar( &Profile, (char)c, &port );
+      TEST_ASSERT_EQUAL( Ascii7Seg_IsSupportedChar((char)c) && (c > 0), converted );
+      if ( !converted )
+      {
+         TEST_ASSERT_EQUAL_HEX8( 0xFF, port );
+      }
+   }
+}
+
+void test_Ascii7Seg_ProfileConvertWord_StopsLikeConvertWord(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &ReversedWiring) );
+
+   uint8_t ports[8] = { 0 };
+   TEST_ASSERT_EQUAL_size_t( 3, Ascii7Seg_ProfileConvertWord(&Profile, "123", 8, ports) );
+   TEST_ASSERT_EQUAL_HEX8( helper_Reverse(PackedDigits[1]), ports[0] );
+   TEST_ASSERT_EQUAL_HEX8( helper_Reverse(PackedDigits[2]), ports[1] );
+   TEST_ASSERT_EQUAL_HEX8( helper_Reverse(PackedDigits[3]), ports[2] );
+
+   TEST_ASSERT_EQUAL_size_t( 2, Ascii7Seg_ProfileConvertWord(&Profile, "123", 2, ports) );
+   TEST_ASSERT_EQUAL_size_t( 2, Ascii7Seg_ProfileConvertWord(&Profile, "45\x01" "6", 4, ports) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_ProfileConvertWord(&Profile, "\x80", 1, ports) );
+}
+
+void test_Ascii7Seg_ProfileApply_MatchesConvertChar(void)
+{
+   Cfg = ReversedWiring;
+   Cfg.active_low = true;
+   Cfg.rotate_180 = true;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+
+   union Ascii7Seg_Encoding_U encodings[10];
+   TEST_ASSERT_EQUAL_size_t( 10, Ascii7Seg_ConvertWord("0123456789", 10, encodings) );
+
+   uint8_t applied[10] = { 0 };
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileApply(&Profile, encodings, 10, applied) );
+
+   for ( size_t d = 0; d < 10; d++ )
+   {
+      uint8_t converted = 0;
+      TEST_ASSERT_TRUE( Ascii7Seg_ProfileConvertChar(&Profile, (char)('0' + d), &converted) );
+      TEST_ASSERT_EQUAL_HEX8( converted, applied[d] );
+      const uint8_t expected = (uint8_t)( 0xFFu ^ helper_Reverse(RotatedDigits[d]) );
+      TEST_ASSERT_EQUAL_HEX8( expected, applied[d] );
+   }
+}
+
+void test_Ascii7Seg_ProfileApply_DecimalPoint(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   // The DP stays the DP, even upside down
+   Cfg = ReversedWiring;
+   Cfg.rotate_180 = true;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&Profile, &Cfg) );
+
+   union Ascii7Seg_Encoding_U encoding;
+   TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar('7', &encoding) );
+   encoding.segments.dp = 1;
+
+   uint8_t port = 0;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileApply(&Profile, &encoding, 1, &port) );
+   TEST_ASSERT_EQUAL_HEX8( helper_Reverse(0x80 | RotatedDigits[7]), port );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
+
+void test_Ascii7Seg_Profile_SeveralAtOnce(void)
+{
+   struct Ascii7Seg_Profile_S upright;
+   struct Ascii7Seg_Profile_S upside_down;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&upright, &Cfg) );
+   Cfg.rotate_180 = true;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileInit(&upside_down, &Cfg) );
+
+   uint8_t port = 0;
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileConvertChar(&upright, '4', &port) );
+   TEST_ASSERT_EQUAL_HEX8( PackedDigits[4], port );
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileConvertChar(&upside_down, '4', &port) );
+   TEST_ASSERT_EQUAL_HEX8( RotatedDigits[4], port );
+   TEST_ASSERT_TRUE( Ascii7Seg_ProfileConvertChar(&upright, '4', &port) );
+   TEST_ASSERT_EQUAL_HEX8( PackedDigits[4], port );
+}
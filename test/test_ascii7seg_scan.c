@@ -0,0 +1,402 @@
+/*!
+ * @file    test_ascii7seg_scan.c
+ * @brief   Test file for the multiplex scan scheduler.
+ *
+ * The GPIO is a mock of two ports that applies each set/clear write to a port
+ * value and logs the write, so the tests can check both what the pins end up
+ * at and the order (and number) of writes in each tick.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_scan.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+#define NUM_DIGITS         4
+#define MAX_WRITES         16
+#define NUM_RANDOM_FRAMES  500
+
+/* Datatypes */
+
+enum Port_E
+{
+   PORT_SEGMENTS,
+   PORT_DIGITS
+};
+
+struct PortWrite_S
+{
+   enum Port_E port;
+   uint32_t set_mask;
+   uint32_t clear_mask;
+};
+
+struct MockGpio_S
+{
+   uint32_t ports[2];
+   struct PortWrite_S writes[MAX_WRITES];   // Since the last helper_ResetWrites()
+   size_t num_writes;
+};
+
+/* Local Variables */
+
+// Digits 0-9, bit s = segment s
+static const uint8_t PackedDigits[10] =
+{
+   0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F
+};
+
+// Segments scattered over the port, to catch any mix-up of segments and pins
+static const uint32_t SegmentPins[ASCII_7SEG_SCAN_NUM_SEGMENTS] =
+{
+   1u << 3, 1u << 9, 1u << 0, 1u << 14, 1u << 5, 1u << 1, 1u << 12, 1u << 7
+};
+#define ALL_SEGMENT_PINS   ( (1u << 3) | (1u << 9) | (1u << 0) | (1u << 14) | \
+                             (1u << 5) | (1u << 1) | (1u << 12) | (1u << 7) )
+
+static const uint32_t DigitPins[NUM_DIGITS] = { 1u << 8, 1u << 9, 1u << 10, 1u << 11 };
+#define ALL_DIGIT_PINS     ( 0xFu << 8 )
+
+static struct MockGpio_S Mock;
+static struct Ascii7Seg_Scan_S Scan;
+static struct Ascii7Seg_ScanPinMap_S Pins;
+static struct Ascii7Seg_ScanGpio_S Gpio;
+static union Ascii7Seg_Encoding_U Frame[NUM_DIGITS];
+
+static uint64_t RandomState = UINT64_C(0xD1B54A32D192ED03);
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_ScanInit_InvalidArgs(void);
+void test_Ascii7Seg_ScanInit_AllDigitsOff(void);
+void test_Ascii7Seg_ScanTick_ShowsEachDigitInTurn(void);
+void test_Ascii7Seg_ScanTick_ActiveLow(void);
+void test_Ascii7Seg_ScanTick_BlankTicks(void);
+void test_Ascii7Seg_ScanTick_DigitsOffBeforeSegments(void);
+void test_Ascii7Seg_ScanTick_SameCostForEveryFrame(void);
+void test_Ascii7Seg_ScanSetFrame_MidScan(void);
+void test_Ascii7Seg_ScanSetFrame_DecimalPoint(void);
+
+uint64_t helper_Random(void);
+void helper_MockWrite(void * ctx, enum Port_E port, uint32_t set_mask, uint32_t clear_mask);
+void helper_MockWriteSegments(void * ctx, uint32_t set_mask, uint32_t clear_mask);
+void helper_MockWriteDigits(void * ctx, uint32_t set_mask, uint32_t clear_mask);
+void helper_ResetWrites(void);
+void helper_SetFrame(const char * digits);
+uint32_t helper_LitPins(uint8_t packed);
+void helper_CheckShowing(size_t digit, uint8_t packed, bool active_low);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_ScanInit_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_ScanInit_AllDigitsOff);
+   RUN_TEST(test_Ascii7Seg_ScanTick_ShowsEachDigitInTurn);
+   RUN_TEST(test_Ascii7Seg_ScanTick_ActiveLow);
+   RUN_TEST(test_Ascii7Seg_ScanTick_BlankTicks);
+   RUN_TEST(test_Ascii7Seg_ScanTick_DigitsOffBeforeSegments);
+   RUN_TEST(test_Ascii7Seg_ScanTick_SameCostForEveryFrame);
+   RUN_TEST(test_Ascii7Seg_ScanSetFrame_MidScan);
+   RUN_TEST(test_Ascii7Seg_ScanSetFrame_DecimalPoint);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   (void)memset( &Mock, 0, sizeof(Mock) );
+
+   (void)memset( &Pins, 0, sizeof(Pins) );
+   (void)memcpy( Pins.segment_pins, SegmentPins, sizeof(SegmentPins) );
+   (void)memcpy( Pins.digit_pins, DigitPins, sizeof(DigitPins) );
+   Pins.num_digits = NUM_DIGITS;
+
+   Gpio.write_segments = helper_MockWriteSegments;
+   Gpio.write_digits = helper_MockWriteDigits;
+   Gpio.ctx = &Mock;
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+// xorshift64, so that the "random" frames are the same on every run
+uint64_t helper_Random(void)
+{
+   RandomState ^= RandomState << 13;
+   RandomState ^= RandomState >> 7;
+   RandomState ^= RandomState << 17;
+   return RandomState;
+}
+
+void helper_MockWrite(void * ctx, enum Port_E port, uint32_t set_mask, uint32_t clear_mask)
+{
+   struct MockGpio_S * mock = (struct MockGpio_S *)ctx;
+   TEST_ASSERT_EQUAL_HEX32( 0, set_mask & clear_mask );
+
+   mock->ports[port] = (mock->ports[port] | set_mask) & ~clear_mask;
+
+   // Only the first MAX_WRITES are logged, but all are counted
+   if ( mock->num_writes < MAX_WRITES )
+   {
+      mock->writes[mock->num_writes].port = port;
+      mock->writes[mock->num_writes].set_mask = set_mask;
+      mock->writes[mock->num_writes].clear_mask = clear_mask;
+   }
+   mock->num_writes++;
+}
+
+void helper_MockWriteSegments(void * ctx, uint32_t set_mask, uint32_t clear_mask)
+{
+   helper_MockWrite( ctx, PORT_SEGMENTS, set_mask, clear_mask );
+}
+
+void helper_MockWriteDigits(void * ctx, uint32_t set_mask, uint32_t clear_mask)
+{
+   helper_MockWrite( ctx, PORT_DIGITS, set_mask, clear_mask );
+}
+
+void helper_ResetWrites(void)
+{
+   Mock.num_writes = 0;
+}
+
+// Digits only, so that every variant of the library can encode them
+void helper_SetFrame(const char * digits)
+{
+   TEST_ASSERT_EQUAL_size_t( NUM_DIGITS, strlen(digits) );
+   for ( size_t i = 0; i < NUM_DIGITS; i++ )
+   {
+      TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar(digits[i], &Frame[i]) );
+   }
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanSetFrame(&Scan, Frame) );
+}
+
+uint32_t helper_LitPins(uint8_t packed)
+{
+   uint32_t pins = 0;
+   for ( size_t s = 0; s < ASCII_7SEG_SCAN_NUM_SEGMENTS; s++ )
+   {
+      if ( 0u != (packed & (1u << s)) )
+      {
+         pins |= SegmentPins[s];
+      }
+   }
+   return pins;
+}
+
+// Checks that the ports light exactly the given segments, on exactly the given digit
+void helper_CheckShowing(size_t digit, uint8_t packed, bool active_low)
+{
+   const uint32_t lit = helper_LitPins( packed );
+   const uint32_t selected = DigitPins[digit];
+   TEST_ASSERT_EQUAL_HEX32( active_low ? (ALL_SEGMENT_PINS & ~lit) : lit,
+                            Mock.ports[PORT_SEGMENTS] & ALL_SEGMENT_PINS );
+   TEST_ASSERT_EQUAL_HEX32( active_low ? (ALL_DIGIT_PINS & ~selected) : selected,
+                            Mock.ports[PORT_DIGITS] & ALL_DIGIT_PINS );
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_ScanInit_InvalidArgs(void)
+{
+   TEST_ASSERT_FALSE( Ascii7Seg_ScanInit(NULL, &Pins, &Gpio, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ScanInit(&Scan, NULL, &Gpio, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ScanInit(&Scan, &Pins, NULL, 0) );
+
+   Gpio.write_digits = NULL;
+   TEST_ASSERT_FALSE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   Gpio.write_digits = helper_MockWriteDigits;
+
+   Pins.num_digits = 0;
+   TEST_ASSERT_FALSE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   Pins.num_digits = ASCII_7SEG_SCAN_MAX_DIGITS + 1;
+   TEST_ASSERT_FALSE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   TEST_ASSERT_EQUAL_size_t( 0, Mock.num_writes );
+
+   Pins.num_digits = NUM_DIGITS;
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ScanSetFrame(NULL, Frame) );
+   TEST_ASSERT_FALSE( Ascii7Seg_ScanSetFrame(&Scan, NULL) );
+}
+
+void test_Ascii7Seg_ScanInit_AllDigitsOff(void)
+{
+   Mock.ports[PORT_DIGITS] = ALL_DIGIT_PINS;
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   TEST_ASSERT_EQUAL_HEX32( 0, Mock.ports[PORT_DIGITS] );
+
+   // Then blanks, until a frame is set
+   for ( size_t d = 0; d < NUM_DIGITS; d++ )
+   {
+      Ascii7Seg_ScanTick( &Scan );
+      helper_CheckShowing( d, 0x00, false );
+   }
+}
+
+void test_Ascii7Seg_ScanTick_ShowsEachDigitInTurn(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   helper_SetFrame( "1234" );
+
+   for ( size_t lap = 0; lap < 3; lap++ )
+   {
+      for ( size_t d = 0; d < NUM_DIGITS; d++ )
+      {
+         Ascii7Seg_ScanTick( &Scan );
+         helper_CheckShowing( d, PackedDigits[d + 1], false );
+      }
+   }
+}
+
+void test_Ascii7Seg_ScanTick_ActiveLow(void)
+{
+   Pins.segments_active_low = true;
+   Pins.digits_active_low = true;
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   TEST_ASSERT_EQUAL_HEX32( ALL_DIGIT_PINS, Mock.ports[PORT_DIGITS] );
+   helper_SetFrame( "5678" );
+
+   for ( size_t d = 0; d < NUM_DIGITS; d++ )
+   {
+      Ascii7Seg_ScanTick( &Scan );
+      helper_CheckShowing( d, PackedDigits[d + 5], true );
+   }
+}
+
+void test_Ascii7Seg_ScanTick_BlankTicks(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 2) );
+   helper_SetFrame( "9012" );
+
+   for ( size_t d = 0; d < NUM_DIGITS; d++ )
+   {
+      Ascii7Seg_ScanTick( &Scan );
+      helper_CheckShowing( d, PackedDigits[(d + 9) % 10], false );
+
+      for ( size_t b = 0; b < 2; b++ )
+      {
+         helper_ResetWrites();
+         Ascii7Seg_ScanTick( &Scan );
+         TEST_ASSERT_EQUAL_HEX32( 0, Mock.ports[PORT_DIGITS] );
+         TEST_ASSERT_EQUAL_size_t( 1, Mock.num_writes );
+      }
+   }
+
+   // And back to digit 0
+   Ascii7Seg_ScanTick( &Scan );
+   helper_CheckShowing( 0, PackedDigits[9], false );
+}
+
+void test_Ascii7Seg_ScanTick_DigitsOffBeforeSegments(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   helper_SetFrame( "8888" );
+
+   for ( size_t d = 0; d < NUM_DIGITS; d++ )
+   {
+      helper_ResetWrites();
+      Ascii7Seg_ScanTick( &Scan );
+
+      // Deselect everything, change the segments, then select the digit
+      TEST_ASSERT_EQUAL_size_t( 3, Mock.num_writes );
+      TEST_ASSERT_EQUAL_INT( PORT_DIGITS, Mock.writes[0].port );
+      TEST_ASSERT_EQUAL_HEX32( ALL_DIGIT_PINS, Mock.writes[0].clear_mask );
+      TEST_ASSERT_EQUAL_INT( PORT_SEGMENTS, Mock.writes[1].port );
+      TEST_ASSERT_EQUAL_INT( PORT_DIGITS, Mock.writes[2].port );
+      TEST_ASSERT_EQUAL_HEX32( DigitPins[d], Mock.writes[2].set_mask );
+   }
+}
+
+// The cost of a tick, in port writes and in the bits each write touches, must
+// not depend on what is being shown.
+void test_Ascii7Seg_ScanTick_SameCostForEveryFrame(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 1) );
+
+   for ( size_t f = 0; f < NUM_RANDOM_FRAMES; f++ )
+   {
+      char digits[NUM_DIGITS + 1] = { '\0' };
+      for ( size_t d = 0; d < NUM_DIGITS; d++ )
+      {
+         digits[d] = (char)('0' + (helper_Random() % 10));
+      }
+      helper_SetFrame( digits );
+
+      for ( size_t t = 0; t < (2 * NUM_DIGITS); t++ )
+      {
+         helper_ResetWrites();
+         Ascii7Seg_ScanTick( &Scan );
+         TEST_ASSERT_EQUAL_size_t( (0 == (t % 2)) ? 3 : 1, Mock.num_writes );
+         for ( size_t w = 0; w < Mock.num_writes; w++ )
+         {
+            const uint32_t all = (PORT_SEGMENTS == Mock.writes[w].port) ? ALL_SEGMENT_PINS : ALL_DIGIT_PINS;
+            TEST_ASSERT_EQUAL_HEX32( all, Mock.writes[w].set_mask | Mock.writes[w].clear_mask );
+         }
+      }
+   }
+}
+
+void test_Ascii7Seg_ScanSetFrame_MidScan(void)
+{
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   helper_SetFrame( "1111" );
+
+   Ascii7Seg_ScanTick( &Scan );
+   Ascii7Seg_ScanTick( &Scan );
+   helper_CheckShowing( 1, PackedDigits[1], false );
+
+   // The scan carries on from digit 2, with the new frame
+   helper_SetFrame( "2222" );
+   Ascii7Seg_ScanTick( &Scan );
+   helper_CheckShowing( 2, PackedDigits[2], false );
+   Ascii7Seg_ScanTick( &Scan );
+   helper_CheckShowing( 3, PackedDigits[2], false );
+
+   // Setting frames back to back always leaves the latest one showing
+   helper_SetFrame( "3333" );
+   helper_SetFrame( "4444" );
+   Ascii7Seg_ScanTick( &Scan );
+   helper_CheckShowing( 0, PackedDigits[4], false );
+}
+
+void test_Ascii7Seg_ScanSetFrame_DecimalPoint(void)
+{
+#ifdef ASCII_7SEG_HAS_DP
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanInit(&Scan, &Pins, &Gpio, 0) );
+   for ( size_t i = 0; i < NUM_DIGITS; i++ )
+   {
+      TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar('0', &Frame[i]) );
+   }
+   Frame[0].segments.dp = 1;
+   TEST_ASSERT_TRUE( Ascii7Seg_ScanSetFrame(&Scan, Frame) );
+
+   Ascii7Seg_ScanTick( &Scan );
+   helper_CheckShowing( 0, 0x80 | PackedDigits[0], false );
+   Ascii7Seg_ScanTick( &Scan );
+   helper_CheckShowing( 1, PackedDigits[0], false );
+#else
+   TEST_IGNORE_MESSAGE("Only applies where Ascii7Seg_Encoding_U has a decimal point");
+#endif
+}
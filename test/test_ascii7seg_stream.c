@@ -0,0 +1,330 @@
+/*!
+ * @file    test_ascii7seg_stream.c
+ * @brief   Test file for the streaming encoder API.
+ *
+ * @author  Abdullah Almosalami @memphis242
+ * @date    Oct 17, 2026
+ * @copyright MIT License
+ */
+
+/* File Inclusions */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unity.h"
+#include "ascii7seg.h"
+#include "ascii7seg_stream.h"
+#include "ascii7seg_config.h"
+
+/* Local Macro Definitions */
+#define RING_CAP     13   // Deliberately not a power of 2 or a multiple of any chunk size
+#define INPUT_LEN    300
+#define OUT_LEN      (INPUT_LEN * 2)
+
+/* Datatypes */
+
+/* Local Variables */
+
+// Characters supported by the variant of the library under test
+#ifdef ASCII_7SEG_NUMS_ONLY
+static const char VariantSupportedChars[] = "0123456789";
+#elif defined(ASCII_7SEG_NUMS_AND_ERROR_ONLY)
+static const char VariantSupportedChars[] = "0123456789EeRrOo";
+#else
+static const char VariantSupportedChars[] = "0123456789[]()_-|=><abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+#endif
+
+// Full ASCII Encoding Lookup Table
+extern const union Ascii7Seg_Encoding_U AsciiEncodingReferenceLookup[ UINT8_MAX ];
+
+static union Ascii7Seg_Encoding_U Ring[RING_CAP];
+static struct Ascii7Seg_Stream_S Stream;
+
+/* Forward Function Declarations */
+
+void setUp(void);
+void tearDown(void);
+
+void test_Ascii7Seg_StreamInit_InvalidArgs(void);
+void test_Ascii7Seg_StreamFeed_EachChunkSize(void);
+void test_Ascii7Seg_StreamFeed_FullRingBackpressure(void);
+void test_Ascii7Seg_StreamFeed_SkipPolicy(void);
+void test_Ascii7Seg_StreamFeed_ReplacePolicy(void);
+void test_Ascii7Seg_StreamFeed_ReplaceWaitsForRoom(void);
+void test_Ascii7Seg_StreamFlush_StatsAcrossChunks(void);
+void test_Ascii7Seg_Stream_NullArgs(void);
+
+void helper_FillInput(char * input, size_t len, size_t invalid_every);
+size_t helper_Pump(const char * input, size_t len, size_t chunk_size, size_t read_size,
+                   union Ascii7Seg_Encoding_U * out);
+void helper_CheckEncoding(const union Ascii7Seg_Encoding_U * expected,
+                          const union Ascii7Seg_Encoding_U * actual,
+                          size_t idx);
+
+/* Meat of the Program */
+
+int main(void)
+{
+   UNITY_BEGIN();
+
+   RUN_TEST(test_Ascii7Seg_StreamInit_InvalidArgs);
+   RUN_TEST(test_Ascii7Seg_StreamFeed_EachChunkSize);
+   RUN_TEST(test_Ascii7Seg_StreamFeed_FullRingBackpressure);
+   RUN_TEST(test_Ascii7Seg_StreamFeed_SkipPolicy);
+   RUN_TEST(test_Ascii7Seg_StreamFeed_ReplacePolicy);
+   RUN_TEST(test_Ascii7Seg_StreamFeed_ReplaceWaitsForRoom);
+   RUN_TEST(test_Ascii7Seg_StreamFlush_StatsAcrossChunks);
+   RUN_TEST(test_Ascii7Seg_Stream_NullArgs);
+
+   return UNITY_END();
+}
+
+/********************************* Test Setup *********************************/
+
+void setUp(void)
+{
+   (void)memset( Ring, 0, sizeof(Ring) );
+   (void)memset( &Stream, 0, sizeof(Stream) );
+}
+
+void tearDown(void)
+{
+   // Do nothing
+}
+
+/********************************** Helpers ***********************************/
+
+// Supported characters, with a '#' (never supported) every invalid_every characters (0 for none)
+void helper_FillInput(char * input, size_t len, size_t invalid_every)
+{
+   for ( size_t i = 0; i < len; i++ )
+   {
+      if ( (invalid_every != 0) && (i % invalid_every == invalid_every - 1) )
+      {
+         input[i] = '#';
+      }
+      else
+      {
+         input[i] = VariantSupportedChars[ (i * 7) % (sizeof(VariantSupportedChars) - 1) ];
+      }
+   }
+}
+
+// Feeds input chunk_size characters at a time, draining read_size encodings
+// into out whenever the stream stalls, and returns the number of encodings read
+size_t helper_Pump(const char * input, size_t len, size_t chunk_size, size_t read_size,
+                   union Ascii7Seg_Encoding_U * out)
+{
+   size_t num_out = 0;
+   for ( size_t fed = 0; fed < len; )
+   {
+      size_t chunk_len = ( len - fed < chunk_size ) ? (len - fed) : chunk_size;
+      size_t consumed = Ascii7Seg_StreamFeed( &Stream, &input[fed], chunk_len );
+      fed += consumed;
+      if ( consumed < chunk_len )
+      {
+         TEST_ASSERT_EQUAL_size_t( RING_CAP, Ascii7Seg_StreamPending(&Stream) );
+      }
+      num_out += Ascii7Seg_StreamRead( &Stream, &out[num_out], read_size );
+   }
+   num_out += Ascii7Seg_StreamRead( &Stream, &out[num_out], OUT_LEN - num_out );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamPending(&Stream) );
+
+   return num_out;
+}
+
+void helper_CheckEncoding(const union Ascii7Seg_Encoding_U * expected,
+                          const union Ascii7Seg_Encoding_U * actual,
+                          size_t idx)
+{
+   char err_msg[20];
+   (void)snprintf( err_msg, sizeof(err_msg), "encoding %zu", idx );
+#ifdef ASCII_7SEG_BIT_PACK
+   TEST_ASSERT_EQUAL_HEX8_MESSAGE( expected->encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                   actual->encoding_as_val & ASCII_7SEG_BIT_PACK_MASK,
+                                   err_msg );
+#else
+   TEST_ASSERT_EQUAL_MEMORY_MESSAGE( expected->encoding_as_val, actual->encoding_as_val,
+                                     sizeof(expected->encoding_as_val), err_msg );
+#endif
+}
+
+/*********************************** Tests ************************************/
+
+void test_Ascii7Seg_StreamInit_InvalidArgs(void)
+{
+   TEST_ASSERT_FALSE( Ascii7Seg_StreamInit(NULL, Ring, RING_CAP, ASCII_7SEG_STREAM_SKIP, NULL) );
+   TEST_ASSERT_FALSE( Ascii7Seg_StreamInit(&Stream, NULL, RING_CAP, ASCII_7SEG_STREAM_SKIP, NULL) );
+   TEST_ASSERT_FALSE( Ascii7Seg_StreamInit(&Stream, Ring, 0, ASCII_7SEG_STREAM_SKIP, NULL) );
+   TEST_ASSERT_FALSE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_NUM_OF_POLICIES, NULL) );
+   TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, 1, ASCII_7SEG_STREAM_REPLACE, NULL) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamPending(&Stream) );
+}
+
+// However the input is chunked and drained, the output is the one-shot conversion
+void test_Ascii7Seg_StreamFeed_EachChunkSize(void)
+{
+   char input[INPUT_LEN];
+   union Ascii7Seg_Encoding_U out[OUT_LEN];
+   helper_FillInput( input, INPUT_LEN, 0 );
+
+   for ( size_t chunk_size = 1; chunk_size <= 2 * RING_CAP + 1; chunk_size++ )
+   {
+      TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_SKIP, NULL) );
+      size_t num_out = helper_Pump( input, INPUT_LEN, chunk_size, (chunk_size % 5) + 1, out );
+
+      TEST_ASSERT_EQUAL_size_t( INPUT_LEN, num_out );
+      for ( size_t i = 0; i < num_out; i++ )
+      {
+         helper_CheckEncoding( &AsciiEncodingReferenceLookup[(uint8_t)input[i]], &out[i], i );
+      }
+   }
+}
+
+void test_Ascii7Seg_StreamFeed_FullRingBackpressure(void)
+{
+   char input[INPUT_LEN];
+   union Ascii7Seg_Encoding_U out[RING_CAP];
+   helper_FillInput( input, INPUT_LEN, 0 );
+   TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_SKIP, NULL) );
+
+   // Only as much as fits is consumed, and a full ring consumes nothing
+   TEST_ASSERT_EQUAL_size_t( RING_CAP, Ascii7Seg_StreamFeed(&Stream, input, INPUT_LEN) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamFeed(&Stream, &input[RING_CAP], INPUT_LEN - RING_CAP) );
+
+   // Freeing up part of the ring lets that much more in, wrapping around
+   TEST_ASSERT_EQUAL_size_t( 5, Ascii7Seg_StreamRead(&Stream, out, 5) );
+   TEST_ASSERT_EQUAL_size_t( 5, Ascii7Seg_StreamFeed(&Stream, &input[RING_CAP], INPUT_LEN - RING_CAP) );
+   TEST_ASSERT_EQUAL_size_t( RING_CAP, Ascii7Seg_StreamRead(&Stream, out, RING_CAP) );
+   for ( size_t i = 0; i < RING_CAP; i++ )
+   {
+      helper_CheckEncoding( &AsciiEncodingReferenceLookup[(uint8_t)input[5 + i]], &out[i], 5 + i );
+   }
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamRead(&Stream, out, RING_CAP) );
+}
+
+void test_Ascii7Seg_StreamFeed_SkipPolicy(void)
+{
+   char input[INPUT_LEN];
+   union Ascii7Seg_Encoding_U out[OUT_LEN];
+   helper_FillInput( input, INPUT_LEN, 4 );
+   input[0] = '\0';   // Not the end of the input, just unsupported
+
+   TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_SKIP, NULL) );
+   size_t num_out = helper_Pump( input, INPUT_LEN, 7, 3, out );
+
+   size_t expected_idx = 0;
+   for ( size_t i = 0; i < INPUT_LEN; i++ )
+   {
+      if ( Ascii7Seg_IsSupportedChar(input[i]) )
+      {
+         helper_CheckEncoding( &AsciiEncodingReferenceLookup[(uint8_t)input[i]], &out[expected_idx], i );
+         expected_idx++;
+      }
+   }
+   TEST_ASSERT_EQUAL_size_t( expected_idx, num_out );
+   TEST_ASSERT_EQUAL_size_t( INPUT_LEN - 1 - (INPUT_LEN / 4), num_out );
+}
+
+void test_Ascii7Seg_StreamFeed_ReplacePolicy(void)
+{
+   char input[INPUT_LEN];
+   union Ascii7Seg_Encoding_U out[OUT_LEN];
+   union Ascii7Seg_Encoding_U blank;
+   union Ascii7Seg_Encoding_U replacement;
+   (void)memset( &blank, 0, sizeof(blank) );
+   TEST_ASSERT_TRUE( Ascii7Seg_ConvertChar('0', &replacement) );
+   helper_FillInput( input, INPUT_LEN, 3 );
+
+   // With no replacement given, unsupported characters become blank digits
+   TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_REPLACE, NULL) );
+   TEST_ASSERT_EQUAL_size_t( INPUT_LEN, helper_Pump(input, INPUT_LEN, 11, 4, out) );
+   for ( size_t i = 0; i < INPUT_LEN; i++ )
+   {
+      helper_CheckEncoding( Ascii7Seg_IsSupportedChar(input[i]) ?
+                              &AsciiEncodingReferenceLookup[(uint8_t)input[i]] : &blank,
+                            &out[i], i );
+   }
+
+   TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_REPLACE, &replacement) );
+   TEST_ASSERT_EQUAL_size_t( INPUT_LEN, helper_Pump(input, INPUT_LEN, 11, 4, out) );
+   for ( size_t i = 0; i < INPUT_LEN; i++ )
+   {
+      helper_CheckEncoding( Ascii7Seg_IsSupportedChar(input[i]) ?
+                              &AsciiEncodingReferenceLookup[(uint8_t)input[i]] : &replacement,
+                            &out[i], i );
+   }
+}
+
+// An unsupported character that arrives with the ring full isn't consumed until
+// there's room for its replacement
+void test_Ascii7Seg_StreamFeed_ReplaceWaitsForRoom(void)
+{
+   char input[RING_CAP + 2];
+   union Ascii7Seg_Encoding_U out[RING_CAP];
+   helper_FillInput( input, RING_CAP, 0 );
+   input[RING_CAP] = '#';
+   input[RING_CAP + 1] = '0';
+
+   TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_REPLACE, NULL) );
+   TEST_ASSERT_EQUAL_size_t( RING_CAP, Ascii7Seg_StreamFeed(&Stream, input, sizeof(input)) );
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_StreamRead(&Stream, out, 1) );
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_StreamFeed(&Stream, &input[RING_CAP], 2) );
+
+   struct Ascii7Seg_StreamStats_S stats = Ascii7Seg_StreamFlush( &Stream );
+   TEST_ASSERT_EQUAL_size_t( RING_CAP + 1, stats.chars_consumed );
+   TEST_ASSERT_EQUAL_size_t( RING_CAP + 1, stats.encodings_written );
+   TEST_ASSERT_EQUAL_size_t( 1, stats.num_invalid );
+   TEST_ASSERT_EQUAL_size_t( RING_CAP, stats.first_invalid_offset );
+}
+
+void test_Ascii7Seg_StreamFlush_StatsAcrossChunks(void)
+{
+   char input[INPUT_LEN];
+   union Ascii7Seg_Encoding_U out[OUT_LEN];
+   helper_FillInput( input, INPUT_LEN, 0 );
+   input[100] = '\x7F';
+   input[150] = '#';
+
+   TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_SKIP, NULL) );
+   (void)helper_Pump( input, INPUT_LEN, 9, RING_CAP, out );
+
+   struct Ascii7Seg_StreamStats_S stats = Ascii7Seg_StreamFlush( &Stream );
+   TEST_ASSERT_EQUAL_size_t( INPUT_LEN, stats.chars_consumed );
+   TEST_ASSERT_EQUAL_size_t( INPUT_LEN - 2, stats.encodings_written );
+   TEST_ASSERT_EQUAL_size_t( 2, stats.num_invalid );
+   TEST_ASSERT_EQUAL_size_t( 100, stats.first_invalid_offset );
+   TEST_ASSERT_EQUAL_CHAR( '\x7F', stats.first_invalid_char );
+
+   // Offsets restart from the flush
+   (void)helper_Pump( &input[101], 60, 9, RING_CAP, out );
+   stats = Ascii7Seg_StreamFlush( &Stream );
+   TEST_ASSERT_EQUAL_size_t( 60, stats.chars_consumed );
+   TEST_ASSERT_EQUAL_size_t( 1, stats.num_invalid );
+   TEST_ASSERT_EQUAL_size_t( 49, stats.first_invalid_offset );
+   TEST_ASSERT_EQUAL_CHAR( '#', stats.first_invalid_char );
+
+   stats = Ascii7Seg_StreamFlush( &Stream );
+   TEST_ASSERT_EQUAL_size_t( 0, stats.chars_consumed );
+   TEST_ASSERT_EQUAL_size_t( 0, stats.num_invalid );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_STREAM_NO_INVALID_OFFSET, stats.first_invalid_offset );
+}
+
+void test_Ascii7Seg_Stream_NullArgs(void)
+{
+   union Ascii7Seg_Encoding_U out[1];
+   TEST_ASSERT_TRUE( Ascii7Seg_StreamInit(&Stream, Ring, RING_CAP, ASCII_7SEG_STREAM_SKIP, NULL) );
+
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamFeed(NULL, "0", 1) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamFeed(&Stream, NULL, 1) );
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_StreamFeed(&Stream, "0", 1) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamRead(NULL, out, 1) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamRead(&Stream, NULL, 1) );
+   TEST_ASSERT_EQUAL_size_t( 0, Ascii7Seg_StreamPending(NULL) );
+   TEST_ASSERT_EQUAL_size_t( 1, Ascii7Seg_StreamPending(&Stream) );
+
+   struct Ascii7Seg_StreamStats_S stats = Ascii7Seg_StreamFlush( NULL );
+   TEST_ASSERT_EQUAL_size_t( 0, stats.chars_consumed );
+   TEST_ASSERT_EQUAL_size_t( ASCII_7SEG_STREAM_NO_INVALID_OFFSET, stats.first_invalid_offset );
+}